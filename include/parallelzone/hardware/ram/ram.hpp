@@ -19,6 +19,7 @@
 #include <optional>
 #include <parallelzone/mpi_helpers/binary_buffer/binary_view.hpp>
 #include <parallelzone/mpi_helpers/commpp/commpp.hpp>
+#include <string>
 #include <vector>
 
 namespace parallelzone::hardware {
@@ -55,6 +56,9 @@ public:
     ///
     using const_binary_reference = mpi_helpers::BinaryView;
 
+    /// Type of a window for one-sided operations
+    using window_type = mpi_helpers::RMAWindow;
+
     // -------------------------------------------------------------------------
     // -- Ctors, Assignment, Dtor
     // -------------------------------------------------------------------------
@@ -183,6 +187,249 @@ public:
                               std::forward<FxnType>(fxn), my_rank_());
     }
 
+    /** @brief Nonblocking version of gather.
+     *
+     *  The returned future owns the buffers used by the operation. Calling
+     *  get() on it waits for the gather to finish.
+     *
+     *  @tparam T The type of the data being gathered.
+     *
+     *  @param[in] input The local data to send to the ResourceSet which owns
+     *                   *this.
+     *
+     *  @return A future which resolves to what gather returns.
+     */
+    template<typename T>
+    auto igather(T&& input) const {
+        return comm_().igather(std::forward<T>(input), my_rank_());
+    }
+
+    /** @brief Nonblocking version of reduce.
+     *
+     *  The returned future owns the buffers used by the operation. Calling
+     *  get() on it waits for the reduction to finish.
+     *
+     *  @tparam T The type of the array to reduce.
+     *  @tparam FxnType The type of the functor.
+     *
+     *  @param[in] input The array to reduce.
+     *  @param[in] fxn   The functor to use for the reduction.
+     *
+     *  @return A future which resolves to what reduce returns.
+     */
+    template<typename T, typename FxnType>
+    auto ireduce(T&& input, FxnType&& fxn) const {
+        return comm_().ireduce(std::forward<T>(input),
+                               std::forward<FxnType>(fxn), my_rank_());
+    }
+
+    // -------------------------------------------------------------------------
+    // -- MPI one-to-all operations
+    // -------------------------------------------------------------------------
+
+    /** @brief Sends data from the ResourceSet which owns *this to all members
+     *         of the RuntimeView.
+     *
+     *  See CommPP::broadcast for a more thorough description of this
+     *  operation.
+     *
+     *  @tparam T The type of the data being broadcast.
+     *
+     *  @param[in] input The data to send. Only the value on the ResourceSet
+     *                   which owns *this is used, on the other ResourceSets it
+     *                   is ignored.
+     *
+     *  @return A copy of the data held by the ResourceSet which owns *this.
+     */
+    template<typename T>
+    auto broadcast(T&& input) const {
+        return comm_().broadcast(std::forward<T>(input), my_rank_());
+    }
+
+    /** @brief Splits up @p input on the ResourceSet which owns *this and
+     *         sends one piece to each member of the RuntimeView.
+     *
+     *  See CommPP::scatter for a more thorough description of this operation,
+     *  including how @p input is split up.
+     *
+     *  @tparam T The type of the container being scattered.
+     *
+     *  @param[in] input The container to split up. Only the value on the
+     *                   ResourceSet which owns *this is used.
+     *
+     *  @return The local piece of @p input.
+     */
+    template<typename T>
+    auto scatter(T&& input) const {
+        return comm_().scatter(std::forward<T>(input), my_rank_());
+    }
+
+    /** @brief Like scatter, but the pieces can be different sizes.
+     *
+     *  See CommPP::scatterv for a more thorough description of this
+     *  operation.
+     *
+     *  @tparam T The type of the container being scattered.
+     *
+     *  @param[in] input The container to split up. Only the value on the
+     *                   ResourceSet which owns *this is used.
+     *
+     *  @return The local piece of @p input.
+     */
+    template<typename T>
+    auto scatterv(T&& input) const {
+        return comm_().scatterv(std::forward<T>(input), my_rank_());
+    }
+
+    // -------------------------------------------------------------------------
+    // -- MPI one-to-one operations
+    // -------------------------------------------------------------------------
+
+    /** @brief Sends data from the current process to the ResourceSet which
+     *         owns *this.
+     *
+     *  The string @p tag is mapped to an integer MPI tag by the communicator
+     *  (see CommPP::tag). The receiving ResourceSet must call recv, with the
+     *  same tag, on the RAM of the sending ResourceSet. See CommPP::send for
+     *  a more thorough description of this operation.
+     *
+     *  @note Like MPI_Send, this may block until the message is received, so
+     *        sending to the current process should be done with isend.
+     *
+     *  @tparam T The type of the data being sent.
+     *
+     *  @param[in] input The data to send.
+     *  @param[in] tag   The tag of the message.
+     */
+    template<typename T>
+    void send(T&& input, const std::string& tag) const {
+        const auto& comm = comm_();
+        comm.send(std::forward<T>(input), my_rank_(), comm.tag(tag));
+    }
+
+    /** @brief Receives data sent from the ResourceSet which owns *this to the
+     *         current process.
+     *
+     *  The size of the data does not need to be known ahead of time. See
+     *  CommPP::recv for a more thorough description of this operation.
+     *
+     *  @tparam T The type of the data being received.
+     *
+     *  @param[in] tag The tag of the message.
+     *
+     *  @return The received data.
+     */
+    template<typename T>
+    T recv(const std::string& tag) const {
+        const auto& comm = comm_();
+        return comm.recv<T>(my_rank_(), comm.tag(tag));
+    }
+
+    /** @brief Nonblocking version of send.
+     *
+     *  The returned future owns the buffer being sent. Calling get() on it
+     *  waits for the send to finish.
+     *
+     *  @tparam T The type of the data being sent.
+     *
+     *  @param[in] input The data to send.
+     *  @param[in] tag   The tag of the message.
+     *
+     *  @return A future tracking the send.
+     */
+    template<typename T>
+    auto isend(T&& input, const std::string& tag) const {
+        const auto& comm = comm_();
+        return comm.isend(std::forward<T>(input), my_rank_(), comm.tag(tag));
+    }
+
+    /** @brief Nonblocking version of recv.
+     *
+     *  See CommPP::irecv for details on how the message is matched.
+     *
+     *  @tparam T The type of the data being received.
+     *
+     *  @param[in] tag The tag of the message.
+     *
+     *  @return A future which resolves to the received data.
+     */
+    template<typename T>
+    auto irecv(const std::string& tag) const {
+        const auto& comm = comm_();
+        return comm.irecv<T>(my_rank_(), comm.tag(tag));
+    }
+
+    // -------------------------------------------------------------------------
+    // -- One-sided operations
+    // -------------------------------------------------------------------------
+
+    /** @brief Writes @p data into the part of @p window in *this.
+     *
+     *  The ResourceSet which owns *this does not take part. This call locks
+     *  the owner's region of @p window (with a shared lock), puts @p data,
+     *  and unlocks it, so @p data is in place when this returns. To issue
+     *  many operations under one lock, use RMAWindow directly.
+     *
+     *  @tparam T A contiguous_range type, deduced from @p data.
+     *
+     *  @param[in] window The window, created collectively with RuntimeView.
+     *  @param[in] data   The elements to write.
+     *  @param[in] offset Where the first element goes, in elements of @p T.
+     *
+     *  @throw std::out_of_range if @p data does not fit at @p offset. Strong
+     *                           throw guarantee.
+     */
+    template<typename T>
+    void put(const window_type& window, const T& data, size_type offset) const {
+        mpi_helpers::RMALockGuard lock(window, window_rank_());
+        window.put(data, window_rank_(), offset);
+    }
+
+    /** @brief Reads from the part of @p window in *this into @p out.
+     *
+     *  Reads `size(out)` elements. Like put, this locks and unlocks the
+     *  owner's region, so @p out holds the result when this returns.
+     *
+     *  @tparam T A contiguous_range type, deduced from @p out.
+     *
+     *  @param[in] window The window, created collectively with RuntimeView.
+     *  @param[out] out   Where the elements go.
+     *  @param[in] offset Where the first element is, in elements of @p T.
+     *
+     *  @throw std::out_of_range if the elements are not in the region. Strong
+     *                           throw guarantee.
+     */
+    template<typename T>
+    void get(const window_type& window, T&& out, size_type offset) const {
+        mpi_helpers::RMALockGuard lock(window, window_rank_());
+        window.get(std::forward<T>(out), window_rank_(), offset);
+    }
+
+    /** @brief Combines @p data into the part of @p window in *this.
+     *
+     *  Element `i` of the region becomes `op(region[i], data[i])`, atomically,
+     *  so many ResourceSets can accumulate into the same elements at once.
+     *  Like put, this locks and unlocks the owner's region.
+     *
+     *  @tparam T A contiguous_range type whose elements have an MPI datatype.
+     *  @tparam Op A functor which maps to a predefined MPI operation.
+     *
+     *  @param[in] window The window, created collectively with RuntimeView.
+     *  @param[in] data   The elements to combine into the region.
+     *  @param[in] offset Where the first element is, in elements of @p T.
+     *  @param[in] op     How to combine the elements. Default is addition.
+     *
+     *  @throw std::out_of_range if the elements are not in the region. Strong
+     *                           throw guarantee.
+     */
+    template<typename T,
+             typename Op = std::plus<mpi_helpers::contiguous_value_t<T>>>
+    void accumulate(const window_type& window, const T& data, size_type offset,
+                    Op op = {}) const {
+        mpi_helpers::RMALockGuard lock(window, window_rank_());
+        window.accumulate(data, window_rank_(), offset, op);
+    }
+
     // -------------------------------------------------------------------------
     // -- Utility methods
     // -------------------------------------------------------------------------
@@ -230,6 +477,11 @@ private:
     /// Returns the MPI rank which owns *this
     size_type my_rank_() const;
 
+    /// my_rank_() as the type windows use for ranks
+    window_type::size_type window_rank_() const {
+        return window_type::size_type(my_rank_());
+    }
+
     /// Returns the MPI communicator managing communication for *this
     const_comm_reference comm_() const;
 
@@ -371,7 +371,8 @@ BinaryBuffer make_binary_buffer(T&& input);
  *          user. @p T should be an unqualified type (*i.e.*, no const,
  *          references, or the like). If needs_serialized<T> is false we assume
  *          that T has a range ctor that can be used to fill in a new @p T
- *          instance.
+ *          instance, or that a default constructed T can be resized (or
+ *          already has the right size, as for std::array).
  *
  *  @param[in] buffer The contiguous binary buffer we are making the object
  * from.
@@ -15,6 +15,8 @@
  */
 
 #pragma once
+#include <ostream>
+#include <parallelzone/mpi_helpers/binary_buffer/detail_/binary_streambuf.hpp>
 
 /** @file binary_buffer.ipp
  *
@@ -51,19 +53,38 @@ template<typename T>
 BinaryBuffer make_binary_buffer(T&& input) {
     using clean_type = std::decay_t<T>;
     if constexpr(needs_serialized_v<clean_type>) {
-        using pimpl_type = detail_::BinaryBufferPIMPL<std::string>;
-        // TODO: Put directly into a string
-        std::stringstream ss;
+        using sink_type  = detail_::OutputBinaryStreambuf;
+        using pimpl_type = detail_::BinaryBufferPIMPL<sink_type::buffer_type>;
+
+        // Pass 1: Figure out how big the serialized object is, without
+        //         actually storing it, so the buffer is allocated once
+        detail_::CountingBinaryStreambuf counter;
+        {
+            std::ostream os(&counter);
+            cereal::BinaryOutputArchive ar(os);
+            ar << input;
+        }
+
+        // Pass 2: Serialize directly into the buffer the BinaryBuffer adopts
+        sink_type sink(counter.size());
         {
-            cereal::BinaryOutputArchive ar(ss);
+            std::ostream os(&sink);
+            cereal::BinaryOutputArchive ar(os);
             ar << std::forward<T>(input);
         }
-        auto pimpl = std::make_unique<pimpl_type>(ss.str());
+        auto pimpl = std::make_unique<pimpl_type>(sink.release());
         return BinaryBuffer(std::move(pimpl));
-    } else {
+    } else if constexpr(requires { input.data(); }) {
         using pimpl_type = detail_::BinaryBufferPIMPL<clean_type>;
         auto pimpl       = std::make_unique<pimpl_type>(std::forward<T>(input));
         return BinaryBuffer(std::move(pimpl));
+    } else {
+        // No data() member (e.g., std::valarray), so copy the elements out
+        using vector_type = std::vector<contiguous_value_t<clean_type>>;
+        using pimpl_type  = detail_::BinaryBufferPIMPL<vector_type>;
+        const auto* p     = detail_::contiguous_data(input);
+        vector_type buffer(p, p + detail_::contiguous_size(input));
+        return BinaryBuffer(std::make_unique<pimpl_type>(std::move(buffer)));
     }
 }
 
@@ -250,7 +250,8 @@ public:
  *          user. @p T should be an unqualified type (*i.e.*, no const,
  *          references, or the like). If needs_serialized<T> is false we assume
  *          that T has a range ctor that can be used to fill in a new @p T
- *          instance.
+ *          instance, or that a default constructed T can be resized (or
+ *          already has the right size, as for std::array).
  *
  *  @param[in] view An alias of contiguous binary data, from which we will make
  *                  the object.
@@ -15,6 +15,8 @@
  */
 
 #pragma once
+#include <istream>
+#include <parallelzone/mpi_helpers/binary_buffer/detail_/binary_streambuf.hpp>
 #include <parallelzone/mpi_helpers/traits/traits.hpp>
 #include <parallelzone/serialization.hpp>
 #include <sstream>
@@ -69,27 +71,33 @@ T from_binary_view(const ConstBinaryView& view) {
 
     static_assert(std::is_same_v<T, std::decay_t<T>>);
     if constexpr(needs_serialized_v<T>) {
-        using size_type = ConstBinaryView::size_type;
-        // TODO: use boost::iostreams to avoid copy into stringstream.
-        std::stringstream ss;
-        for(size_type i = 0; i < view.size(); ++i)
-            ss << *reinterpret_cast<const char*>(view.data() + i);
+        // Deserialize straight out of the view, no intermediate copy
+        detail_::InputBinaryStreambuf buffer(view.data(), view.size());
+        std::istream is(&buffer);
 
         T rv;
         {
-            cereal::BinaryInputArchive ar(ss);
+            cereal::BinaryInputArchive ar(is);
             ar >> rv;
         }
         return rv;
     } else {
         // Since we didn't need to serialize the T object going in, it must be
         // the case that T is basically a contiguous array of some type U. We
-        // assume that U is given by T::value_type and that T has a range ctor
-        // which takes two iterators.
+        // assume that U is given by T::value_type. If T has a range ctor
+        // which takes two iterators we use it, otherwise we copy into a T of
+        // the right size (e.g., std::array).
         using value_type = typename T::value_type;
         const auto* p    = reinterpret_cast<const value_type*>(view.data());
         auto n           = view.size() / sizeof(value_type);
-        return T(p, p + n);
+        if constexpr(std::is_constructible_v<T, const value_type*,
+                                             const value_type*>) {
+            return T(p, p + n);
+        } else {
+            auto rv = detail_::make_contiguous<T>(n);
+            std::copy(p, p + n, detail_::contiguous_data(rv));
+            return rv;
+        }
     }
 }
 
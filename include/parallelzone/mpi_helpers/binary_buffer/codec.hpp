@@ -0,0 +1,187 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <parallelzone/mpi_helpers/binary_buffer/binary_view.hpp>
+#include <string>
+#include <vector>
+
+namespace parallelzone::mpi_helpers {
+
+/** @brief Interface for (lossless) compressing binary data.
+ *
+ *  CommPP can compress serialized objects before sending them (see
+ *  CommPP::set_compression). How the bytes are compressed is up to the Codec
+ *  given to CommPP. The public methods of Codec all call pure virtual methods
+ *  which must be overridden in the derived classes.
+ *
+ *  Codecs must be stateless (compress and decompress are const and may be
+ *  called concurrently) and every process must use the same codec.
+ */
+class Codec {
+public:
+    /// Type of a read-only view of the bytes to compress/decompress
+    using const_view_type = ConstBinaryView;
+
+    /// Type of a view of the bytes to decompress into
+    using view_type = BinaryView;
+
+    /// Type of the buffer the compressed bytes are appended to
+    using buffer_type = std::vector<std::byte>;
+
+    /// Type used for counting bytes
+    using size_type = std::size_t;
+
+    virtual ~Codec() noexcept = default;
+
+    /** @brief Compresses @p data.
+     *
+     *  The compressed bytes are appended to @p out (anything already in
+     *  @p out is left alone). The compressed form is not required to be
+     *  smaller than @p data.
+     *
+     *  Derived classes should override compress_() to implement this method.
+     *
+     *  @param[in] data The bytes to compress.
+     *  @param[in,out] out The buffer to append the compressed bytes to.
+     *
+     *  @throw std::bad_alloc if @p out can not grow. Weak throw guarantee.
+     */
+    void compress(const_view_type data, buffer_type& out) const {
+        compress_(data, out);
+    }
+
+    /** @brief Reverses compress.
+     *
+     *  Derived classes should override decompress_() to implement this
+     *  method.
+     *
+     *  @param[in] data The bytes produced by compress.
+     *  @param[in] out  Where the decompressed bytes go. Must be exactly as
+     *                  long as the bytes which were compressed.
+     *
+     *  @throw std::runtime_error if @p data is malformed or does not
+     *                            decompress to exactly `out.size()` bytes.
+     *                            Weak throw guarantee.
+     */
+    void decompress(const_view_type data, view_type out) const {
+        decompress_(data, out);
+    }
+
+    /// The name of the compression scheme, e.g., for logging
+    std::string name() const { return name_(); }
+
+protected:
+    Codec() noexcept = default;
+
+private:
+    /// Override to implement compress()
+    virtual void compress_(const_view_type data, buffer_type& out) const = 0;
+
+    /// Override to implement decompress()
+    virtual void decompress_(const_view_type data, view_type out) const = 0;
+
+    /// Override to implement name()
+    virtual std::string name_() const = 0;
+};
+
+/** @brief A fast codec for data with long runs of zero bytes.
+ *
+ *  Sparse and mostly-zero arrays serialize to long runs of zero bytes
+ *  separated by a few non-zero values. This codec stores each run of at least
+ *  min_run() zero bytes as its length, and copies everything else verbatim.
+ *  The compressed form is a sequence of (literal length, literal bytes, zero
+ *  run length) records, with the lengths stored as LEB128 varints. This makes
+ *  both directions a single pass over the data, mostly spent in memcpy and
+ *  memset, at the cost of not compressing repeated non-zero patterns.
+ */
+class ZeroRunCodec : public Codec {
+public:
+    /** @brief Creates a codec which only encodes runs of at least @p min_run
+     *         zero bytes.
+     *
+     *  Encoding a run costs between 2 and 10 bytes (ending the current
+     *  literal and starting the next), so shorter runs are cheaper to copy.
+     *
+     *  @param[in] min_run The shortest run of zero bytes to encode. Values
+     *                     smaller than 1 are treated as 1.
+     *
+     *  @throw None No throw guarantee.
+     */
+    explicit ZeroRunCodec(size_type min_run = 8) noexcept :
+      m_min_run_(min_run > 0 ? min_run : 1) {}
+
+    /// The shortest run of zero bytes *this encodes
+    size_type min_run() const noexcept { return m_min_run_; }
+
+private:
+    /// Implements compress() by encoding the zero runs of @p data
+    void compress_(const_view_type data, buffer_type& out) const override;
+
+    /// Implements decompress() by expanding the zero runs
+    void decompress_(const_view_type data, view_type out) const override;
+
+    /// Implements name()
+    std::string name_() const override { return "zero-run"; }
+
+    /// The shortest run of zero bytes to encode
+    size_type m_min_run_;
+};
+
+/** @brief Running totals describing how well compression is working.
+ *
+ *  Compression only pays off if the time saved sending fewer bytes exceeds
+ *  compress_time plus decompress_time. The durations have the same type as
+ *  hardware::ProfileInformation::duration so the two can be compared
+ *  directly.
+ */
+struct CompressionStats {
+    /// Type used to measure time durations
+    using duration = std::chrono::high_resolution_clock::duration;
+
+    /// Number of bytes given to the compression stage
+    std::size_t bytes_in = 0;
+
+    /// Number of bytes the compression stage produced (including headers)
+    std::size_t bytes_out = 0;
+
+    /// Number of buffers which were sent compressed
+    std::size_t n_compressed = 0;
+
+    /// Number of buffers sent uncompressed (too small or incompressible)
+    std::size_t n_skipped = 0;
+
+    /// Time spent compressing (including checking incompressible buffers)
+    duration compress_time{};
+
+    /// Time spent decompressing received buffers
+    duration decompress_time{};
+
+    /** @brief The compression ratio achieved so far.
+     *
+     *  @return bytes_in / bytes_out, or 1 if nothing has been compressed.
+     *
+     *  @throw None No throw guarantee.
+     */
+    double ratio() const noexcept {
+        if(bytes_out == 0) return 1.0;
+        return static_cast<double>(bytes_in) / static_cast<double>(bytes_out);
+    }
+};
+
+} // namespace parallelzone::mpi_helpers
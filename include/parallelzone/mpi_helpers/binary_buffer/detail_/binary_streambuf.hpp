@@ -0,0 +1,209 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <streambuf>
+#include <vector>
+
+namespace parallelzone::mpi_helpers::detail_ {
+
+/** @brief A read-only stream buffer which aliases contiguous binary data.
+ *
+ *  Cereal's archives consume data through a std::istream. The easiest way to
+ *  get a std::istream is to copy the bytes into a std::stringstream, but for
+ *  large objects that copy is often as expensive as the deserialization
+ *  itself. InputBinaryStreambuf instead sets the get area of a std::streambuf
+ *  to the aliased bytes, so reading from a std::istream built around an
+ *  instance of this class reads straight from the original buffer.
+ *
+ *  @note InputBinaryStreambuf does not own the bytes it aliases. It is the
+ *        user's responsibility to ensure the aliased memory outlives *this.
+ */
+class InputBinaryStreambuf : public std::streambuf {
+public:
+    /// Type of a read-only pointer to the aliased bytes
+    using const_pointer = const std::byte*;
+
+    /// Type used for counting and offsets
+    using size_type = std::size_t;
+
+    /** @brief Creates a stream buffer aliasing @p n bytes starting at @p p.
+     *
+     *  @param[in] p A pointer to the first byte to alias. May be the nullptr
+     *               if @p n is 0.
+     *  @param[in] n The number of bytes to alias.
+     *
+     *  @throw None No throw guarantee.
+     */
+    InputBinaryStreambuf(const_pointer p, size_type n) noexcept {
+        // N.B. The get area is only ever read, the const_cast is needed
+        //      because std::streambuf's API is not const-aware.
+        auto* begin = const_cast<char*>(reinterpret_cast<const char*>(p));
+        setg(begin, begin, begin + n);
+    }
+
+protected:
+    /// Bulk read, a single memcpy out of the aliased bytes
+    std::streamsize xsgetn(char_type* s, std::streamsize n) override {
+        const auto n_read = std::min<std::streamsize>(n, egptr() - gptr());
+        if(n_read <= 0) return 0;
+        std::memcpy(s, gptr(), n_read);
+        // N.B. gbump takes an int, setg avoids overflow for > 2 GiB reads
+        setg(eback(), gptr() + n_read, egptr());
+        return n_read;
+    }
+
+    /// Number of bytes left to read, or -1 if we are at the end
+    std::streamsize showmanyc() override {
+        const auto n_left = egptr() - gptr();
+        return n_left > 0 ? n_left : -1;
+    }
+
+    /// Supports seeking relative to the beginning, current, and end positions
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir,
+                     std::ios_base::openmode which) override {
+        if(!(which & std::ios_base::in)) return pos_type(off_type(-1));
+        char_type* base = dir == std::ios_base::beg ? eback() :
+                          dir == std::ios_base::cur ? gptr() :
+                                                      egptr();
+        char_type* new_pos = base + off;
+        if(new_pos < eback() || new_pos > egptr())
+            return pos_type(off_type(-1));
+        setg(eback(), new_pos, egptr());
+        return pos_type(new_pos - eback());
+    }
+
+    /// Seeks to an absolute position
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+};
+
+/** @brief A write-only stream buffer which owns a growable binary buffer.
+ *
+ *  This is the output analog of InputBinaryStreambuf. Cereal's archives write
+ *  through std::ostream::rdbuf()->sputn, so wrapping an instance of this class
+ *  in a std::ostream lets cereal write straight into a std::vector<std::byte>.
+ *  Once serialization is done, release() hands the vector off (without a copy)
+ *  so that it can be adopted by a BinaryBuffer.
+ *
+ *  The buffer grows geometrically as needed. If the final size is known ahead
+ *  of time (see CountingBinaryStreambuf), passing it to the ctor means the
+ *  buffer is allocated exactly once.
+ */
+class OutputBinaryStreambuf : public std::streambuf {
+public:
+    /// Type of the buffer the bytes are written to
+    using buffer_type = std::vector<std::byte>;
+
+    /// Type used for counting and offsets
+    using size_type = std::size_t;
+
+    /** @brief Creates a stream buffer with room for @p capacity bytes.
+     *
+     *  @param[in] capacity The number of bytes to allocate up front. Default
+     *                      is 0.
+     *
+     *  @throw std::bad_alloc if allocating the buffer fails. Strong throw
+     *                        guarantee.
+     */
+    explicit OutputBinaryStreambuf(size_type capacity = 0) :
+      m_buffer_(capacity), m_size_(0) {}
+
+    /// The number of bytes written to *this so far
+    size_type size() const noexcept { return m_size_; }
+
+    /** @brief Releases the written bytes.
+     *
+     *  @return A buffer containing exactly the bytes written to *this. After
+     *          this call *this is empty.
+     *
+     *  @throw None No throw guarantee.
+     */
+    buffer_type release() noexcept {
+        m_buffer_.resize(m_size_); // Shrinking never reallocates
+        m_size_ = 0;
+        return std::move(m_buffer_);
+    }
+
+protected:
+    /// Bulk write, a single memcpy into the owned buffer
+    std::streamsize xsputn(const char_type* s, std::streamsize n) override {
+        if(n <= 0) return 0;
+        reserve_(m_size_ + n);
+        std::memcpy(m_buffer_.data() + m_size_, s, n);
+        m_size_ += n;
+        return n;
+    }
+
+    /// Single character write (we never set a put area so sputc lands here)
+    int_type overflow(int_type ch) override {
+        if(traits_type::eq_int_type(ch, traits_type::eof()))
+            return traits_type::not_eof(ch);
+        const auto c = traits_type::to_char_type(ch);
+        return xsputn(&c, 1) == 1 ? ch : traits_type::eof();
+    }
+
+private:
+    /// Ensures the buffer can hold @p n bytes, growing geometrically if not
+    void reserve_(size_type n) {
+        if(n <= m_buffer_.size()) return;
+        m_buffer_.resize(std::max(n, 2 * m_buffer_.size()));
+    }
+
+    /// The bytes written so far (plus any unused capacity)
+    buffer_type m_buffer_;
+
+    /// How many of the bytes in m_buffer_ have been written
+    size_type m_size_;
+};
+
+/** @brief A write-only stream buffer which only counts the bytes written.
+ *
+ *  Serializing into an instance of this class is a cheap way to figure out
+ *  how large the serialized form of an object is, without storing it.
+ */
+class CountingBinaryStreambuf : public std::streambuf {
+public:
+    /// Type used for counting
+    using size_type = std::size_t;
+
+    /// The number of bytes written to *this so far
+    size_type size() const noexcept { return m_size_; }
+
+protected:
+    /// Counts the bytes, but discards them
+    std::streamsize xsputn(const char_type*, std::streamsize n) override {
+        if(n <= 0) return 0;
+        m_size_ += n;
+        return n;
+    }
+
+    /// Counts a single character
+    int_type overflow(int_type ch) override {
+        if(!traits_type::eq_int_type(ch, traits_type::eof())) ++m_size_;
+        return traits_type::not_eof(ch);
+    }
+
+private:
+    /// The number of bytes written
+    size_type m_size_ = 0;
+};
+
+} // namespace parallelzone::mpi_helpers::detail_
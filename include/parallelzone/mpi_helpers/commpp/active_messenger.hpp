@@ -0,0 +1,281 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <functional>
+#include <memory>
+#include <parallelzone/mpi_helpers/binary_buffer/binary_buffer.hpp>
+#include <tuple>
+#include <type_traits>
+
+namespace parallelzone::mpi_helpers {
+class CommPP;
+
+namespace detail_ {
+class ActiveMessengerPIMPL;
+}
+
+/** @brief A handle to a function registered with an ActiveMessenger.
+ *
+ *  @tparam Args The parameters of the registered function. Messages sent
+ *               with the handle carry a std::tuple<std::decay_t<Args>...>.
+ */
+template<typename... Args>
+class AMHandle {
+public:
+    /// Type used to identify registered functions
+    using id_type = std::size_t;
+
+    /// Type the arguments are stored (and serialized) as
+    using arguments_type = std::tuple<std::decay_t<Args>...>;
+
+    /** @brief Wraps the id of a registered function.
+     *
+     *  Users should get handles from ActiveMessenger::register_handler.
+     *
+     *  @param[in] id The id of the registered function.
+     *
+     *  @throw None No throw guarantee.
+     */
+    explicit AMHandle(id_type id) noexcept : m_id_(id) {}
+
+    /// The id of the registered function
+    id_type id() const noexcept { return m_id_; }
+
+private:
+    /// The id of the registered function
+    id_type m_id_;
+};
+
+/** @brief Runs registered functions on other processes (active messages).
+ *
+ *  Irregular algorithms often need to "run this small function on the
+ *  process which owns the data". With collectives every process has to take
+ *  part, even if only one has something to say. An active message instead
+ *  names a function (registered ahead of time, in the same order on every
+ *  process) and carries its serialized arguments; the receiving process runs
+ *  the function when the message arrives.
+ *
+ *  Messages are sent over a duplicate of the communicator *this was made
+ *  from, so they never match other traffic. To amortize MPI's per-message
+ *  latency, messages to the same process are appended to a batch, and the
+ *  batch is sent (with CommPP::isend) once it holds batch_size() bytes, or
+ *  when flush() is called. Handlers run when the receiving process calls poll()
+ *  or fence(), i.e., at polling points. Running them on a progress thread
+ *  would require MPI_THREAD_MULTIPLE, which ParallelZone does not request.
+ *  Handlers may send messages themselves (e.g., replies, using source() to
+ *  find who to reply to).
+ *
+ *  fence() is collective and returns once every message sent before it,
+ *  including messages sent by handlers while it runs, has been handled.
+ *  Termination is detected by comparing the total number of batches sent and
+ *  received across all processes, in (non-blocking) all-reduce waves, until
+ *  two waves in a row agree.
+ *
+ *  @code
+ *  ActiveMessenger am(comm);
+ *  std::size_t n = 0;
+ *  auto add = am.register_handler([&](std::size_t i) { n += i; });
+ *  am.send(add, (comm.me() + 1) % comm.size(), std::size_t{2});
+ *  am.fence(); // n == 2 on every process
+ *  @endcode
+ */
+class ActiveMessenger {
+public:
+    /// Type of the object implementing *this
+    using pimpl_type = detail_::ActiveMessengerPIMPL;
+
+    /// Type of a pointer to the PIMPL
+    using pimpl_pointer = std::unique_ptr<pimpl_type>;
+
+    /// Type used for ranks (same as CommPP::size_type)
+    using size_type = int;
+
+    /// Type used to identify registered functions
+    using id_type = std::size_t;
+
+    /// Type of a view of serialized arguments
+    using const_binary_reference = ConstBinaryView;
+
+    /// Type of a type-erased handler, which is given the serialized arguments
+    using handler_type = std::function<void(const_binary_reference)>;
+
+    /// Counts of what this process has done since *this was created
+    struct stats_type {
+        /// Messages sent by this process
+        std::size_t n_sent = 0;
+
+        /// Batches those messages were sent in
+        std::size_t n_batches = 0;
+
+        /// Messages this process has run the handler of
+        std::size_t n_handled = 0;
+    };
+
+    /// The default value of batch_size()
+    static constexpr std::size_t default_batch_size = 64 * 1024;
+
+    /** @brief Collectively creates a messenger over the processes in @p comm.
+     *
+     *  @param[in] comm       The processes which can exchange messages. *this
+     *                        uses a duplicate of it.
+     *  @param[in] batch_size Batches are sent once they reach this many
+     *                        bytes. Use 0 to send every message on its own.
+     *
+     *  @throw std::runtime_error if @p comm is a null communicator. Strong
+     *                            throw guarantee.
+     */
+    explicit ActiveMessenger(const CommPP& comm,
+                             std::size_t batch_size = default_batch_size);
+
+    /// Deleted because handlers are registered with a particular object
+    ActiveMessenger(const ActiveMessenger&) = delete;
+
+    /// Deleted because handlers are registered with a particular object
+    ActiveMessenger& operator=(const ActiveMessenger&) = delete;
+
+    /// Takes the state of @p other
+    ActiveMessenger(ActiveMessenger&& other) noexcept;
+
+    /// Replaces the state of *this with that of @p rhs
+    ActiveMessenger& operator=(ActiveMessenger&& rhs) noexcept;
+
+    /** @brief Releases the communicator.
+     *
+     *  Messages which have not been delivered are lost, so processes should
+     *  call fence() before destroying their messenger.
+     */
+    ~ActiveMessenger() noexcept;
+
+    /** @brief Registers @p fxn so messages can run it.
+     *
+     *  Every process must register the same handlers in the same order, and
+     *  a handler must be registered on every process before any process
+     *  sends a message with it (e.g., register everything right after
+     *  creating *this). The arguments of @p fxn must be serializable with
+     *  cereal and its return (if any) is discarded.
+     *
+     *  @tparam Fxn The type of a callable whose signature can be deduced by
+     *              std::function (so not generic lambdas).
+     *
+     *  @param[in] fxn The function to register.
+     *
+     *  @return A handle for sending messages which run @p fxn.
+     *
+     *  @throw std::bad_alloc if registering the function fails. Strong throw
+     *                        guarantee.
+     */
+    template<typename Fxn>
+    auto register_handler(Fxn&& fxn) {
+        return register_(std::function{std::forward<Fxn>(fxn)});
+    }
+
+    /** @brief Sends a message which runs @p handler with @p inputs on
+     *         process @p rank.
+     *
+     *  The inputs are serialized right away. The message is added to the
+     *  batch for @p rank, which is sent if it is now at least batch_size()
+     *  bytes. Messages to the same process are handled in the order they
+     *  were sent. @p rank may be this process.
+     *
+     *  @param[in] handler The function to run.
+     *  @param[in] rank    The process to run it on.
+     *  @param[in] inputs  The arguments to run it with.
+     *
+     *  @throw std::out_of_range if @p handler is not registered or @p rank is
+     *                           not a valid rank. Strong throw guarantee.
+     */
+    template<typename... Args, typename... Inputs>
+    void send(const AMHandle<Args...>& handler, size_type rank,
+              Inputs&&... inputs) {
+        static_assert(sizeof...(Inputs) == sizeof...(Args),
+                      "Wrong number of arguments for the handler");
+        typename AMHandle<Args...>::arguments_type args(
+          std::forward<Inputs>(inputs)...);
+        send_(handler.id(), rank, make_binary_buffer(args));
+    }
+
+    /** @brief Sends every batch which has not been sent.
+     *
+     *  @throw None No throw guarantee.
+     */
+    void flush();
+
+    /** @brief Runs the handlers of every message which has arrived.
+     *
+     *  Also completes batches this process has sent, which frees their
+     *  buffers. Does not wait for messages which have not arrived.
+     *
+     *  @return The number of messages handled.
+     *
+     *  @throw std::runtime_error if a message names a handler which has not
+     *                            been registered on this process. Weak
+     *                            throw guarantee.
+     *  @throw ??? Throws if a handler throws. The messages after the one
+     *             whose handler threw are lost. Weak throw guarantee.
+     */
+    std::size_t poll();
+
+    /** @brief Collectively waits until every message has been handled.
+     *
+     *  Flushes and polls until all messages sent (by any process) before or
+     *  during the call have been handled, see the class description.
+     *
+     *  @throw ??? Throws if a handler throws. Weak throw guarantee.
+     */
+    void fence();
+
+    /** @brief The process which sent the message being handled.
+     *
+     *  @return The rank of the sender, or MPI_PROC_NULL if no handler is
+     *          running.
+     *
+     *  @throw None No throw guarantee.
+     */
+    size_type source() const noexcept;
+
+    /// The number of bytes a batch is sent at
+    std::size_t batch_size() const noexcept;
+
+    /// What this process has done so far
+    stats_type stats() const noexcept;
+
+private:
+    /// Type-erases @p fxn and registers it
+    template<typename R, typename... Args>
+    AMHandle<Args...> register_(std::function<R(Args...)> fxn) {
+        using args_type = typename AMHandle<Args...>::arguments_type;
+        handler_type handler = [fxn = std::move(fxn)](
+                                 const_binary_reference bytes) {
+            std::apply(fxn, from_binary_view<args_type>(bytes));
+        };
+        return AMHandle<Args...>(add_handler_(std::move(handler)));
+    }
+
+    /// Adds @p handler to the registry, returning its id
+    id_type add_handler_(handler_type handler);
+
+    /// Appends a message running handler @p id on @p rank to @p rank's batch
+    void send_(id_type id, size_type rank, const BinaryBuffer& args);
+
+    /// Returns the PIMPL, throws std::runtime_error if *this was moved from
+    pimpl_type& pimpl_() const;
+
+    /// The object actually implementing *this
+    pimpl_pointer m_pimpl_;
+};
+
+} // namespace parallelzone::mpi_helpers
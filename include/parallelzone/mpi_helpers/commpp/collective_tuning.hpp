@@ -0,0 +1,158 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+namespace parallelzone::mpi_helpers {
+
+/** @brief The thresholds CommPP uses to pick how collectives move data.
+ *
+ *  When a collective is called with algorithm::automatic, CommPP picks the
+ *  algorithm from these thresholds. They are usually measured for the
+ *  machine and communicator at hand with CommPP::tune, which can also save
+ *  them to (and load them from) a file, so the measuring only has to be
+ *  done once per job layout. The default values make every automatic
+ *  collective flat and two-phase, i.e., a single MPI call per step.
+ *
+ *  The file format is one "key value" pair per line, with '#' starting a
+ *  comment. Thresholds which are never reached are written as "never".
+ */
+struct CollectiveTuning {
+    /// Type used for sizes (in bytes) and counts
+    using size_type = std::size_t;
+
+    /// Value of a threshold which is never reached
+    static constexpr size_type never = std::numeric_limits<size_type>::max();
+
+    /** @brief Largest block (per process) sent eagerly by all gathervs.
+     *
+     *  An all gatherv of serialized objects normally first gathers the size
+     *  of every block, and then the blocks. If every block is at most this
+     *  many bytes, a single all gather of fixed-size (padded) slots, each
+     *  holding a block and its size, does both at once. If any block does
+     *  not fit, the sizes are still learned from the slots and a second all
+     *  gatherv moves the blocks. 0 turns this off. Automatic all gathervs
+     *  only go eager while the slots are small (see goes_eager).
+     */
+    size_type eager_threshold = 0;
+
+    /// Most bytes (over all processes) automatic all gathervs put in slots
+    static constexpr size_type max_eager_bytes = size_type(1) << 16;
+
+    /// Total size (in bytes) at which automatic all gathers use a ring
+    size_type ring_threshold = never;
+
+    /// Total size (in bytes) at which automatic all gathers go hierarchical
+    size_type hierarchical_threshold = never;
+
+    /// Should serialized blocks be compressed (if a codec is set)?
+    bool compress = true;
+
+    /// Number of processes the thresholds were measured with (0 if unknown)
+    size_type n_procs = 0;
+
+    /// Number of nodes the thresholds were measured with (0 if unknown)
+    size_type n_nodes = 0;
+
+    /// Are all of the members of *this equal to those of @p rhs?
+    bool operator==(const CollectiveTuning& rhs) const noexcept = default;
+
+    /** @brief Does *this apply to a communicator of the given shape?
+     *
+     *  @param[in] procs The number of processes in the communicator.
+     *  @param[in] nodes The number of nodes the processes are spread over.
+     *
+     *  @return True if *this was measured with @p procs processes on
+     *          @p nodes nodes and false otherwise.
+     *
+     *  @throw None No throw guarantee.
+     */
+    bool matches(size_type procs, size_type nodes) const noexcept {
+        return n_procs == procs && n_nodes == nodes;
+    }
+
+    /** @brief Do automatic all gathervs over @p procs processes go eager?
+     *
+     *  The slots are all gathered even if a block does not fit in its slot,
+     *  in which case they are pure overhead. Automatic all gathervs thus
+     *  only go eager if the slots of all of the processes (each holding an
+     *  8-byte size and up to eager_threshold bytes) take at most
+     *  max_eager_bytes, i.e., cost about as much as the size exchange.
+     *
+     *  @param[in] procs The number of processes in the communicator.
+     *
+     *  @return True if eager_threshold is set and the slots of @p procs
+     *          processes fit in max_eager_bytes, false otherwise.
+     *
+     *  @throw None No throw guarantee.
+     */
+    bool goes_eager(size_type procs) const noexcept {
+        if(eager_threshold == 0 || eager_threshold > max_eager_bytes)
+            return false;
+        return procs * (sizeof(std::uint64_t) + eager_threshold) <=
+               max_eager_bytes;
+    }
+
+    /** @brief Writes *this in the format of a tuning file.
+     *
+     *  @return The contents of a tuning file describing *this.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the string.
+     *                        Strong throw guarantee.
+     */
+    std::string to_string() const;
+
+    /** @brief Reads the contents of a tuning file.
+     *
+     *  Keys which are not recognized are skipped, so files written by newer
+     *  versions can still be read. Keys which are missing keep their default
+     *  values.
+     *
+     *  @param[in] text The contents of a tuning file.
+     *
+     *  @return The tuning described by @p text.
+     *
+     *  @throw std::runtime_error if a value can not be parsed. Strong throw
+     *                            guarantee.
+     */
+    static CollectiveTuning from_string(const std::string& text);
+
+    /** @brief Writes *this to the file @p path, replacing its contents.
+     *
+     *  @param[in] path The file to write to.
+     *
+     *  @throw std::runtime_error if the file can not be written. Weak throw
+     *                            guarantee.
+     */
+    void save(const std::string& path) const;
+
+    /** @brief Reads the tuning file @p path.
+     *
+     *  @param[in] path The file to read.
+     *
+     *  @return The tuning described by the file.
+     *
+     *  @throw std::runtime_error if the file can not be read or parsed.
+     *                            Strong throw guarantee.
+     */
+    static CollectiveTuning load(const std::string& path);
+};
+
+} // namespace parallelzone::mpi_helpers
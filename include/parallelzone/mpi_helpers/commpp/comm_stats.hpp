@@ -0,0 +1,159 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace parallelzone::mpi_helpers {
+
+/** @brief Running totals describing one kind of MPI operation.
+ *
+ *  The durations have the same type as CompressionStats::duration so the
+ *  two can be compared directly. The MPI time of a nonblocking operation
+ *  only covers starting it (the wait is not included), so nonblocking calls
+ *  are left out of the latency histogram.
+ */
+struct OpStats {
+    /// Type used to measure time durations
+    using duration = std::chrono::high_resolution_clock::duration;
+
+    /// Number of bins in the latency histogram
+    static constexpr std::size_t n_bins = 32;
+
+    /// Type of the latency histogram
+    using histogram_type = std::array<std::size_t, n_bins>;
+
+    /// Number of times the operation was called
+    std::size_t n_calls = 0;
+
+    /// Number of bytes this process sent
+    std::size_t bytes_sent = 0;
+
+    /// Number of bytes this process received
+    std::size_t bytes_received = 0;
+
+    /// Time spent in MPI
+    duration mpi_time{};
+
+    /// Time spent (de)serializing objects for (or from) the operation
+    duration serialization_time{};
+
+    /** @brief How many blocking calls took how long.
+     *
+     *  latency[0] counts the calls which spent less than a microsecond in
+     *  MPI, and latency[i] counts those which spent [2^(i-1), 2^i)
+     *  microseconds. The last bin also counts anything slower. Nonblocking
+     *  calls are not counted, since only the time to start them is known.
+     */
+    histogram_type latency{};
+
+    /** @brief Records one call which spent @p mpi time in MPI.
+     *
+     *  @param[in] sent     The number of bytes sent by this process.
+     *  @param[in] received The number of bytes received by this process.
+     *  @param[in] mpi      The time the call spent in MPI.
+     *  @param[in] blocking False if the call only started a nonblocking
+     *                      operation, in which case @p mpi is not added to
+     *                      the latency histogram. Defaults to true.
+     *
+     *  @throw None No throw guarantee.
+     */
+    void add_call(std::size_t sent, std::size_t received, duration mpi,
+                  bool blocking = true) noexcept;
+
+    /** @brief The latency bin @p mpi falls into.
+     *
+     *  @param[in] mpi The time a call spent in MPI.
+     *
+     *  @return The index of the bin in latency.
+     *
+     *  @throw None No throw guarantee.
+     */
+    static std::size_t bin(duration mpi) noexcept;
+
+    /** @brief Adds the totals in @p rhs to *this.
+     *
+     *  @param[in] rhs The statistics to add.
+     *
+     *  @return *this after adding @p rhs.
+     *
+     *  @throw None No throw guarantee.
+     */
+    OpStats& operator+=(const OpStats& rhs) noexcept;
+
+    /// Serializes (or deserializes) *this with the archive @p ar
+    template<typename Archive>
+    void serialize(Archive& ar) {
+        auto mpi = mpi_time.count();
+        auto ser = serialization_time.count();
+        ar(n_calls, bytes_sent, bytes_received, mpi, ser, latency);
+        mpi_time           = duration(mpi);
+        serialization_time = duration(ser);
+    }
+};
+
+/** @brief The statistics of each kind of operation done on a communicator.
+ *
+ *  Operations are keyed by the MPI operation they wrap, with rooted and
+ *  all-to-all variants kept apart (e.g., "gather" vs. "allgather"). The
+ *  statistics of a single process can be summed with those of other
+ *  processes via operator+= to describe the communicator as a whole.
+ */
+struct CommStats {
+    /// Type of the map from operation name to its statistics
+    using op_map_type = std::map<std::string, OpStats>;
+
+    /// The statistics of each kind of operation which has been called
+    op_map_type ops;
+
+    /// The statistics of all operations added together
+    OpStats total() const noexcept;
+
+    /** @brief Adds the statistics in @p rhs to *this, operation by operation.
+     *
+     *  @param[in] rhs The statistics to add.
+     *
+     *  @return *this after adding @p rhs.
+     *
+     *  @throw std::bad_alloc if *this needs to add an operation and there is
+     *                        a problem allocating it. Weak throw guarantee.
+     */
+    CommStats& operator+=(const CommStats& rhs);
+
+    /** @brief Formats *this as a human-readable table.
+     *
+     *  There is one row per operation, giving its call count, bytes moved,
+     *  and times, followed by the non-empty bins of its latency histogram.
+     *
+     *  @return The table.
+     *
+     *  @throw std::bad_alloc if there is a problem allocating the string.
+     *                        Strong throw guarantee.
+     */
+    std::string to_string() const;
+
+    /// Serializes (or deserializes) *this with the archive @p ar
+    template<typename Archive>
+    void serialize(Archive& ar) {
+        ar(ops);
+    }
+};
+
+} // namespace parallelzone::mpi_helpers
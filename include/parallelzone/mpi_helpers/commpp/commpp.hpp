@@ -15,11 +15,23 @@
  */
 
 #pragma once
+#include <chrono>
 #include <memory>
 #include <mpi.h>
 #include <parallelzone/mpi_helpers/binary_buffer/binary_buffer.hpp>
 #include <parallelzone/mpi_helpers/binary_buffer/binary_view.hpp>
+#include <parallelzone/mpi_helpers/binary_buffer/codec.hpp>
+#include <parallelzone/mpi_helpers/commpp/active_messenger.hpp>
+#include <parallelzone/mpi_helpers/commpp/collective_tuning.hpp>
+#include <parallelzone/mpi_helpers/commpp/comm_stats.hpp>
+#include <parallelzone/mpi_helpers/commpp/commpp_future.hpp>
+#include <parallelzone/mpi_helpers/commpp/persistent_reduction.hpp>
+#include <parallelzone/mpi_helpers/commpp/rma_window.hpp>
+#include <parallelzone/mpi_helpers/commpp/user_op.hpp>
 #include <parallelzone/mpi_helpers/traits/gather.hpp>
+#include <span>
+#include <string>
+#include <tuple>
 
 namespace parallelzone::mpi_helpers {
 namespace detail_ {
@@ -53,6 +65,18 @@ public:
     /// Type used for indexing and offsets
     using size_type = int;
 
+    /// Type of a number of bytes (may exceed what a size_type can hold)
+    using byte_count_type = MPI_Count;
+
+    /// Type of an offset, in bytes, into a block of binary data
+    using byte_offset_type = MPI_Aint;
+
+    /// Type of the number of bytes per process
+    using byte_count_container = std::vector<byte_count_type>;
+
+    /// Type of the offset, in bytes, of each process's data
+    using byte_offset_container = std::vector<byte_offset_type>;
+
     /// Type of a block of binary data
     using binary_type = BinaryBuffer;
 
@@ -66,11 +90,53 @@ public:
     using binary_gather_return = gather_return_t<binary_type>;
 
     /// Type of a buffer and the sizes per rank
-    using gatherv_pair = std::pair<binary_type, std::vector<size_type>>;
+    using gatherv_pair = std::pair<binary_type, byte_count_container>;
 
     /// Type returned by the binary version of gatherv
     using binary_gatherv_return = std::optional<gatherv_pair>;
 
+    /// Type of a handle to an in-flight MPI operation
+    using request_type = MPI_Request;
+
+    /// Type of a (shared) pointer to the codec used to compress messages
+    using codec_pointer = std::shared_ptr<const Codec>;
+
+    /// Type of the statistics collected about compression
+    using compression_stats_type = CompressionStats;
+
+    /// Type of the statistics collected about each operation
+    using comm_stats_type = CommStats;
+
+    /// Type of the thresholds used to pick collective algorithms
+    using tuning_type = CollectiveTuning;
+
+    /// Type of a window for one-sided communication
+    using window_type = RMAWindow;
+
+    /// Type of an integer message tag
+    using tag_type = int;
+
+    /// Type of a handle to a message which has been matched, but not received
+    using message_type = MPI_Message;
+
+    /// Type of a matched message and its size in bytes
+    using probe_return =
+      std::optional<std::pair<message_type, byte_count_type>>;
+
+    /** @brief Strategies a collective may use to move the data.
+     *
+     *  - automatic: let *this decide (see set_tuning).
+     *  - flat: a single MPI call over all processes.
+     *  - hierarchical: first among the processes on a node, then among one
+     *    leader process per node (see set_node_color).
+     *  - ring: `size() - 1` steps in which each process passes a block on to
+     *    the next process, so each step only uses one link per process.
+     *  - eager: all gathervs of serialized objects send the blocks along with
+     *    their sizes in one padded all gather (see
+     *    CollectiveTuning::eager_threshold). Acts like flat otherwise.
+     */
+    enum class algorithm { automatic, flat, hierarchical, ring, eager };
+
     // -------------------------------------------------------------------------
     // -- CTors, Assignment, and Dtor
     // -------------------------------------------------------------------------
@@ -233,6 +299,25 @@ public:
      */
     void swap(CommPP& other) noexcept;
 
+    /** @brief Creates a new communicator with the same processes as *this.
+     *
+     *  MPI messages only match other messages sent on the same communicator.
+     *  This method wraps MPI_Comm_dup so that libraries (ParallelZone
+     *  included) can get a communicator whose traffic will never match
+     *  messages the user sends on comm(). Unlike communicators passed to the
+     *  ctor, the resulting CommPP owns the duplicated communicator. Copies of
+     *  the resulting CommPP share ownership, and the communicator is freed
+     *  when the last copy goes out of scope (assuming MPI has not already
+     *  been finalized).
+     *
+     *  This method is collective, i.e., it must be called by every process in
+     *  comm().
+     *
+     *  @return A CommPP wrapping a duplicate of comm(). If *this is a null
+     *          communicator the result is also a null communicator.
+     */
+    CommPP duplicate() const;
+
     /** @brief Determines if *this is value equal to @p rhs.
      *
      *  *this is value equal to @p rhs if both *this and @p rhs are null
@@ -262,6 +347,234 @@ public:
      */
     bool operator!=(const CommPP& rhs) const noexcept;
 
+    // -------------------------------------------------------------------------
+    // -- Collective Algorithms
+    // -------------------------------------------------------------------------
+
+    /** @brief Sets when automatic all gathers become hierarchical.
+     *
+     *  A flat all gather sends every process's data to every other process,
+     *  so on a machine with `p` processes per node each piece of data crosses
+     *  the network `p` times per node. A hierarchical all gather first
+     *  gathers the data to one leader per node (through shared memory), then
+     *  exchanges it among the leaders only, and finally broadcasts the result
+     *  to the other processes on the node (again through shared memory). This
+     *  has more steps, so it only pays off for large messages.
+     *
+     *  All gathers (gather and gatherv without a root) whose total size is at
+     *  least @p n_bytes use the hierarchical algorithm, unless an algorithm
+     *  is requested explicitly. By default the threshold is the largest
+     *  std::size_t, i.e., automatic all gathers are flat. The setting must be
+     *  the same on every process and is copied along with *this.
+     *
+     *  @param[in] n_bytes The total message size at which to switch.
+     *
+     *  @throw std::runtime_error if *this has no PIMPL. Strong throw
+     *                            guarantee.
+     */
+    void set_hierarchical_threshold(std::size_t n_bytes);
+
+    /** @brief The total message size at which all gathers become
+     *         hierarchical.
+     *
+     *  @return The value set by set_hierarchical_threshold.
+     *
+     *  @throw std::runtime_error if *this has no PIMPL. Strong throw
+     *                            guarantee.
+     */
+    std::size_t hierarchical_threshold() const;
+
+    /** @brief Overrides how processes are grouped into nodes.
+     *
+     *  By default hierarchical collectives treat processes which can share
+     *  memory (per MPI_Comm_split_type with MPI_COMM_TYPE_SHARED) as being on
+     *  the same node. After calling this method, processes which were given
+     *  the same @p color are treated as being on the same node instead. This
+     *  is mainly useful for testing the hierarchical algorithms on a single
+     *  machine. The node layout is computed (collectively) the next time a
+     *  hierarchical collective is called.
+     *
+     *  @param[in] color This process's node. Must be non-negative, and must
+     *                   be set on every process.
+     *
+     *  @throw std::runtime_error if *this has no PIMPL. Strong throw
+     *                            guarantee.
+     */
+    void set_node_color(size_type color);
+
+    /** @brief Sets the thresholds automatic collectives use to pick an
+     *         algorithm.
+     *
+     *  Automatic all gathers (gather and gatherv without a root) whose total
+     *  size is at least `tuning.hierarchical_threshold` go hierarchical if
+     *  the processes are spread over several nodes with several processes
+     *  each. Otherwise, those whose total size is at least
+     *  `tuning.ring_threshold` use a ring (if there are more than two
+     *  processes). Everything else is flat. All gathervs of serialized
+     *  objects also send the blocks eagerly per `tuning.eager_threshold`
+     *  (unless the slots would be large, see CollectiveTuning::goes_eager),
+     *  and `tuning.compress` turns compression (see set_compression) off
+     *  without forgetting the codec. Rooted collectives always use the flat,
+     *  two-phase algorithms.
+     *
+     *  set_hierarchical_threshold sets the corresponding member of the
+     *  tuning. The tuning must be the same on every process and is copied
+     *  along with *this.
+     *
+     *  @param[in] tuning The thresholds to use.
+     *
+     *  @throw std::runtime_error if *this has no PIMPL. Strong throw
+     *                            guarantee.
+     */
+    void set_tuning(const tuning_type& tuning);
+
+    /** @brief The thresholds automatic collectives use to pick an algorithm.
+     *
+     *  @return The value set by set_tuning (or measured by tune).
+     *
+     *  @throw std::runtime_error if *this has no PIMPL. Strong throw
+     *                            guarantee.
+     */
+    tuning_type tuning() const;
+
+    /** @brief Measures (or loads) and sets the tuning for this machine.
+     *
+     *  This runs a short micro-benchmark of each algorithm over a range of
+     *  message sizes, and sets each threshold to the size at which the
+     *  algorithm starts (and keeps) beating the default. If compression is
+     *  set and has been used, compression is kept on only if the codec's
+     *  measured throughput and ratio save more time than they cost at the
+     *  measured bandwidth.
+     *
+     *  If @p path is not empty, process 0 first tries to read a tuning file
+     *  from @p path. If the file exists and was measured with the same number
+     *  of processes and nodes, its tuning is used without measuring
+     *  anything. Otherwise the tuning is measured and process 0 writes it to
+     *  @p path, so later runs with the same layout can skip measuring.
+     *
+     *  This is a collective operation.
+     *
+     *  @param[in] path The tuning file. Default is no file.
+     *
+     *  @return The tuning which was set.
+     *
+     *  @throw std::runtime_error if *this has no PIMPL or process 0 could not
+     *                            write @p path (thrown on every process).
+     *                            Weak throw guarantee.
+     */
+    tuning_type tune(const std::string& path = "");
+
+    // -------------------------------------------------------------------------
+    // -- Compression
+    // -------------------------------------------------------------------------
+
+    /** @brief Compresses serialized objects before sending them.
+     *
+     *  Objects which need to be serialized (see NeedsSerialized) are sent as
+     *  one block of bytes per process. After calling this method, collectives
+     *  compress each block of at least @p threshold bytes with @p codec
+     *  before sending it, and decompress the blocks they receive. Blocks which
+     *  do not get smaller are sent uncompressed. Every block (compressed or
+     *  not) gains a 9 byte header.
+     *
+     *  This applies to the serialized forms of gather, gatherv, and
+     *  broadcast. Contiguous containers are never compressed, since doing so
+     *  would prevent receiving them directly into the result.
+     *
+     *  Compression is off by default. The setting must be the same on every
+     *  process and is copied along with *this.
+     *
+     *  @param[in] codec     The codec to compress with. A null pointer turns
+     *                       compression off.
+     *  @param[in] threshold Blocks smaller than this many bytes are not
+     *                       compressed. Default is 0.
+     *
+     *  @throw std::runtime_error if *this has no PIMPL. Strong throw
+     *                            guarantee.
+     */
+    void set_compression(codec_pointer codec, std::size_t threshold = 0);
+
+    /** @brief Statistics about the blocks this process has compressed and
+     *         decompressed since compression was last turned on or reset.
+     *
+     *  Use these to decide if compression pays off, e.g., by comparing
+     *  the time spent compressing to the time saved sending fewer bytes.
+     *
+     *  @return A copy of the current statistics.
+     *
+     *  @throw std::runtime_error if *this has no PIMPL. Strong throw
+     *                            guarantee.
+     */
+    compression_stats_type compression_stats() const;
+
+    /** @brief Zeros the statistics returned by compression_stats.
+     *
+     *  @throw std::runtime_error if *this has no PIMPL. Strong throw
+     *                            guarantee.
+     */
+    void reset_compression_stats();
+
+    // -------------------------------------------------------------------------
+    // -- Instrumentation
+    // -------------------------------------------------------------------------
+
+    /** @brief Turns recording statistics about each operation on or off.
+     *
+     *  While instrumentation is on, every MPI operation done through *this
+     *  records (per kind of operation) the number of calls, the bytes this
+     *  process sent and received, the time spent in MPI, and a histogram of
+     *  how long the calls took. For nonblocking operations only starting
+     *  them is timed, so they are left out of the histogram. Collectives
+     *  which serialize objects also record the time spent (de)serializing
+     *  them, separately from the MPI time. Rooted and all-to-all variants
+     *  are kept apart, e.g., gather with a root is recorded as "gather" and
+     *  without one as "allgather".
+     *  Collectives built out of several MPI operations (e.g., gatherv first
+     *  gathers the sizes) record each of them.
+     *
+     *  Instrumentation is always compiled in, but off by default, in which
+     *  case its cost is a flag check per operation. The setting and the
+     *  statistics are shared by all copies of *this (a duplicate() starts
+     *  with the same setting, but its own statistics). Unlike compression,
+     *  the setting may differ from process to process.
+     *
+     *  @param[in] on True to start recording, false to stop.
+     *
+     *  @throw std::runtime_error if *this has no PIMPL. Strong throw
+     *                            guarantee.
+     */
+    void set_instrumentation(bool on);
+
+    /** @brief Is instrumentation turned on?
+     *
+     *  @return True if operations are being recorded, false otherwise.
+     *
+     *  @throw std::runtime_error if *this has no PIMPL. Strong throw
+     *                            guarantee.
+     */
+    bool instrumenting() const;
+
+    /** @brief Statistics about the operations this process has done on this
+     *         communicator while instrumentation was on.
+     *
+     *  The statistics are for this process only. They may be summed with
+     *  those of the other processes (e.g., via RuntimeView::comm_stats) to
+     *  describe the communicator as a whole.
+     *
+     *  @return A copy of the current statistics.
+     *
+     *  @throw std::runtime_error if *this has no PIMPL. Strong throw
+     *                            guarantee.
+     */
+    comm_stats_type comm_stats() const;
+
+    /** @brief Zeros the statistics returned by comm_stats.
+     *
+     *  @throw std::runtime_error if *this has no PIMPL. Strong throw
+     *                            guarantee.
+     */
+    void reset_comm_stats();
+
     // -------------------------------------------------------------------------
     // -- Gather
     // -------------------------------------------------------------------------
@@ -352,6 +665,77 @@ public:
     template<typename T>
     all_gather_return_type<T> gather(T&& input) const;
 
+    /** @brief All gather, using the algorithm @p alg.
+     *
+     *  This is the same as gather(input), except that @p alg overrides the
+     *  choice of algorithm (see set_tuning). @p alg must be
+     *  the same on every process.
+     *
+     *  @tparam T The qualified type of the data to gather.
+     *
+     *  @param[in] input This process's contribution to the gather operation.
+     *  @param[in] alg   The algorithm to use.
+     *
+     *  @return The gathered data, see gather(input).
+     */
+    template<typename T>
+    all_gather_return_type<T> gather(T&& input, algorithm alg) const;
+
+    /** @brief Gathers into caller-provided storage on process @p root.
+     *
+     *  This is the same as gather(input, root) except that the gathered
+     *  elements are written to @p out instead of a newly allocated
+     *  container, which avoids the allocation when gathering in a loop.
+     *
+     *  @tparam T The qualified type of the data to gather. Must be a
+     *            contiguous container which does not need serialized.
+     *  @tparam U The type of the elements of @p out, must be the type of
+     *            the elements of @p T.
+     *
+     *  @param[in] input This process's contribution. Must be the same size
+     *                   on all processes.
+     *  @param[out] out Where the result goes. Only used on process @p root,
+     *                  where it must have at least `size() * input.size()`
+     *                  elements.
+     *  @param[in] root The rank of the process which will get all of the data.
+     *
+     *  @throw std::runtime_error if @p out is too small. Strong throw
+     *                            guarantee.
+     */
+    template<typename T, typename U>
+    void gather(T&& input, std::span<U> out, size_type root) const;
+
+    /** @brief All gather into caller-provided storage.
+     *
+     *  This is the same as gather(input, out, root) except that every
+     *  process gets the result (in its @p out).
+     *
+     *  @throw std::runtime_error if @p out is too small. Strong throw
+     *                            guarantee.
+     */
+    template<typename T, typename U>
+    void gather(T&& input, std::span<U> out) const;
+
+    /** @brief All gather where each process's contribution is already in
+     *         place in the result.
+     *
+     *  @p data is split into size() equally sized blocks. On entry, block
+     *  me() holds this process's contribution; on exit, block `r` holds
+     *  process `r`'s contribution. This wraps MPI_Allgather with
+     *  MPI_IN_PLACE, so no buffer besides @p data is needed (and the flat
+     *  algorithm is always used).
+     *
+     *  @tparam U The type of the elements, must be trivially copyable.
+     *
+     *  @param[in,out] data The result, with this process's block filled in.
+     *                      Must be the same size on every process.
+     *
+     *  @throw std::runtime_error if @p data can not be split into size()
+     *                            equally sized blocks. Strong throw guarantee.
+     */
+    template<typename U>
+    void gather_in_place(std::span<U> data) const;
+
     /** @brief Gathers arbitrary data to a MPI process @p root.
      *
      *  In a gather operation involving `N` processes, the data from each
@@ -425,13 +809,86 @@ public:
     template<typename T>
     all_gather_return_type<T> gatherv(T&& input) const;
 
+    /** @brief All gatherv, using the algorithm @p alg.
+     *
+     *  This is the same as gatherv(input), except that @p alg overrides the
+     *  choice of algorithm (see set_tuning). @p alg must be
+     *  the same on every process.
+     *
+     *  @tparam T The qualified type of the data to gather.
+     *
+     *  @param[in] input This process's contribution to the gather operation.
+     *  @param[in] alg   The algorithm to use.
+     *
+     *  @return The gathered data, see gatherv(input).
+     */
+    template<typename T>
+    all_gather_return_type<T> gatherv(T&& input, algorithm alg) const;
+
+    /// Type of per-process element counts or offsets (may exceed a size_type)
+    using index_container = std::vector<std::size_t>;
+
+    /** @brief Type returned by rooted gatherv_with_counts.
+     *
+     *  The tuple holds the gathered elements, how many elements came from
+     *  each process, and the index of each process's first element.
+     */
+    template<typename T>
+    using gatherv_counts_return_type =
+      std::optional<std::tuple<contiguous_result_t<std::decay_t<T>>,
+                               index_container, index_container>>;
+
+    /// Type returned by all gatherv_with_counts
+    template<typename T>
+    using all_gatherv_counts_return_type =
+      typename gatherv_counts_return_type<T>::value_type;
+
+    /** @brief Gatherv to process @p root, which also describes where each
+     *         process's elements ended up.
+     *
+     *  The elements are received directly into the returned container, so
+     *  process `r`'s elements can be used in place by slicing the result
+     *  with `counts[r]` and `offsets[r]` (e.g., with std::span).
+     *
+     *  @tparam T The qualified type of the data to gather. Must be a
+     *            contiguous container which does not need serialized.
+     *
+     *  @param[in] input This process's contribution. The number of elements
+     *                   can vary from rank to rank.
+     *  @param[in] root The rank of the process which will get all of the data.
+     *
+     *  @return A std::optional which only has a value on process @p root. See
+     *          gatherv_counts_return_type for its contents.
+     */
+    template<typename T>
+    gatherv_counts_return_type<T> gatherv_with_counts(T&& input,
+                                                      size_type root) const;
+
+    /** @brief All gatherv, which also describes where each process's elements
+     *         ended up.
+     *
+     *  This is the all gatherv version of gatherv_with_counts(input, root).
+     *
+     *  @tparam T The qualified type of the data to gather. Must be a
+     *            contiguous container which does not need serialized.
+     *
+     *  @param[in] input This process's contribution.
+     *
+     *  @return The gathered elements, the number of elements from each
+     *          process, and the index of each process's first element.
+     */
+    template<typename T>
+    all_gatherv_counts_return_type<T> gatherv_with_counts(T&& input) const;
+
     // -------------------------------------------------------------------------
     // -- Reduce
     // -------------------------------------------------------------------------
 
-    /// Type returned by rooted reduce
+    /// Type returned by rooted reduce (views are returned as a container
+    /// owning a copy of the elements)
     template<typename T>
-    using reduce_return_type = std::optional<std::decay_t<T>>;
+    using reduce_return_type =
+      std::optional<contiguous_owner_t<std::decay_t<T>>>;
 
     /// Type returned by all reduce
     template<typename T>
@@ -469,17 +926,24 @@ public:
      *
      *  @tparam T The qualified type of the array being reduced. @p T is assumed
      *            to possibly be a cv-qualified and/or reference to an object of
-     *            type U. U is assumed to be a contiguous container whose
-     *            elements map to a known MPI data type. If the elements are not
-     *            a known MPI data type, or if @p U needs to be serialized, a
-     *            static assert will be tripped.
+     *            type U. If U itself maps to a known MPI data type (a
+     *            scalar), the reduction is done by MPI without any heap
+     *            allocation (for built-in operations). If U is a contiguous
+     *            container whose elements map to a known MPI data type, the
+     *            reduction is done by MPI.
+     *            Otherwise (e.g., U needs to be serialized) the reduction is
+     *            done by a binomial tree of point-to-point messages, in which
+     *            @p fxn combines whole U objects if it can, and the elements
+     *            of U otherwise.
      *
      *  @tparam Fxn The qualified type of the reduction functor. @p Fxn is
      *              assumed to possibly be a cv-qualified and/or reference to a
-     *              functor. The functor is assumed to be an instantiation of
-     *              a functor in the C++ standard library that maps to a known
-     *              MPI operation, *e.g.*, std::plus. A static assert will be
-     *              raised if the functor does not map to a known MPI operation.
+     *              functor. If the functor maps to a known MPI operation,
+     *              *e.g.*, std::plus or minimum, that operation is used.
+     *              Otherwise the functor must be callable with two elements
+     *              and is registered with MPI as a non-commutative operation
+     *              for the duration of the call. To register a commutative
+     *              functor, pass it wrapped in a UserOp.
      *
      *  @param[in] input The array we are reducing.
      *  @param[in] fxn   The functor to use for the reduction.
@@ -525,17 +989,24 @@ public:
      *
      *  @tparam T The qualified type of the array being reduced. @p T is assumed
      *            to possibly be a cv-qualified and/or reference to an object of
-     *            type U. U is assumed to be a contiguous container whose
-     *            elements map to a known MPI data type. If the elements are not
-     *            a known MPI data type, or if @p U needs to be serialized, a
-     *            static assert will be tripped.
+     *            type U. If U itself maps to a known MPI data type (a
+     *            scalar), the reduction is done by MPI without any heap
+     *            allocation (for built-in operations). If U is a contiguous
+     *            container whose elements map to a known MPI data type, the
+     *            reduction is done by MPI.
+     *            Otherwise (e.g., U needs to be serialized) the reduction is
+     *            done by a binomial tree of point-to-point messages, in which
+     *            @p fxn combines whole U objects if it can, and the elements
+     *            of U otherwise.
      *
      *  @tparam Fxn The qualified type of the reduction functor. @p Fxn is
      *              assumed to possibly be a cv-qualified and/or reference to a
-     *              functor. The functor is assumed to be an instantiation of
-     *              a functor in the C++ standard library that maps to a known
-     *              MPI operation, *e.g.*, std::plus. A static assert will be
-     *              raised if the functor does not map to a known MPI operation.
+     *              functor. If the functor maps to a known MPI operation,
+     *              *e.g.*, std::plus or minimum, that operation is used.
+     *              Otherwise the functor must be callable with two elements
+     *              and is registered with MPI as a non-commutative operation
+     *              for the duration of the call. To register a commutative
+     *              functor, pass it wrapped in a UserOp.
      *
      *  @param[in] input The array we are reducing.
      *  @param[in] fxn   The functor to use for the reduction.
@@ -547,13 +1018,635 @@ public:
     template<typename T, typename Fxn>
     all_reduce_return_type<T> reduce(T&& input, Fxn&& fxn) const;
 
+    /** @brief Reduces an array into caller-provided storage on process
+     *         @p root.
+     *
+     *  This is the same as reduce(input, fxn, root) except that the result is
+     *  written to @p out instead of a newly allocated array, which avoids
+     *  the allocation when reducing in a loop.
+     *
+     *  @tparam T The qualified type of the array being reduced. Must be a
+     *            contiguous container whose elements map to an MPI data
+     *            type.
+     *  @tparam U The type of the elements of @p out, must be the type of
+     *            the elements of @p T.
+     *  @tparam Fxn The qualified type of the reduction functor, see
+     *              reduce(input, fxn, root).
+     *
+     *  @param[in] input The array we are reducing.
+     *  @param[out] out Where the result goes. Only used on process @p root,
+     *                  where it must have at least `input.size()` elements.
+     *  @param[in] fxn The functor to use for the reduction.
+     *  @param[in] root The zero-based rank of the process to collect the
+     *                  result on.
+     *
+     *  @throw std::runtime_error if @p out is too small. Strong throw
+     *                            guarantee.
+     */
+    template<typename T, typename U, typename Fxn>
+    void reduce(T&& input, std::span<U> out, Fxn&& fxn, size_type root) const;
+
+    /** @brief All reduce into caller-provided storage.
+     *
+     *  This is the same as reduce(input, out, fxn, root) except that every
+     *  process gets the result (in its @p out).
+     *
+     *  @throw std::runtime_error if @p out is too small. Strong throw
+     *                            guarantee.
+     */
+    template<typename T, typename U, typename Fxn>
+    void reduce(T&& input, std::span<U> out, Fxn&& fxn) const;
+
+    /** @brief All reduce which overwrites the input with the result.
+     *
+     *  This wraps MPI_Allreduce with MPI_IN_PLACE, so no buffer besides
+     *  @p data is needed.
+     *
+     *  @tparam U The type of the elements, must map to an MPI data type.
+     *  @tparam Fxn The qualified type of the reduction functor, see
+     *              reduce(input, fxn).
+     *
+     *  @param[in,out] data On input this process's array, on output the
+     *                      result. Must be the same size on every process.
+     *  @param[in] fxn The functor to use for the reduction.
+     */
+    template<typename U, typename Fxn>
+    void reduce_in_place(std::span<U> data, Fxn&& fxn) const;
+
+    // -------------------------------------------------------------------------
+    // -- Broadcast
+    // -------------------------------------------------------------------------
+
+    /// Type returned by broadcast given an object of type @p T (views are
+    /// returned as a container owning a copy of the elements)
+    template<typename T>
+    using broadcast_return_type = contiguous_owner_t<std::decay_t<T>>;
+
+    /** @brief Sends a copy of an object from process @p root to every
+     *         process.
+     *
+     *  In a broadcast operation, process @p root starts with an object and at
+     *  the end of the operation every process has a copy of that object. The
+     *  value of @p input is only read on process @p root; on all other
+     *  processes it is ignored and only serves to specify the type. Unlike
+     *  gather, the size of the object need not be known by the other processes
+     *  ahead of time.
+     *
+     *  If @p T needs to be serialized, process @p root serializes @p input and
+     *  broadcasts the number of bytes, followed by the bytes themselves. If
+     *  @p T does not need to be serialized (e.g., `std::vector<double>`), the
+     *  number of elements is broadcast, after which the elements are broadcast
+     *  directly into the result. Either way, this call is ultimately two
+     *  calls to MPI_Bcast.
+     *
+     *  @tparam T The qualified type of the object to broadcast.
+     *
+     *  @param[in] input The object to broadcast. Only the value on process
+     *                   @p root is used.
+     *  @param[in] root  The rank of the process which has the object.
+     *
+     *  @return A copy of the object which was on process @p root. On process
+     *          @p root this is @p input (moved if @p input is an rvalue).
+     */
+    template<typename T>
+    broadcast_return_type<T> broadcast(T&& input, size_type root) const;
+
+    // -------------------------------------------------------------------------
+    // -- Scatter
+    // -------------------------------------------------------------------------
+
+    /** @brief Type each process gets back from scattering an object of type
+     *         @p T.
+     *
+     *  Scatter is the inverse of gather. If @p T needs to be serialized
+     *  (e.g., `std::vector<std::string>`), each process gets one of its
+     *  elements. If @p T does not need to be serialized (e.g.,
+     *  `std::vector<double>`), each process gets a contiguous chunk of it,
+     *  i.e., another object of type @p T (or a std::vector if @p T can't be
+     *  resized, see contiguous_result_t).
+     */
+    template<typename T>
+    using scatter_return_type =
+      std::conditional_t<needs_serialized_v<std::decay_t<T>>,
+                         typename std::decay_t<T>::value_type,
+                         contiguous_result_t<std::decay_t<T>>>;
+
+    /// Type used to specify how many elements each process gets
+    using count_container = std::vector<size_type>;
+
+    /** @brief Splits up an object on process @p root and sends one piece to
+     *         each process.
+     *
+     *  In a scatter operation involving `N` processes, process @p root starts
+     *  with a container. The container is split into `N` pieces and the
+     *  `i`-th piece is sent to the process with rank `i`. The value of
+     *  @p input is only read on process @p root; on all other processes it is
+     *  ignored and only serves to specify the type.
+     *
+     *  If @p T needs to be serialized, @p input must have exactly `N`
+     *  elements, each is serialized on @p root, and process `i` gets back
+     *  element `i`. The elements need not serialize to the same number of
+     *  bytes. If @p T does not need to be serialized, the number of elements
+     *  in @p input must be divisible by `N`, and process `i` gets back
+     *  elements `i * n` through `(i + 1) * n`, where `n` is the number of
+     *  elements divided by `N`. The elements are received directly into the
+     *  result.
+     *
+     *  This call is ultimately equivalent to calling MPI_Scatter (or
+     *  MPI_Scatterv if @p T needs to be serialized).
+     *
+     *  @tparam T The qualified type of the container to scatter.
+     *
+     *  @param[in] input The container to split up. Only the value on process
+     *                   @p root is used.
+     *  @param[in] root  The rank of the process which has the container.
+     *
+     *  @return This process's piece of @p input.
+     *
+     *  @throw std::runtime_error if, on process @p root, @p input can not be
+     *                            split evenly.
+     */
+    template<typename T>
+    scatter_return_type<T> scatter(T&& input, size_type root) const;
+
+    /** @brief Scatters an object whose pieces may differ in size.
+     *
+     *  This method behaves like scatter except that, if @p T does not need to
+     *  be serialized, the number of elements in @p input need not be
+     *  divisible by the number of processes. Instead the elements are split
+     *  as evenly as possible, with the first `n % N` processes getting one
+     *  extra element. If @p T needs to be serialized, this is the same as
+     *  scatter.
+     *
+     *  This call is ultimately equivalent to calling MPI_Scatterv.
+     *
+     *  @tparam T The qualified type of the container to scatter.
+     *
+     *  @param[in] input The container to split up. Only the value on process
+     *                   @p root is used.
+     *  @param[in] root  The rank of the process which has the container.
+     *
+     *  @return This process's piece of @p input.
+     */
+    template<typename T>
+    scatter_return_type<T> scatterv(T&& input, size_type root) const;
+
+    /** @brief Scatters a contiguous container using the provided counts.
+     *
+     *  Like scatterv(input, root), except the caller decides how many
+     *  elements each process gets. Process `i` gets @p counts[i] elements,
+     *  starting right after the elements given to process `i - 1`. This
+     *  overload is only available if @p T does not need to be serialized.
+     *
+     *  @tparam T The qualified type of the container to scatter.
+     *
+     *  @param[in] input  The container to split up. Only the value on process
+     *                    @p root is used.
+     *  @param[in] counts How many elements each process gets. Only the value
+     *                    on process @p root is used.
+     *  @param[in] root   The rank of the process which has the container.
+     *
+     *  @return This process's piece of @p input.
+     *
+     *  @throw std::runtime_error if, on process @p root, @p counts does not
+     *                            have an entry for every process, or if
+     *                            @p input has fewer elements than requested.
+     */
+    template<typename T>
+    scatter_return_type<T> scatterv(T&& input, const count_container& counts,
+                                    size_type root) const;
+
+    // -------------------------------------------------------------------------
+    // -- All-to-All
+    // -------------------------------------------------------------------------
+
+    /** @brief Type each process gets back from calling alltoall with an
+     *         object of type @p T.
+     *
+     *  If @p T needs to be serialized (e.g., `std::vector<std::string>`), each
+     *  process gets a `std::vector` with one element from each process. If
+     *  @p T does not need to be serialized (e.g., `std::vector<double>`), each
+     *  process gets another object of type @p T (or a std::vector if @p T
+     *  can't be resized, see contiguous_result_t).
+     */
+    template<typename T>
+    using alltoall_return_type =
+      std::conditional_t<needs_serialized_v<std::decay_t<T>>,
+                         std::vector<typename std::decay_t<T>::value_type>,
+                         contiguous_result_t<std::decay_t<T>>>;
+
+    /// Type returned by alltoallv, the data and how much came from each rank
+    template<typename T>
+    using alltoallv_return_type =
+      std::pair<contiguous_result_t<std::decay_t<T>>, count_container>;
+
+    /** @brief Every process sends a different piece of an object to every
+     *         other process.
+     *
+     *  In an all-to-all operation involving `N` processes, each process
+     *  starts with a container holding one piece per process. Piece `j` on
+     *  process `i` is sent to process `j`, where it becomes piece `i` of the
+     *  result. This is a transpose of the data among the processes, and takes
+     *  a single collective instead of `N` gathers.
+     *
+     *  If @p T needs to be serialized, @p input must have exactly `N`
+     *  elements, which need not be the same size (e.g.,
+     *  `std::vector<std::vector<double>>`). The byte count of each piece is
+     *  exchanged first, then the pieces are packed back-to-back into a single
+     *  buffer and exchanged with one call to MPI_Alltoallv. Pieces which are
+     *  contiguous containers are copied into the buffer as-is, rather than
+     *  serialized.
+     *
+     *  If @p T does not need to be serialized, the number of elements in
+     *  @p input must be divisible by `N` and the same on every process. The
+     *  `i`-th group of `input.size() / N` elements is sent to process `i`.
+     *  After an all reduce checking that the sizes agree, the elements are
+     *  exchanged with one call to MPI_Alltoall, directly into the result.
+     *
+     *  @tparam T The qualified type of the container to exchange.
+     *
+     *  @param[in] input The pieces to send to each process.
+     *
+     *  @return The pieces received from each process, in rank order.
+     *
+     *  @throw std::runtime_error if @p T needs to be serialized and @p input
+     *                            does not have one element per process on
+     *                            some process, or if @p T does not need to be
+     *                            serialized and @p input can not be split
+     *                            evenly or has a different size on some
+     *                            process. All processes throw.
+     */
+    template<typename T>
+    alltoall_return_type<T> alltoall(T&& input) const;
+
+    /** @brief All-to-all exchange of a contiguous container where the pieces
+     *         can be different sizes.
+     *
+     *  Process `i` sends @p counts[j] elements to process `j`, starting
+     *  right after the elements sent to process `j - 1`. The counts are
+     *  exchanged first (with MPI_Alltoall), so the receiving processes do not
+     *  need to know them. The elements are then exchanged with one call to
+     *  MPI_Alltoallv, directly into the result. This overload is only
+     *  available if @p T does not need to be serialized.
+     *
+     *  @tparam T The qualified type of the container to exchange.
+     *
+     *  @param[in] input  The elements to send.
+     *  @param[in] counts How many elements each process gets.
+     *
+     *  @return A pair whose first element is the elements received from all
+     *          processes, in rank order, and whose second element is how
+     *          many of those elements came from each process.
+     *
+     *  @throw std::runtime_error if, on any process, @p counts does not have
+     *                            an entry for every process, or if @p input
+     *                            has fewer elements than requested. All
+     *                            processes throw.
+     */
+    template<typename T>
+    alltoallv_return_type<T> alltoallv(T&& input,
+                                       const count_container& counts) const;
+
+    // -------------------------------------------------------------------------
+    // -- Nonblocking Collectives
+    // -------------------------------------------------------------------------
+
+    /// Type of a future which resolves to an object of type @p T
+    template<typename T>
+    using future_type = CommPPFuture<T>;
+
+    /** @brief Nonblocking version of gather(input, root).
+     *
+     *  This method serializes @p input (if needed), starts an MPI_Igather, and
+     *  returns right away. The returned future owns the send and receive
+     *  buffers, so @p input may be modified or destroyed as soon as this
+     *  method returns. Deserialization of the gathered data is deferred until
+     *  get() is called on the returned future.
+     *
+     *  Like all MPI collectives, every process must call this method, and
+     *  nonblocking collectives must be started in the same order on every
+     *  process.
+     *
+     *  @tparam T The qualified type of the data to gather.
+     *
+     *  @param[in] input This process's contribution to the gather. The size
+     *                   of @p input (in bytes) must be the same on all ranks.
+     *  @param[in] root  The rank of the process which will get all the data.
+     *
+     *  @return A future which resolves to what gather(input, root) returns.
+     */
+    template<typename T>
+    future_type<gather_return_type<T>> igather(T&& input, size_type root) const;
+
+    /** @brief Nonblocking version of gather(input).
+     *
+     *  See igather(input, root) for details. This call is ultimately
+     *  equivalent to MPI_Iallgather.
+     *
+     *  @tparam T The qualified type of the data to gather.
+     *
+     *  @param[in] input This process's contribution to the gather. The size
+     *                   of @p input (in bytes) must be the same on all ranks.
+     *
+     *  @return A future which resolves to what gather(input) returns.
+     */
+    template<typename T>
+    future_type<all_gather_return_type<T>> igather(T&& input) const;
+
+    /** @brief Nonblocking version of gatherv(input, root).
+     *
+     *  The number of bytes each process sends is exchanged with a (small)
+     *  blocking gather before the data itself is moved with MPI_Igatherv.
+     *  Doing the size exchange eagerly guarantees that every process starts
+     *  the MPI_Igatherv in the same order relative to other collectives. Aside
+     *  from that, this method behaves like igather(input, root).
+     *
+     *  @tparam T The qualified type of the data to gather.
+     *
+     *  @param[in] input This process's contribution to the gather. The size
+     *                   of @p input (in bytes) may vary from rank to rank.
+     *  @param[in] root  The rank of the process which will get all the data.
+     *
+     *  @return A future which resolves to what gatherv(input, root) returns.
+     */
+    template<typename T>
+    future_type<gather_return_type<T>> igatherv(T&& input,
+                                                size_type root) const;
+
+    /** @brief Nonblocking version of gatherv(input).
+     *
+     *  See igatherv(input, root) for details. This call is ultimately
+     *  equivalent to MPI_Iallgatherv.
+     *
+     *  @tparam T The qualified type of the data to gather.
+     *
+     *  @param[in] input This process's contribution to the gather. The size
+     *                   of @p input (in bytes) may vary from rank to rank.
+     *
+     *  @return A future which resolves to what gatherv(input) returns.
+     */
+    template<typename T>
+    future_type<all_gather_return_type<T>> igatherv(T&& input) const;
+
+    /** @brief Nonblocking version of reduce(input, fxn, root).
+     *
+     *  This method starts an MPI_Ireduce and returns right away. The returned
+     *  future owns a copy of @p input (moved in if @p input is an rvalue) and
+     *  the result buffer. The same restrictions on @p T and @p Fxn as reduce
+     *  apply.
+     *
+     *  @tparam T The qualified type of the array being reduced.
+     *  @tparam Fxn The qualified type of the reduction functor.
+     *
+     *  @param[in] input The array we are reducing.
+     *  @param[in] fxn   The functor to use for the reduction.
+     *  @param[in] root  The rank of the process to collect the result on.
+     *
+     *  @return A future which resolves to what reduce(input, fxn, root)
+     *          returns.
+     *
+     *  @throw std::runtime_error if @p input has more than INT_MAX elements.
+     *                            Strong throw guarantee.
+     */
+    template<typename T, typename Fxn>
+    future_type<reduce_return_type<T>> ireduce(T&& input, Fxn&& fxn,
+                                               size_type root) const;
+
+    /** @brief Nonblocking version of reduce(input, fxn).
+     *
+     *  See ireduce(input, fxn, root) for details. This call is ultimately
+     *  equivalent to MPI_Iallreduce.
+     *
+     *  @tparam T The qualified type of the array being reduced.
+     *  @tparam Fxn The qualified type of the reduction functor.
+     *
+     *  @param[in] input The array we are reducing.
+     *  @param[in] fxn   The functor to use for the reduction.
+     *
+     *  @return A future which resolves to what reduce(input, fxn) returns.
+     */
+    template<typename T, typename Fxn>
+    future_type<all_reduce_return_type<T>> ireduce(T&& input, Fxn&& fxn) const;
+
+    // -------------------------------------------------------------------------
+    // -- Persistent Collectives
+    // -------------------------------------------------------------------------
+
+    /// Type of a callable registered as an MPI operation on @p T objects
+    template<typename T>
+    using user_op_type = UserOp<T>;
+
+    /// Type of a reusable reduction of objects of type @p T
+    template<typename T>
+    using persistent_reduction_type = PersistentReduction<T>;
+
+    /** @brief Sets up a reduction which can be run many times.
+     *
+     *  When the same number of elements is reduced with the same operation
+     *  over and over (e.g., once per iteration of a solver), the returned
+     *  object avoids redoing the setup of reduce each time. See
+     *  PersistentReduction for how to use it. Only process @p root gets the
+     *  result.
+     *
+     *  This is a collective call. Every process must call it, with the same
+     *  @p n_elems, @p fxn and @p root, in the same order relative to the
+     *  other persistent collectives.
+     *
+     *  @tparam T The type of the elements being reduced. Unlike reduce, @p T
+     *            is the element type, not the container type. Must have an
+     *            MPI datatype.
+     *  @tparam Fxn The qualified type of the reduction functor. Must have an
+     *              MPI operation.
+     *
+     *  @param[in] n_elems The number of elements being reduced.
+     *  @param[in] fxn     The functor to use for the reduction.
+     *  @param[in] root    The rank of the process to collect the result on.
+     *
+     *  @return The reusable reduction.
+     *
+     *  @throw std::bad_alloc if allocating the buffers fails. Strong throw
+     *                        guarantee.
+     */
+    template<typename T, typename Fxn>
+    persistent_reduction_type<T> persistent_reduce(std::size_t n_elems,
+                                                   Fxn&& fxn,
+                                                   size_type root) const;
+
+    /** @brief Sets up an all reduce which can be run many times.
+     *
+     *  See persistent_reduce(n_elems, fxn, root) for details. Reductions
+     *  made by this overload give every process the result.
+     *
+     *  @tparam T The type of the elements being reduced.
+     *  @tparam Fxn The qualified type of the reduction functor.
+     *
+     *  @param[in] n_elems The number of elements being reduced.
+     *  @param[in] fxn     The functor to use for the reduction.
+     *
+     *  @return The reusable reduction.
+     *
+     *  @throw std::bad_alloc if allocating the buffers fails. Strong throw
+     *                        guarantee.
+     */
+    template<typename T, typename Fxn>
+    persistent_reduction_type<T> persistent_reduce(std::size_t n_elems,
+                                                   Fxn&& fxn) const;
+
+    // -------------------------------------------------------------------------
+    // -- Point-to-Point
+    // -------------------------------------------------------------------------
+
+    /** @brief Maps a string tag to an integer tag.
+     *
+     *  MPI tags are integers, but strings are far easier to keep unique in a
+     *  large code base. This method deterministically maps @p name to an
+     *  integer tag (valid for the communicator wrapped by *this), so every
+     *  process gets the same tag for the same name without communicating.
+     *  The mapping is stored in a registry shared by all copies of *this. If
+     *  two different names map to the same tag an error is raised, rather
+     *  than letting the messages be silently mixed up.
+     *
+     *  @param[in] name The string tag.
+     *
+     *  @return The integer tag for @p name.
+     *
+     *  @throw std::runtime_error if *this has no PIMPL or if @p name collides
+     *                            with a previously registered name. Strong
+     *                            throw guarantee.
+     */
+    tag_type tag(const std::string& name) const;
+
+    /** @brief Sends an object to process @p dest.
+     *
+     *  If @p T needs to be serialized, @p input is serialized and the bytes
+     *  are sent, otherwise the elements of @p input are sent directly. The
+     *  receiving process does not need to know the size of @p input, it is
+     *  determined when the message is received (see recv).
+     *
+     *  This call is ultimately a call to MPI_Send.
+     *
+     *  @tparam T The qualified type of the object to send.
+     *
+     *  @param[in] input The object to send.
+     *  @param[in] dest  The rank of the process to send @p input to.
+     *  @param[in] tag   The tag of the message. Default is 0.
+     */
+    template<typename T>
+    void send(T&& input, size_type dest, tag_type tag = 0) const;
+
+    /** @brief Receives an object sent from process @p source.
+     *
+     *  Receiving an object of unknown size is done by matching the message
+     *  with MPI_Mprobe, allocating a buffer large enough for it, and then
+     *  receiving the message with MPI_Mrecv. Unlike MPI_Probe/MPI_Recv, this
+     *  is thread-safe since the matched message can not be received by any
+     *  other call. If @p T does not need to be serialized the elements are
+     *  received directly into the result.
+     *
+     *  @tparam T The unqualified type of the object to receive. Must be the
+     *            type sent by @p source.
+     *
+     *  @param[in] source The rank of the process which sent the object.
+     *  @param[in] tag    The tag of the message. Default is 0.
+     *
+     *  @return The received object.
+     */
+    template<typename T>
+    T recv(size_type source, tag_type tag = 0) const;
+
+    /** @brief Nonblocking analog of send.
+     *
+     *  The returned future owns the buffer being sent. Calling get() (or
+     *  wait()) on it ensures the send has completed.
+     *
+     *  @tparam T The qualified type of the object to send.
+     *
+     *  @param[in] input The object to send. Rvalue containers which do not
+     *                   need to be serialized are moved into the future.
+     *  @param[in] dest  The rank of the process to send @p input to.
+     *  @param[in] tag   The tag of the message. Default is 0.
+     *
+     *  @return A future which tracks the send.
+     */
+    template<typename T>
+    future_type<void> isend(T&& input, size_type dest, tag_type tag = 0) const;
+
+    /** @brief Nonblocking analog of recv.
+     *
+     *  The size of the message is not known until it arrives, so the receive
+     *  can not be posted right away. Instead the returned future probes for
+     *  the message (with MPI_Improbe) each time ready() is called, and posts
+     *  the receive (MPI_Imrecv) once the message has been matched. Calling
+     *  get() (or wait()) blocks until the message is matched and received.
+     *
+     *  @note Since matching happens when the future is first polled, not when
+     *        irecv is called, futures receiving from the same @p source with
+     *        the same @p tag get the messages in the order they are polled.
+     *
+     *  @tparam T The unqualified type of the object to receive.
+     *
+     *  @param[in] source The rank of the process which sent the object.
+     *  @param[in] tag    The tag of the message. Default is 0.
+     *
+     *  @return A future which resolves to the received object.
+     */
+    template<typename T>
+    future_type<T> irecv(size_type source, tag_type tag = 0) const;
+
+    // -------------------------------------------------------------------------
+    // -- One-Sided Communication
+    // -------------------------------------------------------------------------
+
+    /** @brief Allocates memory which other processes can access directly.
+     *
+     *  Each process allocates @p n_bytes (zero-initialized) and exposes them
+     *  through the returned window, after which any process can put, get,
+     *  and accumulate into any other process's memory without the other
+     *  process taking part. See RMAWindow for details. The memory is freed
+     *  along with the window.
+     *
+     *  This wraps MPI_Win_allocate, which lets the MPI library pick memory
+     *  it can access efficiently (e.g., registered with the network). It is
+     *  a collective call, every process must make it, but @p n_bytes may
+     *  differ from process to process (including being 0).
+     *
+     *  @param[in] n_bytes The size of this process's region.
+     *
+     *  @return The window.
+     *
+     *  @throw std::runtime_error if *this has no PIMPL. Strong throw
+     *                            guarantee.
+     */
+    window_type allocate_window(std::size_t n_bytes) const;
+
+    /** @brief Lets other processes access existing memory directly.
+     *
+     *  This is the same as allocate_window except that the memory is
+     *  provided by the caller (and must outlive the returned window). This
+     *  wraps MPI_Win_create and is a collective call.
+     *
+     *  @param[in] region This process's region. May be empty.
+     *
+     *  @return The window.
+     *
+     *  @throw std::runtime_error if *this has no PIMPL. Strong throw
+     *                            guarantee.
+     */
+    window_type expose_window(binary_reference region) const;
+
 private:
+    /// Creates a CommPP which is implemented by @p pimpl
+    explicit CommPP(pimpl_pointer pimpl) noexcept;
+
     /// Code factorization for determining if m_pimpl_ is not null
     bool has_pimpl_() const noexcept;
 
     /// if has_pimpl_() then returns the PIMPL, otherwise throws.
     const pimpl_type& pimpl_() const;
 
+    /// if has_pimpl_() then returns the PIMPL, otherwise throws.
+    pimpl_type& pimpl_();
+
     /// Type used to make passing the root parameter optional
     using opt_root_t = std::optional<size_type>;
 
@@ -570,32 +1663,307 @@ private:
      *                  unset for all gather calls.
      */
     template<typename T>
-    gather_return_type<T> gather_t_(T&& input, opt_root_t r) const;
+    gather_return_type<T> gather_t_(
+      T&& input, opt_root_t r, algorithm alg = algorithm::automatic) const;
 
-    /// Code factorization for the two public templated gatherv methods.
+    /// Code factorization for the public templated gatherv methods.
     template<typename T>
-    gather_return_type<T> gatherv_t_(T&& input, opt_root_t r) const;
+    gather_return_type<T> gatherv_t_(
+      T&& input, opt_root_t r, algorithm alg = algorithm::automatic) const;
 
     /// Code factorization for the two public template reduce methods
     template<typename T, typename Fxn>
     reduce_return_type<T> reduce_t_(T&& input, Fxn&& fxn,
                                     opt_root_t root) const;
 
+    /// Reduces @p n elements from @p send into @p recv (all reduce if no root)
+    template<typename U, typename Fxn>
+    void reduce_into_(const void* send, U* recv, std::size_t n, Fxn&& fxn,
+                      opt_root_t root) const;
+
+    /// Code factorization for the reduce overloads taking a span
+    template<typename T, typename U, typename Fxn>
+    void reduce_span_(T&& input, std::span<U> out, Fxn&& fxn,
+                      opt_root_t root) const;
+
+    /// Code factorization for the gather overloads taking a span
+    template<typename T, typename U>
+    void gather_span_(T&& input, std::span<U> out, opt_root_t root) const;
+
+    /// Implements reduce_t_ for containers of MPI datatypes, via MPI_Reduce
+    template<typename T, typename Fxn>
+    reduce_return_type<T> reduce_mpi_(T&& input, Fxn&& fxn,
+                                      opt_root_t root) const;
+
+    /** @brief Implements reduce_t_ for objects without an MPI datatype.
+     *
+     *  The objects are combined by a binomial tree: in round @f$k@f$ each
+     *  remaining process with bit @f$k@f$ of its rank set sends its partial
+     *  result to the process @f$2^k@f$ ranks below it, which receives it,
+     *  combines it with its own partial result, and moves on to the next
+     *  round. After @f$\lceil\log_2 P\rceil@f$ rounds rank 0 has the
+     *  result, which is then sent to @p root (or broadcast to everyone).
+     *  Each process only holds its partial result and the one it receives,
+     *  and the order of the ranks is preserved, so @p fxn need not be
+     *  commutative.
+     *
+     *  @param[in] input The local object.
+     *  @param[in] fxn   Combines two objects, or two of their elements (see
+     *                   combine_).
+     *  @param[in] root  The process to collect the result on, everyone if
+     *                   not set.
+     *
+     *  @return The same as reduce_t_.
+     */
+    template<typename T, typename Fxn>
+    reduce_return_type<T> reduce_tree_(T&& input, Fxn&& fxn,
+                                       opt_root_t root) const;
+
+    /** @brief Combines two objects in a tree reduction.
+     *
+     *  If @p fxn can be called with two T objects, the result is
+     *  `fxn(lhs, rhs)`. Otherwise @p T is assumed to be a container and
+     *  @p fxn is applied element-wise.
+     *
+     *  @throw std::runtime_error if @p fxn is applied element-wise and
+     *                            @p lhs and @p rhs have different sizes.
+     *                            Strong throw guarantee.
+     */
+    template<typename T, typename Fxn>
+    static T combine_(const T& lhs, const T& rhs, Fxn&& fxn);
+
+    /// Code factorization for the two public templated igather methods
+    template<typename T>
+    future_type<gather_return_type<T>> igather_t_(T&& input,
+                                                  opt_root_t r) const;
+
+    /// Code factorization for the two public templated igatherv methods
+    template<typename T>
+    future_type<gather_return_type<T>> igatherv_t_(T&& input,
+                                                   opt_root_t r) const;
+
+    /// Code factorization for the two public templated ireduce methods
+    template<typename T, typename Fxn>
+    future_type<reduce_return_type<T>> ireduce_t_(T&& input, Fxn&& fxn,
+                                                  opt_root_t root) const;
+
+    /// Code factorization for the two public persistent_reduce methods
+    template<typename T, typename Fxn>
+    persistent_reduction_type<T> persistent_reduce_t_(std::size_t n_elems,
+                                                      Fxn&& fxn,
+                                                      opt_root_t root) const;
+
+    /** @brief Works out the MPI datatype and operation for reducing with
+     *         @p fxn.
+     *
+     *  @tparam T The type of the elements being reduced.
+     *  @tparam Fxn The qualified type of the reduction functor.
+     *
+     *  @param[in] fxn The reduction functor.
+     *
+     *  @return A tuple of the datatype, the operation, and the UserOp which
+     *          owns them. If @p fxn maps to a built-in MPI operation the
+     *          UserOp is not valid().
+     */
+    template<typename T, typename Fxn>
+    static auto reduce_op_(Fxn&& fxn);
+
+    /** @brief Packs the elements of @p input back-to-back into one buffer.
+     *
+     *  Elements which need to be serialized are serialized (each with its own
+     *  archive, so each can be read on its own), the others are copied as-is.
+     *  The size of each element in the buffer is appended to @p sizes, and
+     *  its offset to @p disp.
+     */
+    template<typename T>
+    static binary_type pack_(const T& input, byte_count_container& sizes,
+                             byte_offset_container& disp);
+
+    /// Computes the displacements of back-to-back blocks of size @p sizes
+    static byte_offset_container displacements_(
+      const byte_count_container& sizes);
+
+    /// Type of the buffer point-to-point operations receive a @p T into
+    template<typename T>
+    using p2p_buffer_type = std::conditional_t<needs_serialized_v<T>,
+                                               binary_type,
+                                               contiguous_result_t<T>>;
+
+    /// Allocates a buffer for receiving a @p T which is @p n_bytes long
+    template<typename T>
+    static p2p_buffer_type<T> make_p2p_buffer_(std::size_t n_bytes);
+
+    /// Converts a buffer filled by a point-to-point receive into a @p T
+    template<typename T>
+    static T from_p2p_buffer_(p2p_buffer_type<T>&& buffer);
+
+    /// Makes a buffer which owns (a copy of) @p input's bytes
+    template<typename T>
+    static binary_type make_owning_buffer_(T&& input);
+
+    /// Views the elements of the contiguous container @p input as bytes
+    template<typename T>
+    static const_binary_reference input_view_(const T& input);
+
+    /// Views the elements of the contiguous container @p output as bytes
+    template<typename T>
+    static binary_reference output_view_(T& output);
+
+    /// Deserializes @p n equally sized objects of type @p T from @p buffer
+    template<typename T>
+    static std::vector<T> unpack_(const_binary_reference buffer, size_type n);
+
+    /// Deserializes objects of type @p T, the i-th is @p sizes[i] bytes long
+    template<typename T>
+    static std::vector<T> unpack_(const_binary_reference buffer,
+                                  const byte_count_container& sizes);
+
     // -------------------------------------------------------------------------
     // -- Binary-Based MPI Operations
     // -------------------------------------------------------------------------
 
-    /// Wraps a call to m_pimpl_->gather(data, root)
-    binary_gather_return gather_(const_binary_reference data,
-                                 opt_root_t root) const;
+    /// Wraps a call to m_pimpl_->gather(data, root, alg)
+    binary_gather_return gather_(const_binary_reference data, opt_root_t root,
+                                 algorithm alg = algorithm::automatic) const;
 
-    /// Wraps a call to m_pimpl_->gather(in_data, out_buffer, root)
+    /// Wraps a call to m_pimpl_->gather(in_data, out_buffer, root, alg)
     void gather_(const_binary_reference in_data, binary_reference out_buffer,
-                 opt_root_t root) const;
+                 opt_root_t root, algorithm alg = algorithm::automatic) const;
+
+    /// Wraps a call to m_pimpl_->gather_in_place(data)
+    void gather_in_place_(binary_reference data) const;
+
+    /// Wraps a call to m_pimpl_->gatherv(in_data, root, alg);
+    binary_gatherv_return gatherv_(
+      const_binary_reference data, opt_root_t root,
+      algorithm alg = algorithm::automatic) const;
+
+    /// Wraps a call to m_pimpl_->gatherv(in_data, out_buffer, sizes, ...)
+    void gatherv_(const_binary_reference in_data, binary_reference out_buffer,
+                  const byte_count_container& sizes,
+                  const byte_offset_container& displacements, opt_root_t root,
+                  algorithm alg = algorithm::automatic) const;
+
+    /// Code factorization for the gatherv_with_counts methods
+    template<typename T>
+    gatherv_counts_return_type<T> gatherv_counts_t_(T&& input,
+                                                    opt_root_t root) const;
+
+    /** @brief Gathers the elements of contiguous containers directly into
+     *         a container of type @p T.
+     *
+     *  @return On the processes getting the result, the gathered container
+     *          and the number of bytes from each process.
+     */
+    template<typename T>
+    std::optional<std::pair<T, byte_count_container>> gatherv_contiguous_(
+      const_binary_reference in_data, opt_root_t root, algorithm alg) const;
+
+    /// Wraps a call to m_pimpl_->broadcast(data, root)
+    void broadcast_(binary_reference data, size_type root) const;
+
+    /// Type of the clock used to time (de)serialization
+    using clock_type = std::chrono::high_resolution_clock;
+
+    /// Records the time since @p start as serialization time of @p op
+    void serialized_(const char* op, clock_type::time_point start) const;
+
+    /// Wraps a call to m_pimpl_->reduce(send, recv, n_elems, type, op, root)
+    void reduce_(const void* send, void* recv, int n_elems, MPI_Datatype type,
+                 MPI_Op op, opt_root_t root) const;
+
+    /// Wraps a call to m_pimpl_->ireduce(send, recv, n_elems, type, op, root)
+    request_type ireduce_(const void* send, void* recv, int n_elems,
+                          MPI_Datatype type, MPI_Op op, opt_root_t root) const;
+
+    /// Is compression turned on (per m_pimpl_->compressing())?
+    bool compressing_() const;
+
+    /// Wraps a call to m_pimpl_->compress(data)
+    binary_type compress_(const_binary_reference data) const;
+
+    /// Wraps a call to m_pimpl_->decompress(data)
+    binary_type decompress_(const_binary_reference data) const;
+
+    /** @brief Deserializes back-to-back objects of type @p T, where the
+     *         `i`-th object is @p sizes[i] bytes long.
+     *
+     *  Unlike unpack_, this decompresses each object first if compression
+     *  is on.
+     */
+    template<typename T>
+    std::vector<T> unpack_blocks_(const_binary_reference buffer,
+                                  const byte_count_container& sizes) const;
+
+    /// Wraps a call to m_pimpl_->scatter(data, out_buffer, root)
+    void scatter_(const_binary_reference data, binary_reference out_buffer,
+                  size_type root) const;
+
+    /// Wraps a call to m_pimpl_->scatterv(data, sizes, displacements, ...)
+    void scatterv_(const_binary_reference data,
+                   const byte_count_container& sizes,
+                   const byte_offset_container& displacements,
+                   binary_reference out_buffer, size_type root) const;
+
+    /// Broadcasts the byte count of every process from @p root
+    byte_count_container broadcast_sizes_(byte_count_container sizes,
+                                          size_type root) const;
+
+    /// Implements scatterv given per-process counts (in elements) on root
+    template<typename T>
+    scatter_return_type<T> scatterv_t_(T&& input,
+                                       const count_container& counts,
+                                       size_type root) const;
+
+    /// Implements scatter/scatterv for types which need serialized
+    template<typename T>
+    scatter_return_type<T> scatter_serialized_(T&& input,
+                                               size_type root) const;
+
+    /// Wraps a call to m_pimpl_->alltoall(data, out_buffer)
+    void alltoall_(const_binary_reference data,
+                   binary_reference out_buffer) const;
+
+    /// Wraps a call to m_pimpl_->alltoallv(data, sizes, displacements, ...)
+    void alltoallv_(const_binary_reference data,
+                    const byte_count_container& sizes,
+                    const byte_offset_container& displacements,
+                    binary_reference out_buffer,
+                    const byte_count_container& out_sizes,
+                    const byte_offset_container& out_displacements) const;
+
+    /// Exchanges per-process byte counts, returns the counts received
+    byte_count_container alltoall_sizes_(
+      const byte_count_container& sizes) const;
+
+    /// Wraps a call to m_pimpl_->igather(in_data, out_buffer, root)
+    request_type igather_(const_binary_reference in_data,
+                          binary_reference out_buffer, opt_root_t root) const;
+
+    /// Wraps a call to m_pimpl_->igatherv(in_data, out_buffer, sizes, ...)
+    request_type igatherv_(const_binary_reference in_data,
+                           binary_reference out_buffer,
+                           const byte_count_container& sizes,
+                           const byte_offset_container& displacements,
+                           opt_root_t root,
+                           std::shared_ptr<const void>& keep_alive) const;
+
+    /// Wraps a call to m_pimpl_->send(data, dest, tag)
+    void send_(const_binary_reference data, size_type dest, tag_type tag) const;
+
+    /// Wraps a call to m_pimpl_->isend(data, dest, tag)
+    request_type isend_(const_binary_reference data, size_type dest,
+                        tag_type tag) const;
+
+    /// Wraps a call to m_pimpl_->probe(source, tag, block)
+    probe_return probe_(size_type source, tag_type tag, bool block) const;
+
+    /// Wraps a call to m_pimpl_->recv(message, out_buffer)
+    void recv_(message_type& message, binary_reference out_buffer) const;
 
-    /// Wraps a call to m_pimpl_->gatherv(in_data, root);
-    binary_gatherv_return gatherv_(const_binary_reference data,
-                                   opt_root_t root) const;
+    /// Wraps a call to m_pimpl_->irecv(message, out_buffer)
+    request_type irecv_(message_type& message,
+                        binary_reference out_buffer) const;
 
     /// The object actually implementing *this
     pimpl_pointer m_pimpl_;
@@ -15,6 +15,10 @@
  */
 
 #pragma once
+#include <algorithm>
+#include <limits>
+#include <ostream>
+#include <span>
 #include <parallelzone/mpi_helpers/traits/mpi_data_type.hpp>
 #include <parallelzone/mpi_helpers/traits/mpi_op.hpp>
 
@@ -37,6 +41,33 @@ typename CommPP::all_gather_return_type<T> CommPP::gather(T&& input) const {
     return *gather_t_(std::forward<T>(input), std::nullopt);
 }
 
+template<typename T>
+typename CommPP::all_gather_return_type<T> CommPP::gather(
+  T&& input, algorithm alg) const {
+    return *gather_t_(std::forward<T>(input), std::nullopt, alg);
+}
+
+template<typename T, typename U>
+void CommPP::gather(T&& input, std::span<U> out, size_type root) const {
+    gather_span_(std::forward<T>(input), out, root);
+}
+
+template<typename T, typename U>
+void CommPP::gather(T&& input, std::span<U> out) const {
+    gather_span_(std::forward<T>(input), out, std::nullopt);
+}
+
+template<typename U>
+void CommPP::gather_in_place(std::span<U> data) const {
+    static_assert(!std::is_const_v<U>, "Can not gather into const data");
+    static_assert(std::is_trivially_copyable_v<U>, "Is trivially copyable?");
+    // N.B. The PIMPL can only check that the bytes split evenly
+    if(data.size() % size())
+        throw std::runtime_error("Can not split the buffer evenly over the "
+                                 "processes");
+    gather_in_place_(binary_reference(data.data(), data.size()));
+}
+
 template<typename T>
 typename CommPP::gather_return_type<T> CommPP::gatherv(T&& input,
                                                        size_type root) const {
@@ -48,6 +79,24 @@ typename CommPP::all_gather_return_type<T> CommPP::gatherv(T&& input) const {
     return *gatherv_t_(std::forward<T>(input), std::nullopt);
 }
 
+template<typename T>
+typename CommPP::all_gather_return_type<T> CommPP::gatherv(
+  T&& input, algorithm alg) const {
+    return *gatherv_t_(std::forward<T>(input), std::nullopt, alg);
+}
+
+template<typename T>
+typename CommPP::gatherv_counts_return_type<T> CommPP::gatherv_with_counts(
+  T&& input, size_type root) const {
+    return gatherv_counts_t_(std::forward<T>(input), root);
+}
+
+template<typename T>
+typename CommPP::all_gatherv_counts_return_type<T>
+CommPP::gatherv_with_counts(T&& input) const {
+    return *gatherv_counts_t_(std::forward<T>(input), std::nullopt);
+}
+
 template<typename T, typename Fxn>
 typename CommPP::reduce_return_type<T> CommPP::reduce(T&& input, Fxn&& fxn,
                                                       size_type root) const {
@@ -61,13 +110,344 @@ typename CommPP::all_reduce_return_type<T> CommPP::reduce(T&& input,
                       std::nullopt);
 }
 
+template<typename T, typename U, typename Fxn>
+void CommPP::reduce(T&& input, std::span<U> out, Fxn&& fxn,
+                    size_type root) const {
+    reduce_span_(std::forward<T>(input), out, std::forward<Fxn>(fxn), root);
+}
+
+template<typename T, typename U, typename Fxn>
+void CommPP::reduce(T&& input, std::span<U> out, Fxn&& fxn) const {
+    reduce_span_(std::forward<T>(input), out, std::forward<Fxn>(fxn),
+                 std::nullopt);
+}
+
+template<typename U, typename Fxn>
+void CommPP::reduce_in_place(std::span<U> data, Fxn&& fxn) const {
+    static_assert(!std::is_const_v<U>, "Can not reduce into const data");
+    reduce_into_(MPI_IN_PLACE, data.data(), data.size(),
+                 std::forward<Fxn>(fxn), std::nullopt);
+}
+
+template<typename T>
+typename CommPP::broadcast_return_type<T> CommPP::broadcast(
+  T&& input, size_type root) const {
+    using clean_type = std::decay_t<T>;
+
+    const bool am_i_root = me() == root;
+
+    if constexpr(needs_serialized_v<clean_type>) {
+        // Step 0: Root serializes and everyone learns the number of bytes
+        auto start = clock_type::now();
+        binary_type buffer;
+        if(am_i_root) buffer = make_binary_buffer(input);
+        serialized_("broadcast", start);
+        if(am_i_root && compressing_()) buffer = compress_(buffer);
+        std::size_t n_bytes = buffer.size();
+        broadcast_(binary_reference(&n_bytes, 1), root);
+
+        // Step 1: Broadcast the bytes
+        if(!am_i_root) buffer = binary_type(n_bytes);
+        broadcast_(buffer, root);
+
+        if(am_i_root) return clean_type(std::forward<T>(input));
+        if(compressing_()) buffer = decompress_(buffer);
+        start   = clock_type::now();
+        auto rv = from_binary_buffer<clean_type>(buffer);
+        serialized_("broadcast", start);
+        return rv;
+    } else {
+        // Step 0: Everyone learns the number of elements
+        broadcast_return_type<T> rv;
+        if(am_i_root) rv = detail_::to_contiguous_owner(std::forward<T>(input));
+        std::size_t n_elems = detail_::contiguous_size(rv);
+        broadcast_(binary_reference(&n_elems, 1), root);
+
+        // Step 1: Broadcast the elements directly into the result
+        if(!am_i_root) detail_::resize_contiguous(rv, n_elems);
+        broadcast_(binary_reference(detail_::contiguous_data(rv), n_elems),
+                   root);
+        return rv;
+    }
+}
+
+template<typename T>
+typename CommPP::scatter_return_type<T> CommPP::scatter(T&& input,
+                                                        size_type root) const {
+    using clean_type = std::decay_t<T>;
+
+    if constexpr(needs_serialized_v<clean_type>) {
+        return scatter_serialized_(std::forward<T>(input), root);
+    } else {
+        // Step 0: Everyone learns how many elements they get. An invalid
+        //         input is signaled to all processes so they all throw
+        constexpr auto bad   = std::numeric_limits<std::size_t>::max();
+        const bool am_i_root = me() == root;
+        std::size_t n_elems  = 0;
+        if(am_i_root) {
+            const auto n_in = detail_::contiguous_size(input);
+            const bool good = n_in % size() == 0;
+            n_elems         = good ? n_in / size() : bad;
+        }
+        broadcast_(binary_reference(&n_elems, 1), root);
+        if(n_elems == bad)
+            throw std::runtime_error("Input can not be evenly scattered");
+
+        // Step 1: Scatter the elements directly into the result
+        auto rv = detail_::make_contiguous<scatter_return_type<T>>(n_elems);
+        const_binary_reference send;
+        if(am_i_root) send = input_view_(input);
+        scatter_(send, output_view_(rv), root);
+        return rv;
+    }
+}
+
+template<typename T>
+typename CommPP::scatter_return_type<T> CommPP::scatterv(
+  T&& input, size_type root) const {
+    using clean_type = std::decay_t<T>;
+
+    if constexpr(needs_serialized_v<clean_type>) {
+        return scatter_serialized_(std::forward<T>(input), root);
+    } else {
+        // Split the elements as evenly as possible
+        count_container counts;
+        if(me() == root) {
+            const size_type n = detail_::contiguous_size(input);
+            for(size_type i = 0; i < size(); ++i)
+                counts.push_back(n / size() + (i < n % size() ? 1 : 0));
+        }
+        return scatterv_t_(std::forward<T>(input), counts, root);
+    }
+}
+
+template<typename T>
+typename CommPP::scatter_return_type<T> CommPP::scatterv(
+  T&& input, const count_container& counts, size_type root) const {
+    static_assert(!needs_serialized_v<std::decay_t<T>>,
+                  "Counts can only be provided for contiguous containers");
+    return scatterv_t_(std::forward<T>(input), counts, root);
+}
+
+template<typename T>
+typename CommPP::alltoall_return_type<T> CommPP::alltoall(T&& input) const {
+    using clean_type = std::decay_t<T>;
+
+    if constexpr(needs_serialized_v<clean_type>) {
+        using value_type = typename clean_type::value_type;
+
+        // Step 0: Pack the pieces back-to-back into one buffer. An invalid
+        //         input is signaled to all processes (with negative sizes)
+        byte_count_container sizes;
+        byte_offset_container disp;
+        binary_type buffer;
+        auto start = clock_type::now();
+        if(input.size() == std::size_t(size())) {
+            buffer = pack_(input, sizes, disp);
+        } else {
+            sizes.assign(size(), -1);
+        }
+        serialized_("alltoallv", start);
+
+        // Step 1: Let each process know how many bytes it's getting
+        const auto out_sizes = alltoall_sizes_(sizes);
+        auto is_bad = [](byte_count_type x) { return x < 0; };
+        if(is_bad(sizes[0]) ||
+           std::any_of(out_sizes.begin(), out_sizes.end(), is_bad))
+            throw std::runtime_error("Input must have one element per process");
+
+        // Step 2: Exchange the bytes and unpack them
+        const auto out_disp = displacements_(out_sizes);
+        binary_type recv(out_disp.back() + out_sizes.back());
+        alltoallv_(buffer, sizes, disp, recv, out_sizes, out_disp);
+        start   = clock_type::now();
+        auto rv = unpack_<value_type>(recv, out_sizes);
+        serialized_("alltoallv", start);
+        return rv;
+    } else {
+        // Step 0: Agree on the number of elements first, so a bad input makes
+        //         every process throw instead of leaving the rest in
+        //         MPI_Alltoall (the max of -n_in is minus the min of n_in)
+        const auto n_in       = detail_::contiguous_size(input);
+        long long local[2]    = {(long long)n_in, -(long long)n_in};
+        long long extremes[2] = {0, 0};
+        reduce_(local, extremes, 2, MPI_LONG_LONG, MPI_MAX, std::nullopt);
+        if(extremes[0] != -extremes[1] || n_in % size() != 0)
+            throw std::runtime_error("Input can not be evenly exchanged");
+
+        // Step 1: Exchange the elements directly into the result
+        auto rv = detail_::make_contiguous<alltoall_return_type<T>>(n_in);
+        alltoall_(input_view_(input), output_view_(rv));
+        return rv;
+    }
+}
+
+template<typename T>
+typename CommPP::alltoallv_return_type<T> CommPP::alltoallv(
+  T&& input, const count_container& counts) const {
+    using clean_type = std::decay_t<T>;
+    static_assert(!needs_serialized_v<clean_type>,
+                  "Counts can only be provided for contiguous containers");
+    using element_type               = contiguous_value_t<clean_type>;
+    using result_type                = contiguous_result_t<clean_type>;
+    constexpr byte_count_type t_size = sizeof(element_type);
+
+    // Step 0: Convert counts to bytes. An invalid input is signaled to all
+    //         processes (with negative sizes) so they all throw
+    byte_count_container sizes;
+    bool good         = counts.size() == std::size_t(size());
+    std::size_t total = 0;
+    for(std::size_t i = 0; good && i < counts.size(); ++i) {
+        sizes.push_back(counts[i] * t_size);
+        total += counts[i];
+    }
+    if(!good || total > detail_::contiguous_size(input))
+        sizes.assign(size(), -1);
+
+    // Step 1: Let each process know how many bytes it's getting
+    const auto out_sizes = alltoall_sizes_(sizes);
+    auto is_bad          = [](byte_count_type x) { return x < 0; };
+    if(is_bad(sizes[0]) ||
+       std::any_of(out_sizes.begin(), out_sizes.end(), is_bad))
+        throw std::runtime_error("Counts are not consistent with the input");
+
+    // Step 2: Exchange the elements directly into the result
+    const auto disp     = displacements_(sizes);
+    const auto out_disp = displacements_(out_sizes);
+    const auto n_out    = (out_disp.back() + out_sizes.back()) / t_size;
+    auto rv             = detail_::make_contiguous<result_type>(n_out);
+    alltoallv_(input_view_(input), sizes, disp, output_view_(rv), out_sizes,
+               out_disp);
+
+    count_container out_counts;
+    for(const auto x : out_sizes) out_counts.push_back(x / t_size);
+    return alltoallv_return_type<T>(std::move(rv), std::move(out_counts));
+}
+
+template<typename T>
+typename CommPP::future_type<typename CommPP::gather_return_type<T>>
+CommPP::igather(T&& input, size_type root) const {
+    return igather_t_(std::forward<T>(input), root);
+}
+
+template<typename T>
+typename CommPP::future_type<typename CommPP::all_gather_return_type<T>>
+CommPP::igather(T&& input) const {
+    auto deref = [](auto&& rv) { return std::move(*rv); };
+    return igather_t_(std::forward<T>(input), std::nullopt).then(deref);
+}
+
+template<typename T>
+typename CommPP::future_type<typename CommPP::gather_return_type<T>>
+CommPP::igatherv(T&& input, size_type root) const {
+    return igatherv_t_(std::forward<T>(input), root);
+}
+
+template<typename T>
+typename CommPP::future_type<typename CommPP::all_gather_return_type<T>>
+CommPP::igatherv(T&& input) const {
+    auto deref = [](auto&& rv) { return std::move(*rv); };
+    return igatherv_t_(std::forward<T>(input), std::nullopt).then(deref);
+}
+
+template<typename T, typename Fxn>
+typename CommPP::future_type<typename CommPP::reduce_return_type<T>>
+CommPP::ireduce(T&& input, Fxn&& fxn, size_type root) const {
+    return ireduce_t_(std::forward<T>(input), std::forward<Fxn>(fxn), root);
+}
+
+template<typename T, typename Fxn>
+typename CommPP::future_type<typename CommPP::all_reduce_return_type<T>>
+CommPP::ireduce(T&& input, Fxn&& fxn) const {
+    auto deref = [](auto&& rv) { return std::move(*rv); };
+    return ireduce_t_(std::forward<T>(input), std::forward<Fxn>(fxn),
+                      std::nullopt)
+      .then(deref);
+}
+
+template<typename T, typename Fxn>
+typename CommPP::persistent_reduction_type<T> CommPP::persistent_reduce(
+  std::size_t n_elems, Fxn&& fxn, size_type root) const {
+    return persistent_reduce_t_<T>(n_elems, std::forward<Fxn>(fxn), root);
+}
+
+template<typename T, typename Fxn>
+typename CommPP::persistent_reduction_type<T> CommPP::persistent_reduce(
+  std::size_t n_elems, Fxn&& fxn) const {
+    return persistent_reduce_t_<T>(n_elems, std::forward<Fxn>(fxn),
+                                   std::nullopt);
+}
+
+template<typename T>
+void CommPP::send(T&& input, size_type dest, tag_type tag) const {
+    if constexpr(needs_serialized_v<std::decay_t<T>>) {
+        const auto start = clock_type::now();
+        auto buffer      = make_binary_buffer(std::forward<T>(input));
+        serialized_("send", start);
+        send_(buffer, dest, tag);
+    } else {
+        send_(input_view_(input), dest, tag);
+    }
+}
+
+template<typename T>
+T CommPP::recv(size_type source, tag_type tag) const {
+    // Step 0: Match the message and find out how big it is
+    auto [message, n_bytes] = *probe_(source, tag, true);
+
+    // Step 1: Receive it directly into a buffer of the right size
+    auto buffer = make_p2p_buffer_<T>(n_bytes);
+    recv_(message, binary_reference(buffer.data(), buffer.size()));
+    if constexpr(!needs_serialized_v<T>) {
+        return from_p2p_buffer_<T>(std::move(buffer));
+    } else {
+        const auto start = clock_type::now();
+        auto rv          = from_p2p_buffer_<T>(std::move(buffer));
+        serialized_("recv", start);
+        return rv;
+    }
+}
+
+template<typename T>
+typename CommPP::future_type<void> CommPP::isend(T&& input, size_type dest,
+                                                 tag_type tag) const {
+    // The buffer needs to outlive the request, so the future owns it.
+    // N.B. make_binary_buffer moves (rather than copies) rvalue containers
+    auto buffer  = std::make_shared<binary_type>(
+      make_owning_buffer_(std::forward<T>(input)));
+    auto request = isend_(*buffer, dest, tag);
+    return future_type<void>(request, [buffer]() {});
+}
+
+template<typename T>
+typename CommPP::future_type<T> CommPP::irecv(size_type source,
+                                              tag_type tag) const {
+    auto buffer = std::make_shared<p2p_buffer_type<T>>();
+
+    // N.B. The future may outlive *this, so the post function holds a copy
+    auto post = [self = *this, buffer, source, tag](request_type& request,
+                                                    bool block) {
+        auto probed = self.probe_(source, tag, block);
+        if(!probed.has_value()) return false;
+        auto& [message, n_bytes] = *probed;
+        *buffer = make_p2p_buffer_<T>(n_bytes);
+        binary_reference out(buffer->data(), buffer->size());
+        request = self.irecv_(message, out);
+        return true;
+    };
+    auto unwrap = [buffer]() {
+        return from_p2p_buffer_<T>(std::move(*buffer));
+    };
+    return future_type<T>(std::move(post), std::move(unwrap));
+}
+
 // -----------------------------------------------------------------------------
 // -- Private Methods
 // -----------------------------------------------------------------------------
 
 template<typename T>
 typename CommPP::gather_return_type<T> CommPP::gather_t_(
-  T&& input, opt_root_t root) const {
+  T&& input, opt_root_t root, algorithm alg) const {
     using clean_type  = std::decay_t<T>;
     using return_type = typename CommPP::gather_return_type<clean_type>;
     using value_type  = typename return_type::value_type;
@@ -75,39 +455,36 @@ typename CommPP::gather_return_type<T> CommPP::gather_t_(
     const bool am_i_root = root.has_value() ? me() == *root : true;
 
     if constexpr(needs_serialized_v<clean_type>) {
+        // Compressed blocks vary in size, so they need a gatherv
+        if(compressing_()) return gatherv_t_(std::forward<T>(input), root, alg);
+
         // Do gather in binary
+        const auto op  = root ? "gather" : "allgather";
+        auto start     = clock_type::now();
         auto binary    = make_binary_buffer(std::forward<T>(input));
-        auto binary_rv = gather_(binary, root);
+        serialized_(op, start);
+        auto binary_rv = gather_(binary, root, alg);
 
         // Early out if not root
         return_type rv;
         if(!binary_rv.has_value()) return rv;
 
         // We got back a std::vector<std::byte> which contains this->size()
-        // instances of type clean_type, the serialized form of each clean_type
-        // object has size binary_rv->size() / this->size()
-        const auto& buffer   = *binary_rv;
-        auto serialized_size = buffer.size() / size();
-
-        value_type vec(size());
-        for(size_type i = 0, j = 0; i < size_type(buffer.size());
-            i += serialized_size, ++j) {
-            const_binary_reference view(binary_rv->data() + i, serialized_size);
-            vec[j] = std::move(from_binary_view<clean_type>(view));
-        }
-        rv.emplace(std::move(vec));
+        // instances of type clean_type
+        const auto& buffer = *binary_rv;
+        const_binary_reference view(buffer.data(), buffer.size());
+        start = clock_type::now();
+        rv.emplace(unpack_<clean_type>(view, size()));
+        serialized_(op, start);
         return rv;
     } else {
-        // TODO: make traits to_binary, binary_size to wrap calling .data() and
-        //       .size()
-        const_binary_reference input_binary(input.data(), input.size());
+        const auto n_out = detail_::contiguous_size(input) * size();
 
         // Make output buffer, but only allocate on root
         value_type output;
-        if(am_i_root) value_type(input.size() * size()).swap(output);
-        binary_reference output_binary(output.data(), output.size());
+        if(am_i_root) output = detail_::make_contiguous<value_type>(n_out);
 
-        gather_(input_binary, output_binary, root);
+        gather_(input_view_(input), output_view_(output), root, alg);
 
         return_type rv;
         if(am_i_root) rv.emplace(std::move(output));
@@ -117,15 +494,19 @@ typename CommPP::gather_return_type<T> CommPP::gather_t_(
 
 template<typename T>
 typename CommPP::gather_return_type<T> CommPP::gatherv_t_(
-  T&& input, opt_root_t root) const {
+  T&& input, opt_root_t root, algorithm alg) const {
     using clean_type  = std::decay_t<T>;
     using return_type = typename CommPP::gather_return_type<clean_type>;
     using value_type  = typename return_type::value_type;
 
     if constexpr(needs_serialized_v<clean_type>) {
         //  Do gather in binary
-        auto binary    = make_binary_buffer(std::forward<T>(input));
-        auto binary_rv = gatherv_(binary, root);
+        const auto op = root ? "gatherv" : "allgatherv";
+        auto start    = clock_type::now();
+        auto binary   = make_binary_buffer(std::forward<T>(input));
+        serialized_(op, start);
+        if(compressing_()) binary = compress_(binary);
+        auto binary_rv = gatherv_(binary, root, alg);
 
         // Early out if not root
         return_type rv;
@@ -134,74 +515,604 @@ typename CommPP::gather_return_type<T> CommPP::gatherv_t_(
         // We got back a std::vector<std::byte> of the binary data
         // and the sizes sent by each rank
         const auto& buffer = binary_rv->first;
-        const auto& sizes  = binary_rv->second;
+        const_binary_reference view(buffer.data(), buffer.size());
+        start = clock_type::now();
+        rv.emplace(unpack_blocks_<clean_type>(view, binary_rv->second));
+        serialized_(op, start);
+        return rv;
+    } else {
+        // Receive the elements directly into the result
+        auto gathered =
+          gatherv_contiguous_<value_type>(input_view_(input), root, alg);
 
-        value_type vec(size());
-        for(size_type i = 0, total = 0; i < size(); ++i) {
-            const_binary_reference view(buffer.data() + total, sizes[i]);
-            vec[i] = std::move(from_binary_view<clean_type>(view));
-            total += sizes[i];
+        return_type rv;
+        if(gathered.has_value()) rv.emplace(std::move(gathered->first));
+        return rv;
+    }
+}
+
+template<typename T>
+typename CommPP::gatherv_counts_return_type<T> CommPP::gatherv_counts_t_(
+  T&& input, opt_root_t root) const {
+    using clean_type = std::decay_t<T>;
+    static_assert(!needs_serialized_v<clean_type>,
+                  "Counts can only be returned for contiguous containers");
+    using result_type     = contiguous_result_t<clean_type>;
+    constexpr auto t_size = sizeof(contiguous_value_t<clean_type>);
+
+    auto gathered = gatherv_contiguous_<result_type>(input_view_(input), root,
+                                                     algorithm::automatic);
+
+    gatherv_counts_return_type<T> rv;
+    if(!gathered.has_value()) return rv;
+
+    // Convert the byte counts into element counts and offsets
+    index_container counts;
+    index_container offsets;
+    std::size_t total = 0;
+    for(const auto n_bytes : gathered->second) {
+        offsets.push_back(total);
+        counts.push_back(n_bytes / t_size);
+        total += counts.back();
+    }
+    rv.emplace(std::move(gathered->first), std::move(counts),
+               std::move(offsets));
+    return rv;
+}
+
+template<typename T>
+std::optional<std::pair<T, typename CommPP::byte_count_container>>
+CommPP::gatherv_contiguous_(const_binary_reference in_data, opt_root_t root,
+                            algorithm alg) const {
+    const bool am_i_root = root.has_value() ? me() == *root : true;
+
+    // Step 0: Every process learns the number of bytes each process sends
+    //         (the PIMPL needs them all, even if only root gets the result)
+    byte_count_type n_in = in_data.size();
+    byte_count_container sizes(size());
+    const_binary_reference local_size(&n_in, 1);
+    binary_reference size_buffer(sizes.data(), sizes.size());
+    gather_(local_size, size_buffer, std::nullopt, algorithm::flat);
+
+    // Step 1: On root, allocate the result so the bytes land in it directly
+    T output;
+    const auto disp = displacements_(sizes);
+    if(am_i_root) {
+        const std::size_t n_bytes = disp.back() + sizes.back();
+        constexpr auto t_size     = sizeof(contiguous_value_t<T>);
+        output = detail_::make_contiguous<T>(n_bytes / t_size);
+    }
+
+    // Step 2: Gatherv
+    gatherv_(in_data, output_view_(output), sizes, disp, root, alg);
+
+    std::optional<std::pair<T, byte_count_container>> rv;
+    if(am_i_root) rv.emplace(std::move(output), std::move(sizes));
+    return rv;
+}
+
+template<typename T, typename U>
+void CommPP::gather_span_(T&& input, std::span<U> out, opt_root_t root) const {
+    using clean_type = std::decay_t<T>;
+    using value_type = contiguous_value_t<clean_type>;
+    static_assert(!needs_serialized_v<clean_type>,
+                  "Can only gather contiguous containers into a span");
+    static_assert(std::is_same_v<value_type, U>, "Element types must match");
+
+    // N.B. The PIMPL makes sure root's output buffer is big enough
+    binary_reference output_binary(out.data(), out.size());
+    gather_(input_view_(input), output_binary, root, algorithm::automatic);
+}
+
+template<typename T, typename U, typename Fxn>
+void CommPP::reduce_span_(T&& input, std::span<U> out, Fxn&& fxn,
+                          opt_root_t root) const {
+    using clean_type = std::decay_t<T>;
+    static_assert(!needs_serialized_v<clean_type>,
+                  "Can only reduce contiguous containers into a span");
+    static_assert(std::is_same_v<contiguous_value_t<clean_type>, U>,
+                  "Element types must match");
+
+    const bool am_i_root = root.has_value() ? me() == *root : true;
+    const auto n_elems   = detail_::contiguous_size(input);
+    if(am_i_root && out.size() < n_elems)
+        throw std::runtime_error("Output buffer is too small for reduce");
+
+    reduce_into_(detail_::contiguous_data(input), out.data(), n_elems,
+                 std::forward<Fxn>(fxn), root);
+}
+
+template<typename U, typename Fxn>
+void CommPP::reduce_into_(const void* send, U* recv, std::size_t n, Fxn&& fxn,
+                          opt_root_t root) const {
+    static_assert(has_mpi_data_type_v<U>, "Is a recognized MPI type?");
+    if(n > std::size_t(std::numeric_limits<int>::max()))
+        throw std::runtime_error("Can not reduce more than INT_MAX elements");
+
+    // N.B. user_op owns op (if it is user-defined), it must outlive the call
+    auto [type, op, user_op] = reduce_op_<U>(std::forward<Fxn>(fxn));
+
+    reduce_(send, recv, int(n), type, op, root);
+}
+
+template<typename T, typename Fxn>
+typename CommPP::reduce_return_type<T> CommPP::reduce_t_(
+  T&& input, Fxn&& fxn, opt_root_t root) const {
+    using clean_type = std::decay_t<T>;
+
+    if constexpr(has_mpi_data_type_v<clean_type>) {
+        // Scalars are reduced in place on the stack, no heap allocation
+        clean_type result{};
+        reduce_into_(&input, &result, 1, std::forward<Fxn>(fxn), root);
+
+        reduce_return_type<T> rv;
+        if(!root.has_value() || me() == *root) rv.emplace(result);
+        return rv;
+    } else if constexpr(needs_serialized_v<clean_type>) {
+        return reduce_tree_(std::forward<T>(input), std::forward<Fxn>(fxn),
+                            root);
+    } else if constexpr(!has_mpi_data_type_v<contiguous_value_t<clean_type>>) {
+        return reduce_tree_(std::forward<T>(input), std::forward<Fxn>(fxn),
+                            root);
+    } else {
+        return reduce_mpi_(std::forward<T>(input), std::forward<Fxn>(fxn),
+                           root);
+    }
+}
+
+template<typename T, typename Fxn>
+typename CommPP::reduce_return_type<T> CommPP::reduce_mpi_(
+  T&& input, Fxn&& fxn, opt_root_t root) const {
+    // Assumed to be a container
+    using clean_type = std::decay_t<T>;
+    using value_type = contiguous_value_t<clean_type>;
+    using owner_type = contiguous_owner_t<clean_type>;
+
+    static_assert(!needs_serialized_v<clean_type>, "Doesn't needs serialized?");
+    static_assert(has_mpi_data_type_v<value_type>, "Is a recognized MPI type?");
+
+    const auto am_i_root = root.has_value() ? me() == *root : true;
+    const auto n_elems   = detail_::contiguous_size(input);
+
+    owner_type temp{};
+    if(am_i_root) temp = detail_::make_contiguous<owner_type>(n_elems);
+
+    const auto* send = detail_::contiguous_data(input);
+    reduce_into_(send, detail_::contiguous_data(temp), n_elems,
+                 std::forward<Fxn>(fxn), root);
+    reduce_return_type<T> rv;
+    if(am_i_root) rv.emplace(std::move(temp));
+    return rv;
+}
+
+template<typename T, typename Fxn>
+typename CommPP::reduce_return_type<T> CommPP::reduce_tree_(
+  T&& input, Fxn&& fxn, opt_root_t root) const {
+    using clean_type = std::decay_t<T>;
+
+    const auto n_ranks   = size();
+    const auto my_rank   = me();
+    const auto tree_tag  = tag("parallelzone::CommPP::reduce");
+    const auto am_i_root = root.has_value() ? my_rank == *root : true;
+
+    // Step 0: Binomial tree reduction to rank 0. At each step rank r holds
+    //         the result for ranks [r, r + mask), so combining with what
+    //         rank r + mask holds keeps the ranks in order.
+    using owner_type  = contiguous_owner_t<clean_type>;
+    owner_type result = detail_::to_contiguous_owner(std::forward<T>(input));
+    for(size_type mask = 1; mask < n_ranks; mask <<= 1) {
+        if(my_rank & mask) {
+            send(result, my_rank - mask, tree_tag);
+            break;
+        }
+        if(my_rank + mask < n_ranks) {
+            auto other = recv<owner_type>(my_rank + mask, tree_tag);
+            result     = combine_(result, other, fxn);
         }
-        rv.emplace(std::move(vec));
+    }
+
+    // Step 1: Get the result from rank 0 to whoever needs it
+    if(!root.has_value()) {
+        result = broadcast(std::move(result), 0);
+    } else if(*root != 0) {
+        if(my_rank == 0) send(result, *root, tree_tag);
+        if(am_i_root) result = recv<owner_type>(0, tree_tag);
+    }
+
+    reduce_return_type<T> rv;
+    if(am_i_root) rv.emplace(std::move(result));
+    return rv;
+}
+
+template<typename T, typename Fxn>
+T CommPP::combine_(const T& lhs, const T& rhs, Fxn&& fxn) {
+    if constexpr(std::is_invocable_r_v<T, Fxn, const T&, const T&>) {
+        return fxn(lhs, rhs);
+    } else {
+        if(lhs.size() != rhs.size())
+            throw std::runtime_error("Can't reduce different numbers of "
+                                     "elements");
+        T rv(lhs);
+        std::transform(lhs.begin(), lhs.end(), rhs.begin(), rv.begin(), fxn);
         return rv;
+    }
+}
+
+template<typename T>
+typename CommPP::future_type<typename CommPP::gather_return_type<T>>
+CommPP::igather_t_(T&& input, opt_root_t root) const {
+    using clean_type  = std::decay_t<T>;
+    using return_type = typename CommPP::gather_return_type<clean_type>;
+    using value_type  = typename return_type::value_type;
+    constexpr bool serialize = needs_serialized_v<clean_type>;
+    using recv_type = std::conditional_t<serialize, binary_type, value_type>;
+
+    const bool am_i_root = root.has_value() ? me() == *root : true;
+
+    // The buffers need to outlive the request, so the future owns them.
+    // N.B. make_binary_buffer moves (rather than copies) rvalue containers
+    struct buffers {
+        binary_type send;
+        recv_type recv;
+    };
+    auto state = std::make_shared<buffers>();
+    if constexpr(serialize) {
+        state->send = make_binary_buffer(std::forward<T>(input));
+        if(am_i_root) state->recv = binary_type(state->send.size() * size());
     } else {
-        // TODO: make traits to_binary, binary_size to wrap calling .data() and
-        //       .size()
-        const_binary_reference input_binary(input.data(), input.size());
+        const auto n_out = detail_::contiguous_size(input) * size();
+        state->send      = make_owning_buffer_(std::forward<T>(input));
+        if(am_i_root) state->recv = detail_::make_contiguous<recv_type>(n_out);
+    }
 
-        // TODO: avoid copy by preallocating buffer
-        auto binary_rv = gatherv_(input_binary, root);
+    auto request = igather_(state->send, output_view_(state->recv), root);
 
-        // Early out if not root
+    auto unwrap = [state, am_i_root, n_ranks = size()]() {
         return_type rv;
-        if(!binary_rv.has_value()) return rv;
-
-        // We got back a std::vector<std::byte> of the binary data
-        // and the sizes (in bytes) sent by each rank
-        const auto& buffer    = binary_rv->first;
-        using element_type    = typename value_type::value_type;
-        constexpr auto t_size = sizeof(element_type);
-
-        value_type vec;
-        for(size_type i = 0; i < size_type(buffer.size()); i += t_size) {
-            const_binary_reference view(buffer.data() + i, t_size);
-            vec.emplace_back(std::move(from_binary_view<element_type>(view)));
+        if(!am_i_root) return rv;
+        if constexpr(serialize) {
+            rv.emplace(unpack_<clean_type>(state->recv, n_ranks));
+        } else {
+            rv.emplace(std::move(state->recv));
         }
-        rv.emplace(std::move(vec));
         return rv;
+    };
+    return future_type<return_type>(request, std::move(unwrap));
+}
+
+template<typename T>
+typename CommPP::future_type<typename CommPP::gather_return_type<T>>
+CommPP::igatherv_t_(T&& input, opt_root_t root) const {
+    using clean_type  = std::decay_t<T>;
+    using return_type = typename CommPP::gather_return_type<clean_type>;
+    using value_type  = typename return_type::value_type;
+    constexpr bool serialize = needs_serialized_v<clean_type>;
+    using recv_type = std::conditional_t<serialize, binary_type, value_type>;
+
+    const bool am_i_root = root.has_value() ? me() == *root : true;
+
+    // The buffers need to outlive the request, so the future owns them.
+    // N.B. make_binary_buffer moves (rather than copies) rvalue containers
+    struct buffers {
+        binary_type send;
+        byte_count_container sizes;
+        byte_offset_container displacements;
+        recv_type recv;
+        std::shared_ptr<const void> keep_alive;
+    };
+    auto state  = std::make_shared<buffers>();
+    state->send = make_owning_buffer_(std::forward<T>(input));
+
+    // Step 0: Exchange the sizes (blocking, but only one count per rank).
+    //         Every process gets them all, even if only root gets the result
+    byte_count_type n_in = state->send.size();
+    state->sizes.resize(size());
+    const_binary_reference local_size(&n_in, 1);
+    binary_reference size_buffer(state->sizes.data(), state->sizes.size());
+    gather_(local_size, size_buffer, std::nullopt, algorithm::flat);
+
+    // Step 1: Compute displacements and, on root, allocate the receive
+    //         buffer. Contiguous types are received directly into the result.
+    byte_offset_type total = 0;
+    for(auto n : state->sizes) {
+        state->displacements.push_back(total);
+        total += n;
+    }
+    if(am_i_root) {
+        if constexpr(serialize) {
+            state->recv = binary_type(std::size_t(total));
+        } else {
+            constexpr auto t_size = sizeof(contiguous_value_t<value_type>);
+            state->recv = detail_::make_contiguous<recv_type>(total / t_size);
+        }
     }
+
+    // Step 2: Start the nonblocking gatherv
+    auto request = igatherv_(state->send, output_view_(state->recv),
+                             state->sizes, state->displacements, root,
+                             state->keep_alive);
+
+    auto unwrap = [state, am_i_root]() {
+        return_type rv;
+        if(!am_i_root) return rv;
+        if constexpr(serialize) {
+            rv.emplace(unpack_<clean_type>(state->recv, state->sizes));
+        } else {
+            rv.emplace(std::move(state->recv));
+        }
+        return rv;
+    };
+    return future_type<return_type>(request, std::move(unwrap));
 }
 
 template<typename T, typename Fxn>
-typename CommPP::reduce_return_type<T> CommPP::reduce_t_(
-  T&& input, Fxn&& fxn, opt_root_t root) const {
+typename CommPP::future_type<typename CommPP::reduce_return_type<T>>
+CommPP::ireduce_t_(T&& input, Fxn&& fxn, opt_root_t root) const {
     // Assumed to be a container
-    using clean_type = std::decay_t<T>;
-    using value_type = typename clean_type::value_type;
-    using clean_fxn  = std::decay_t<Fxn>;
+    using clean_type  = std::decay_t<T>;
+    using value_type  = contiguous_value_t<clean_type>;
+    using owner_type  = contiguous_owner_t<clean_type>;
+    using return_type = reduce_return_type<T>;
 
     static_assert(!needs_serialized_v<clean_type>, "Doesn't needs serialized?");
     static_assert(has_mpi_data_type_v<value_type>, "Is a recognized MPI type?");
-    static_assert(has_mpi_op_v<clean_fxn>, "Is a recognized MPI Operation?");
 
     const auto am_i_root = root.has_value() ? me() == *root : true;
-    const auto n_elems   = input.size();
-    auto type            = mpi_data_type_v<value_type>;
-    auto op              = mpi_op_v<clean_fxn>;
 
-    std::vector<value_type> temp;
-    if(am_i_root) std::vector<value_type>(n_elems).swap(temp);
+    // N.B. Checked before any MPI call, so every process throws
+    const auto n_in = detail_::contiguous_size(input);
+    if(n_in > std::size_t(std::numeric_limits<int>::max()))
+        throw std::runtime_error("Can not reduce more than INT_MAX elements");
+
+    auto [type, op, user_op] = reduce_op_<value_type>(std::forward<Fxn>(fxn));
 
-    const auto send = input.data();
-    const auto recv = temp.data();
+    // The buffers (and a user-defined operation) need to outlive the
+    // request, so the future owns them
+    struct buffers {
+        owner_type send;
+        owner_type recv;
+        user_op_type<value_type> op;
+    };
+    auto state = std::make_shared<buffers>(
+      buffers{detail_::to_contiguous_owner(std::forward<T>(input)), {},
+              std::move(user_op)});
+    const auto n_elems = detail_::contiguous_size(state->send);
+    if(am_i_root) state->recv = detail_::make_contiguous<owner_type>(n_elems);
 
-    if(root.has_value()) {
-        MPI_Reduce(send, recv, n_elems, type, op, *root, comm());
+    const auto send = detail_::contiguous_data(state->send);
+    const auto recv = detail_::contiguous_data(state->recv);
+
+    auto request = ireduce_(send, recv, int(n_elems), type, op, root);
+
+    auto unwrap = [state, am_i_root]() {
+        return_type rv;
+        if(am_i_root) rv.emplace(std::move(state->recv));
+        return rv;
+    };
+    return future_type<return_type>(request, std::move(unwrap));
+}
+
+template<typename T, typename Fxn>
+typename CommPP::persistent_reduction_type<T> CommPP::persistent_reduce_t_(
+  std::size_t n_elems, Fxn&& fxn, opt_root_t root) const {
+    static_assert(has_mpi_data_type_v<T>, "Is a recognized MPI type?");
+
+    auto [type, op, user_op] = reduce_op_<T>(std::forward<Fxn>(fxn));
+    return persistent_reduction_type<T>(comm(), n_elems, type, op, root,
+                                        std::move(user_op));
+}
+
+template<typename T, typename Fxn>
+auto CommPP::reduce_op_(Fxn&& fxn) {
+    using clean_fxn = std::decay_t<Fxn>;
+    using op_type   = user_op_type<T>;
+
+    if constexpr(has_mpi_op_v<clean_fxn> && is_predefined_mpi_type_v<T>) {
+        return std::make_tuple(MPIDataType<T>::type(), mpi_op_v<clean_fxn>,
+                               op_type{});
+    } else if constexpr(std::is_same_v<clean_fxn, op_type>) {
+        return std::make_tuple(fxn.type(), fxn.op(), op_type(fxn));
     } else {
-        MPI_Allreduce(send, recv, n_elems, type, op, comm());
+        static_assert(std::is_invocable_r_v<T, clean_fxn, const T&, const T&>,
+                      "Is a callable combining two elements?");
+        // MPI's operations can't be used with derived data types, but they
+        // are all commutative, so MPI may still reorder the arguments
+        op_type user_op(std::forward<Fxn>(fxn), has_mpi_op_v<clean_fxn>);
+        return std::make_tuple(user_op.type(), user_op.op(), user_op);
+    }
+}
+
+template<typename T>
+typename CommPP::scatter_return_type<T> CommPP::scatterv_t_(
+  T&& input, const count_container& counts, size_type root) const {
+    using clean_type      = std::decay_t<T>;
+    using element_type    = contiguous_value_t<clean_type>;
+    constexpr auto t_size = sizeof(element_type);
+
+    // Step 0: On root, convert counts to bytes. An invalid input is signaled
+    //         to all processes (with negative sizes) so they all throw
+    const bool am_i_root = me() == root;
+    byte_count_container sizes;
+    if(am_i_root) {
+        bool good         = counts.size() == std::size_t(size());
+        std::size_t total = 0;
+        for(std::size_t i = 0; good && i < counts.size(); ++i) {
+            sizes.push_back(counts[i] * t_size);
+            total += counts[i];
+        }
+        if(!good || total > detail_::contiguous_size(input))
+            sizes.assign(size(), -1);
+    }
+
+    // Step 1: Let every process know how many bytes each process is getting
+    sizes = broadcast_sizes_(std::move(sizes), root);
+    if(sizes[me()] < 0)
+        throw std::runtime_error("Counts are not consistent with the input");
+    const auto disp = displacements_(sizes);
+
+    // Step 2: Scatter the elements directly into the result
+    using result_type  = scatter_return_type<T>;
+    const auto n_elems = sizes[me()] / t_size;
+    auto rv            = detail_::make_contiguous<result_type>(n_elems);
+    const_binary_reference send;
+    if(am_i_root) send = input_view_(input);
+    scatterv_(send, sizes, disp, output_view_(rv), root);
+    return rv;
+}
+
+template<typename T>
+typename CommPP::scatter_return_type<T> CommPP::scatter_serialized_(
+  T&& input, size_type root) const {
+    using clean_type = std::decay_t<T>;
+    using value_type = typename clean_type::value_type;
+
+    // Step 0: Root converts each element to binary, back-to-back in one
+    //         buffer. An invalid input is signaled to all processes.
+    const bool am_i_root = me() == root;
+    byte_count_container sizes;
+    byte_offset_container disp;
+    binary_type buffer;
+    auto start = clock_type::now();
+    if(am_i_root) {
+        if(input.size() == std::size_t(size())) {
+            buffer = pack_(input, sizes, disp);
+        } else {
+            sizes.assign(size(), -1);
+        }
+    }
+    serialized_("scatterv", start);
+
+    // Step 1: Let every process know how many bytes each process is getting
+    sizes = broadcast_sizes_(std::move(sizes), root);
+    if(sizes[me()] < 0)
+        throw std::runtime_error("Input must have one element per process");
+    if(!am_i_root) disp = displacements_(sizes);
+
+    // Step 2: Scatter the bytes and deserialize
+    binary_type recv(sizes[me()]);
+    scatterv_(buffer, sizes, disp, recv, root);
+    start   = clock_type::now();
+    auto rv = from_binary_buffer<value_type>(recv);
+    serialized_("scatterv", start);
+    return rv;
+}
+
+template<typename T>
+typename CommPP::binary_type CommPP::pack_(const T& input,
+                                          byte_count_container& sizes,
+                                          byte_offset_container& disp) {
+    using value_type = typename T::value_type;
+
+    // N.B. a fresh archive per element keeps each element readable on its own
+    detail_::OutputBinaryStreambuf sink;
+    {
+        std::ostream os(&sink);
+        for(const auto& x : input) {
+            const auto offset = sink.size();
+            if constexpr(needs_serialized_v<value_type>) {
+                cereal::BinaryOutputArchive ar(os);
+                ar << x;
+            } else {
+                auto view = input_view_(x);
+                auto p = reinterpret_cast<const char*>(view.data());
+                os.write(p, view.size());
+            }
+            disp.push_back(offset);
+            sizes.push_back(sink.size() - offset);
+        }
+    }
+    return make_binary_buffer(sink.release());
+}
+
+template<typename T>
+typename CommPP::p2p_buffer_type<T> CommPP::make_p2p_buffer_(
+  std::size_t n_bytes) {
+    static_assert(std::is_same_v<contiguous_owner_t<T>, T>,
+                  "Can not receive into a view, receive a container instead");
+    if constexpr(needs_serialized_v<T>) {
+        return binary_type(n_bytes);
+    } else {
+        // Round up so a malformed message can't overflow the buffer
+        constexpr auto t_size = sizeof(contiguous_value_t<T>);
+        const auto n_elems    = (n_bytes + t_size - 1) / t_size;
+        return detail_::make_contiguous<p2p_buffer_type<T>>(n_elems);
+    }
+}
+
+template<typename T>
+T CommPP::from_p2p_buffer_(p2p_buffer_type<T>&& buffer) {
+    if constexpr(needs_serialized_v<T>) {
+        return from_binary_buffer<T>(buffer);
+    } else if constexpr(std::is_same_v<p2p_buffer_type<T>, T>) {
+        return std::move(buffer);
+    } else {
+        // e.g., a std::array, which is received into a std::vector
+        return from_binary_view<T>(input_view_(buffer));
+    }
+}
+
+template<typename T>
+typename CommPP::binary_type CommPP::make_owning_buffer_(T&& input) {
+    if constexpr(needs_serialized_v<std::decay_t<T>>) {
+        return make_binary_buffer(std::forward<T>(input));
+    } else {
+        // N.B. views (e.g., std::span) are copied, so the buffer owns the data
+        return make_binary_buffer(
+          detail_::to_contiguous_owner(std::forward<T>(input)));
+    }
+}
+
+template<typename T>
+typename CommPP::const_binary_reference CommPP::input_view_(const T& input) {
+    const auto* p = detail_::contiguous_data(input);
+    return const_binary_reference(p, detail_::contiguous_size(input));
+}
+
+template<typename T>
+typename CommPP::binary_reference CommPP::output_view_(T& output) {
+    auto* p = detail_::contiguous_data(output);
+    return binary_reference(p, detail_::contiguous_size(output));
+}
+
+template<typename T>
+std::vector<T> CommPP::unpack_(const_binary_reference buffer, size_type n) {
+    // The serialized form of each object has size buffer.size() / n
+    const std::size_t serialized_size = n > 0 ? buffer.size() / n : 0;
+
+    std::vector<T> rv(n);
+    for(size_type i = 0; i < n; ++i) {
+        const_binary_reference view(buffer.data() + i * serialized_size,
+                                    serialized_size);
+        rv[i] = from_binary_view<T>(view);
+    }
+    return rv;
+}
+
+template<typename T>
+std::vector<T> CommPP::unpack_(const_binary_reference buffer,
+                               const byte_count_container& sizes) {
+    std::vector<T> rv(sizes.size());
+    std::size_t total = 0;
+    for(std::size_t i = 0; i < sizes.size(); ++i) {
+        const_binary_reference view(buffer.data() + total, sizes[i]);
+        rv[i] = from_binary_view<T>(view);
+        total += sizes[i];
+    }
+    return rv;
+}
+
+template<typename T>
+std::vector<T> CommPP::unpack_blocks_(const_binary_reference buffer,
+                                      const byte_count_container& sizes) const {
+    if(!compressing_()) return unpack_<T>(buffer, sizes);
+
+    std::vector<T> rv(sizes.size());
+    std::size_t total = 0;
+    for(std::size_t i = 0; i < sizes.size(); ++i) {
+        const_binary_reference view(buffer.data() + total, sizes[i]);
+        rv[i] = from_binary_buffer<T>(decompress_(view));
+        total += sizes[i];
     }
-    reduce_return_type<T> rv;
-    if(am_i_root) rv.emplace(std::move(temp));
     return rv;
 }
 
@@ -0,0 +1,247 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <functional>
+#include <mpi.h>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace parallelzone::mpi_helpers {
+
+/** @brief Handle to the result of a nonblocking CommPP operation.
+ *
+ *  The nonblocking methods of CommPP (igather, igatherv, ireduce, etc.)
+ *  start an MPI operation and immediately return an instance of this class.
+ *  The operation then progresses in the background while the caller does
+ *  other work. The buffers used by the operation are owned by the unwrap
+ *  function held by *this, so they live at least as long as the operation.
+ *
+ *  The result is only converted back into a C++ object (e.g., deserialized)
+ *  when get() is called. Until then, the only cost of holding onto *this is
+ *  the memory of the buffers.
+ *
+ *  CommPPFuture is move-only. If an instance is destroyed while the operation
+ *  is still in flight, the dtor waits for it to complete (MPI does not allow
+ *  the buffers of an in-flight operation to be freed).
+ *
+ *  @tparam T The type of the object returned by get().
+ */
+template<typename T>
+class CommPPFuture {
+public:
+    /// Type of the object this future resolves to
+    using value_type = T;
+
+    /// Type of a handle to an in-flight MPI operation
+    using request_type = MPI_Request;
+
+    /// Type of a function which converts the received buffers into a T
+    using unwrap_function = std::function<value_type()>;
+
+    /** @brief Type of a function which posts the operation.
+     *
+     *  The function is given the request to set, and whether or not it may
+     *  block. It returns true if it posted the operation and false if the
+     *  operation can not be posted yet (only allowed if it may not block).
+     */
+    using post_function = std::function<bool(request_type&, bool)>;
+
+    /** @brief Creates a future with no operation.
+     *
+     *  Default constructed futures are not valid(). Calling get() on them
+     *  will raise an error.
+     *
+     *  @throw None No throw guarantee.
+     */
+    CommPPFuture() noexcept = default;
+
+    /** @brief Creates a future tracking @p request.
+     *
+     *  @param[in] request The MPI request of the in-flight operation. May be
+     *                     MPI_REQUEST_NULL if there is nothing to wait on.
+     *  @param[in] unwrap  A callable which, once @p request has completed,
+     *                     returns the result of the operation. @p unwrap is
+     *                     expected to own any buffers @p request uses.
+     *
+     *  @throw None No throw guarantee.
+     */
+    CommPPFuture(request_type request, unwrap_function unwrap) noexcept :
+      m_request_(request), m_unwrap_(std::move(unwrap)) {}
+
+    /** @brief Creates a future whose operation is posted later.
+     *
+     *  Some operations can not be posted right away. For example, receiving
+     *  a message of unknown size requires probing for the message first.
+     *  This ctor is for such operations. @p post is called (without blocking)
+     *  by ready() until it succeeds, and (blocking) by wait() and get() if it
+     *  has not succeeded yet. If *this is destroyed before @p post succeeds,
+     *  the operation is simply never posted.
+     *
+     *  @param[in] post   A callable which posts the operation. See the
+     *                    description of post_function.
+     *  @param[in] unwrap A callable which, once the posted operation has
+     *                    completed, returns its result.
+     *
+     *  @throw None No throw guarantee.
+     */
+    CommPPFuture(post_function post, unwrap_function unwrap) noexcept :
+      m_post_(std::move(post)), m_unwrap_(std::move(unwrap)) {}
+
+    /// Deleted because MPI requests can not be copied
+    CommPPFuture(const CommPPFuture&) = delete;
+
+    /// Deleted because MPI requests can not be copied
+    CommPPFuture& operator=(const CommPPFuture&) = delete;
+
+    /** @brief Takes ownership of the operation tracked by @p other.
+     *
+     *  @param[in,out] other The future to take the operation from. After this
+     *                       call @p other is not valid().
+     *
+     *  @throw None No throw guarantee.
+     */
+    CommPPFuture(CommPPFuture&& other) noexcept :
+      m_request_(std::exchange(other.m_request_, MPI_REQUEST_NULL)),
+      m_post_(std::exchange(other.m_post_, nullptr)),
+      m_unwrap_(std::exchange(other.m_unwrap_, nullptr)) {}
+
+    /** @brief Waits on the operation in *this, then takes the one in @p rhs.
+     *
+     *  @param[in,out] rhs The future to take the operation from. After this
+     *                     call @p rhs is not valid().
+     *
+     *  @return *this after taking ownership of @p rhs's operation.
+     *
+     *  @throw None No throw guarantee.
+     */
+    CommPPFuture& operator=(CommPPFuture&& rhs) noexcept {
+        if(this != &rhs) {
+            wait_();
+            m_request_ = std::exchange(rhs.m_request_, MPI_REQUEST_NULL);
+            m_post_    = std::exchange(rhs.m_post_, nullptr);
+            m_unwrap_  = std::exchange(rhs.m_unwrap_, nullptr);
+        }
+        return *this;
+    }
+
+    /// Waits for the posted operation (if any) to complete
+    ~CommPPFuture() noexcept { wait_(); }
+
+    /** @brief Does *this have a result which can be retrieved?
+     *
+     *  @return True if get() can be called and false otherwise.
+     *
+     *  @throw None No throw guarantee.
+     */
+    bool valid() const noexcept { return static_cast<bool>(m_unwrap_); }
+
+    /** @brief Checks, without blocking, whether the operation has completed.
+     *
+     *  This method wraps MPI_Test. Calling it also gives MPI a chance to make
+     *  progress on the operation.
+     *
+     *  @return True if the operation has completed and false otherwise.
+     */
+    bool ready() {
+        if(!post_(false)) return false;
+        if(m_request_ == MPI_REQUEST_NULL) return true;
+        int flag = 0;
+        MPI_Test(&m_request_, &flag, MPI_STATUS_IGNORE);
+        return flag != 0;
+    }
+
+    /// Blocks until the operation completes (wraps MPI_Wait)
+    void wait() {
+        post_(true);
+        wait_();
+    }
+
+    /** @brief Waits for the operation and returns its result.
+     *
+     *  After this call *this is no longer valid().
+     *
+     *  @return The result of the operation.
+     *
+     *  @throw std::runtime_error if *this is not valid(). Strong throw
+     *                            guarantee.
+     */
+    value_type get() {
+        if(!valid()) throw std::runtime_error("CommPPFuture is not valid");
+        wait();
+        auto unwrap = std::exchange(m_unwrap_, nullptr);
+        return unwrap();
+    }
+
+    /** @brief Returns a future which applies @p fxn to the result of *this.
+     *
+     *  This does not wait. @p fxn is called when get() is called on the
+     *  returned future. After this call *this is no longer valid().
+     *
+     *  @tparam Fxn The type of a callable taking a value_type.
+     *
+     *  @param[in] fxn The callable to apply to the result.
+     *
+     *  @return A future tracking the same operation as *this did.
+     */
+    template<typename Fxn>
+    auto then(Fxn&& fxn) && {
+        using result_type = std::invoke_result_t<Fxn, value_type>;
+        auto unwrap       = std::exchange(m_unwrap_, nullptr);
+        auto request      = std::exchange(m_request_, MPI_REQUEST_NULL);
+        auto new_unwrap   = [unwrap = std::move(unwrap),
+                           fxn    = std::forward<Fxn>(fxn)]() {
+            return fxn(unwrap());
+        };
+        CommPPFuture<result_type> rv(request, std::move(new_unwrap));
+        rv.m_post_ = std::exchange(m_post_, nullptr);
+        return rv;
+    }
+
+private:
+    /// Other instantiations need to be able to set m_post_ in then()
+    template<typename U>
+    friend class CommPPFuture;
+
+    /// Calls m_post_ (if set), returns false if the operation isn't posted
+    bool post_(bool block) {
+        if(!m_post_) return true;
+        if(!m_post_(m_request_, block)) return false;
+        m_post_ = nullptr;
+        return true;
+    }
+
+    /// Waits on m_request_, unless MPI has already been finalized
+    void wait_() noexcept {
+        if(m_request_ == MPI_REQUEST_NULL) return;
+        int finalized = 0;
+        MPI_Finalized(&finalized);
+        if(!finalized) MPI_Wait(&m_request_, MPI_STATUS_IGNORE);
+        m_request_ = MPI_REQUEST_NULL;
+    }
+
+    /// The MPI request of the in-flight operation
+    request_type m_request_ = MPI_REQUEST_NULL;
+
+    /// If set, the operation still needs to be posted by calling this
+    post_function m_post_;
+
+    /// Converts the received buffers into the result, owns the buffers
+    unwrap_function m_unwrap_;
+};
+
+} // namespace parallelzone::mpi_helpers
@@ -0,0 +1,334 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <algorithm>
+#include <limits>
+#include <mpi.h>
+#include <optional>
+#include <parallelzone/mpi_helpers/commpp/user_op.hpp>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace parallelzone::mpi_helpers {
+
+/** @brief A reduction which is set up once and then run many times.
+ *
+ *  Iterative algorithms often reduce the same number of elements, of the same
+ *  type, with the same operation, many times. Going through CommPP::reduce
+ *  each time means allocating a result buffer and looking up the MPI datatype
+ *  and operation on every call. PersistentReduction instead owns the input
+ *  and result buffers and remembers the datatype and operation, so each
+ *  iteration is: fill input(), start(), do other work, wait(), read result().
+ *
+ *  If the MPI library supports MPI-4, the reduction is planned once with
+ *  MPI_Allreduce_init (or MPI_Reduce_init if there is a root), which lets the
+ *  library reuse its internal schedule, and each start() is an MPI_Start.
+ *  Otherwise each start() is an MPI_Iallreduce (or MPI_Ireduce) on the cached
+ *  buffers. Either way the reduction progresses in the background between
+ *  start() and wait().
+ *
+ *  PersistentReduction is move-only and does not own the communicator, which
+ *  must outlive it. Since the MPI calls behind it are collective, instances
+ *  must be created, started, and destroyed in the same order on every process.
+ *
+ *  @tparam T The type of the elements being reduced. Must have an MPI
+ *            datatype.
+ */
+template<typename T>
+class PersistentReduction {
+public:
+    /// Type of the elements being reduced
+    using value_type = T;
+
+    /// Type of the buffer holding the result
+    using buffer_type = std::vector<value_type>;
+
+    /// Type used for counting elements
+    using size_type = std::size_t;
+
+    /// Type of an MPI communicator
+    using mpi_comm_type = MPI_Comm;
+
+    /// Type of a handle to an MPI operation
+    using request_type = MPI_Request;
+
+    /// Type of an optional root
+    using opt_root_t = std::optional<int>;
+
+    /// True if the reduction is planned with MPI-4's persistent collectives
+    static constexpr bool uses_persistent_collectives = MPI_VERSION >= 4;
+
+    /** @brief Creates a handle which does not describe a reduction.
+     *
+     *  @throw None No throw guarantee.
+     */
+    PersistentReduction() noexcept = default;
+
+    /** @brief Sets up a reduction of @p n elements.
+     *
+     *  If the MPI library supports persistent collectives this is a
+     *  collective call over @p comm.
+     *
+     *  @param[in] comm The communicator to reduce over.
+     *  @param[in] n    The number of elements being reduced.
+     *  @param[in] type The MPI datatype of the elements.
+     *  @param[in] op   The MPI operation used to combine the elements.
+     *  @param[in] root If set, only the process with rank @p root gets the
+     *                  result. Otherwise every process does.
+     *  @param[in] user_op If @p op is user-defined, the UserOp owning it (and
+     *                     @p type). Ensures they live as long as *this.
+     *
+     *  @throw std::runtime_error if @p n is more than INT_MAX. Strong throw
+     *                            guarantee.
+     *  @throw std::bad_alloc if allocating the buffers fails. Strong throw
+     *                        guarantee.
+     */
+    PersistentReduction(mpi_comm_type comm, size_type n, MPI_Datatype type,
+                        MPI_Op op, opt_root_t root = std::nullopt,
+                        UserOp<value_type> user_op = {}) :
+      m_comm_(comm),
+      m_type_(type),
+      m_op_(op),
+      m_root_(root),
+      m_user_op_(std::move(user_op)),
+      m_input_(checked_size_(n)) {
+        int me = 0;
+        MPI_Comm_rank(m_comm_, &me);
+        if(!m_root_.has_value() || *m_root_ == me) m_result_.resize(n);
+#if MPI_VERSION >= 4
+        auto send       = m_input_.data();
+        auto recv       = m_result_.data();
+        const int count = n;
+        if(m_root_.has_value()) {
+            MPI_Reduce_init(send, recv, count, m_type_, m_op_, *m_root_,
+                            m_comm_, MPI_INFO_NULL, &m_request_);
+        } else {
+            MPI_Allreduce_init(send, recv, count, m_type_, m_op_, m_comm_,
+                               MPI_INFO_NULL, &m_request_);
+        }
+#endif
+    }
+
+    /// Deleted because MPI requests can not be copied
+    PersistentReduction(const PersistentReduction&) = delete;
+
+    /// Deleted because MPI requests can not be copied
+    PersistentReduction& operator=(const PersistentReduction&) = delete;
+
+    /** @brief Takes over the reduction in @p other.
+     *
+     *  The buffers are moved, not copied, so a reduction in flight is not
+     *  disturbed.
+     *
+     *  @param[in,out] other The reduction to take over. After this call
+     *                       @p other is not valid().
+     *
+     *  @throw None No throw guarantee.
+     */
+    PersistentReduction(PersistentReduction&& other) noexcept { swap(other); }
+
+    /** @brief Releases the reduction in *this and takes over @p rhs's.
+     *
+     *  @param[in,out] rhs The reduction to take over. After this call @p rhs
+     *                     is not valid().
+     *
+     *  @return *this after taking over @p rhs's reduction.
+     *
+     *  @throw None No throw guarantee.
+     */
+    PersistentReduction& operator=(PersistentReduction&& rhs) noexcept {
+        if(this != &rhs) {
+            PersistentReduction temp(std::move(rhs));
+            swap(temp);
+        }
+        return *this;
+    }
+
+    /// Waits for a reduction in flight, then releases the MPI resources
+    ~PersistentReduction() noexcept { release_(); }
+
+    /// Does *this describe a reduction?
+    bool valid() const noexcept { return m_comm_ != MPI_COMM_NULL; }
+
+    /// The number of elements being reduced
+    size_type size() const noexcept { return m_input_.size(); }
+
+    /** @brief The buffer holding this process's contribution.
+     *
+     *  The buffer has size() elements and may be modified between wait() (or
+     *  creation) and the next start(). Its address never changes.
+     *
+     *  @return A pointer to the first element of the input buffer.
+     */
+    value_type* input() noexcept { return m_input_.data(); }
+
+    /// Read-only version of input()
+    const value_type* input() const noexcept { return m_input_.data(); }
+
+    /** @brief The result of the most recently completed reduction.
+     *
+     *  @return The reduced elements. Empty on processes which are not the
+     *          root of a rooted reduction.
+     */
+    const buffer_type& result() const noexcept { return m_result_; }
+
+    /** @brief Starts the reduction using the current contents of input().
+     *
+     *  @throw std::runtime_error if *this is not valid() or if the previous
+     *                            reduction has not been waited on. Strong
+     *                            throw guarantee.
+     */
+    void start() {
+        if(!valid()) throw std::runtime_error("Reduction is not valid");
+        if(m_active_) throw std::runtime_error("Reduction is in flight");
+#if MPI_VERSION >= 4
+        MPI_Start(&m_request_);
+#else
+        auto send = m_input_.data();
+        auto recv = m_result_.data();
+        int n     = size();
+        if(m_root_.has_value()) {
+            MPI_Ireduce(send, recv, n, m_type_, m_op_, *m_root_, m_comm_,
+                        &m_request_);
+        } else {
+            MPI_Iallreduce(send, recv, n, m_type_, m_op_, m_comm_,
+                           &m_request_);
+        }
+#endif
+        m_active_ = true;
+    }
+
+    /** @brief Copies @p input into the input buffer, then starts.
+     *
+     *  @tparam Container A contiguous container of value_type objects.
+     *
+     *  @param[in] input The local contribution. Must have size() elements.
+     *
+     *  @throw std::runtime_error if @p input has the wrong number of elements
+     *                            or if start() throws. Strong throw
+     *                            guarantee.
+     */
+    template<typename Container>
+    void start(const Container& input) {
+        if(input.size() != size())
+            throw std::runtime_error("Input has the wrong number of elements");
+        if(m_active_) throw std::runtime_error("Reduction is in flight");
+        std::copy(input.begin(), input.end(), m_input_.begin());
+        start();
+    }
+
+    /** @brief Checks, without blocking, if the reduction has finished.
+     *
+     *  This method wraps MPI_Test.
+     *
+     *  @return True if no reduction is in flight, false otherwise.
+     */
+    bool ready() {
+        if(!m_active_) return true;
+        int flag = 0;
+        MPI_Test(&m_request_, &flag, MPI_STATUS_IGNORE);
+        if(flag) m_active_ = false;
+        return !m_active_;
+    }
+
+    /// Blocks until the reduction in flight (if any) finishes
+    void wait() {
+        if(!m_active_) return;
+        MPI_Wait(&m_request_, MPI_STATUS_IGNORE);
+        m_active_ = false;
+    }
+
+    /** @brief Starts the reduction and waits for it.
+     *
+     *  @tparam Container A contiguous container of value_type objects.
+     *
+     *  @param[in] input The local contribution. Must have size() elements.
+     *
+     *  @return The result of the reduction, see result().
+     */
+    template<typename Container>
+    const buffer_type& operator()(const Container& input) {
+        start(input);
+        wait();
+        return result();
+    }
+
+    /// Exchanges the state of *this with @p other
+    void swap(PersistentReduction& other) noexcept {
+        std::swap(m_comm_, other.m_comm_);
+        std::swap(m_type_, other.m_type_);
+        std::swap(m_op_, other.m_op_);
+        std::swap(m_root_, other.m_root_);
+        std::swap(m_user_op_, other.m_user_op_);
+        std::swap(m_request_, other.m_request_);
+        std::swap(m_active_, other.m_active_);
+        m_input_.swap(other.m_input_);
+        m_result_.swap(other.m_result_);
+    }
+
+private:
+    /// Returns @p n, throwing if MPI can not count that many elements
+    static size_type checked_size_(size_type n) {
+        if(n > size_type(std::numeric_limits<int>::max()))
+            throw std::runtime_error(
+              "Can not reduce more than INT_MAX elements");
+        return n;
+    }
+
+    /// Waits on and frees the request, unless MPI has already been finalized
+    void release_() noexcept {
+        if(m_request_ == MPI_REQUEST_NULL) return;
+        int finalized = 0;
+        MPI_Finalized(&finalized);
+        if(!finalized) {
+            if(m_active_) MPI_Wait(&m_request_, MPI_STATUS_IGNORE);
+            if(m_request_ != MPI_REQUEST_NULL) MPI_Request_free(&m_request_);
+        }
+        m_request_ = MPI_REQUEST_NULL;
+        m_active_  = false;
+    }
+
+    /// The communicator the reduction is over
+    mpi_comm_type m_comm_ = MPI_COMM_NULL;
+
+    /// The MPI datatype of the elements
+    MPI_Datatype m_type_ = MPI_DATATYPE_NULL;
+
+    /// The MPI operation combining the elements
+    MPI_Op m_op_ = MPI_OP_NULL;
+
+    /// The process getting the result, unset if everyone gets it
+    opt_root_t m_root_;
+
+    /// Owns m_type_ and m_op_ if the operation is user-defined
+    UserOp<value_type> m_user_op_;
+
+    /// The persistent request (MPI-4) or the request of the reduction
+    request_type m_request_ = MPI_REQUEST_NULL;
+
+    /// Has the reduction been started, but not waited on?
+    bool m_active_ = false;
+
+    /// This process's contribution
+    std::vector<value_type> m_input_;
+
+    /// The result of the reduction
+    buffer_type m_result_;
+};
+
+} // namespace parallelzone::mpi_helpers
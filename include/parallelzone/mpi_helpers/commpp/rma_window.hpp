@@ -0,0 +1,511 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mpi.h>
+#include <parallelzone/mpi_helpers/binary_buffer/binary_view.hpp>
+#include <parallelzone/mpi_helpers/traits/contiguous_range.hpp>
+#include <parallelzone/mpi_helpers/traits/mpi_op.hpp>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace parallelzone::mpi_helpers {
+namespace detail_ {
+class RMAWindowPIMPL;
+}
+
+/** @brief A region of memory on each process which other processes can read
+ *         and write without the owning process taking part.
+ *
+ *  RMAWindow wraps an MPI window. Windows are created collectively, by
+ *  CommPP::allocate_window or CommPP::expose_window, after which each process
+ *  can put, get, and accumulate into the region of any process (including
+ *  itself). The target process does not need to make any matching call,
+ *  which is what makes Global-Arrays-style irregular access patterns
+ *  possible.
+ *
+ *  One-sided operations must happen inside an access epoch. *this supports
+ *  MPI's passive-target synchronization: lock (or lock_all) a process, issue
+ *  the operations, then unlock (which waits for them to complete at the
+ *  target) or flush (which waits without ending the epoch). RMALockGuard
+ *  manages the lock of a single target. Active-target synchronization is
+ *  limited to fence().
+ *
+ *  Offsets and counts are in elements of the type being moved, e.g., a
+ *  std::vector<double> put at offset 3 starts at byte 3 * sizeof(double) of
+ *  the target's region. Only containers whose elements can be sent as bytes
+ *  (see contiguous_range) can be moved through a window.
+ *
+ *  RMAWindow is move-only. Like creating it, destroying a window is a
+ *  collective operation (it wraps MPI_Win_free), so every process must
+ *  destroy its windows in the same order, outside of any epoch.
+ */
+class RMAWindow {
+public:
+    /// Type of the object implementing *this
+    using pimpl_type = detail_::RMAWindowPIMPL;
+
+    /// Type of a pointer to the PIMPL
+    using pimpl_pointer = std::unique_ptr<pimpl_type>;
+
+    /// Type used for ranks (same as CommPP::size_type)
+    using size_type = int;
+
+    /// Type used for offsets and counts of elements
+    using offset_type = std::size_t;
+
+    /// Type of a read/write view of the local region
+    using binary_reference = BinaryView;
+
+    /// Type of a read-only view of bytes being put
+    using const_binary_reference = ConstBinaryView;
+
+    /// Type of the MPI window *this wraps
+    using mpi_window_type = MPI_Win;
+
+    /// Kinds of passive-target locks
+    enum class lock_type {
+        shared,   ///< Other processes may hold the lock at the same time
+        exclusive ///< No other process may hold the lock
+    };
+
+    /** @brief Creates a window with no memory on any process.
+     *
+     *  Default constructed windows can not be used for communication.
+     *
+     *  @throw None No throw guarantee.
+     */
+    RMAWindow() noexcept;
+
+    /** @brief Creates a window implemented by @p pimpl.
+     *
+     *  Users should create windows with CommPP instead.
+     *
+     *  @param[in] pimpl The state of the window.
+     *
+     *  @throw None No throw guarantee.
+     */
+    explicit RMAWindow(pimpl_pointer pimpl) noexcept;
+
+    /// Deleted because MPI windows can not be copied
+    RMAWindow(const RMAWindow&) = delete;
+
+    /// Deleted because MPI windows can not be copied
+    RMAWindow& operator=(const RMAWindow&) = delete;
+
+    /** @brief Takes ownership of the window in @p other.
+     *
+     *  @param[in,out] other The window to take. After this call @p other is
+     *                       in a default constructed state.
+     *
+     *  @throw None No throw guarantee.
+     */
+    RMAWindow(RMAWindow&& other) noexcept;
+
+    /** @brief Frees the window in *this, then takes the one in @p rhs.
+     *
+     *  Freeing the window is collective, see the class description.
+     *
+     *  @param[in,out] rhs The window to take. After this call @p rhs is in a
+     *                     default constructed state.
+     *
+     *  @return *this after taking @p rhs's window.
+     *
+     *  @throw None No throw guarantee.
+     */
+    RMAWindow& operator=(RMAWindow&& rhs) noexcept;
+
+    /// Frees the window (collectively), unless MPI has been finalized
+    ~RMAWindow() noexcept;
+
+    // -------------------------------------------------------------------------
+    // -- Getters
+    // -------------------------------------------------------------------------
+
+    /** @brief The MPI window wrapped by *this.
+     *
+     *  @return The window, or MPI_WIN_NULL if *this has no window.
+     *
+     *  @throw None No throw guarantee.
+     */
+    mpi_window_type window() const noexcept;
+
+    /** @brief The number of processes sharing the window.
+     *
+     *  @return The size of the communicator the window was created on, or 0
+     *          if *this has no window.
+     *
+     *  @throw None No throw guarantee.
+     */
+    size_type size() const noexcept;
+
+    /** @brief The number of bytes process @p rank exposes.
+     *
+     *  @param[in] rank The process whose region is being asked about.
+     *
+     *  @return The size, in bytes, of @p rank's region.
+     *
+     *  @throw std::runtime_error if *this has no window. Strong throw
+     *                            guarantee.
+     *  @throw std::out_of_range if @p rank is not in [0, size()). Strong throw
+     *                           guarantee.
+     */
+    std::size_t region_size(size_type rank) const;
+
+    /** @brief The region this process exposes, as bytes.
+     *
+     *  Reading or writing the local region directly while other processes
+     *  may be accessing it requires locking this process first.
+     *
+     *  @return A view of the local region.
+     *
+     *  @throw std::runtime_error if *this has no window. Strong throw
+     *                            guarantee.
+     */
+    binary_reference local() const;
+
+    /** @brief The region this process exposes, as elements of type @p T.
+     *
+     *  @tparam T The type of the elements in the region. Trailing bytes which
+     *            do not make up a whole @p T are not part of the result.
+     *
+     *  @return A span over the local region.
+     *
+     *  @throw std::runtime_error if *this has no window. Strong throw
+     *                            guarantee.
+     */
+    template<typename T>
+    std::span<T> local_as() const {
+        auto region = local();
+        auto* p     = reinterpret_cast<T*>(region.data());
+        return std::span<T>(p, region.size() / sizeof(T));
+    }
+
+    // -------------------------------------------------------------------------
+    // -- Synchronization
+    // -------------------------------------------------------------------------
+
+    /** @brief Starts an access epoch on process @p rank (MPI_Win_lock).
+     *
+     *  @param[in] rank The process to lock.
+     *  @param[in] type Whether other processes may lock @p rank at the same
+     *                  time. Default is shared.
+     *
+     *  @throw std::runtime_error if *this has no window. Strong throw
+     *                            guarantee.
+     *  @throw std::out_of_range if @p rank is not in [0, size()). Strong throw
+     *                           guarantee.
+     */
+    void lock(size_type rank, lock_type type = lock_type::shared) const;
+
+    /** @brief Ends the access epoch on @p rank (MPI_Win_unlock).
+     *
+     *  All operations issued to @p rank since lock(rank) are complete, at the
+     *  origin and the target, when this returns.
+     *
+     *  @param[in] rank The process to unlock.
+     *
+     *  @throw std::runtime_error if *this has no window. Strong throw
+     *                            guarantee.
+     *  @throw std::out_of_range if @p rank is not in [0, size()). Strong throw
+     *                           guarantee.
+     */
+    void unlock(size_type rank) const;
+
+    /** @brief Starts a shared access epoch on every process
+     *         (MPI_Win_lock_all).
+     *
+     *  @throw std::runtime_error if *this has no window. Strong throw
+     *                            guarantee.
+     */
+    void lock_all() const;
+
+    /** @brief Ends the epoch started by lock_all (MPI_Win_unlock_all).
+     *
+     *  @throw std::runtime_error if *this has no window. Strong throw
+     *                            guarantee.
+     */
+    void unlock_all() const;
+
+    /** @brief Completes all operations issued to @p rank, without ending the
+     *         epoch (MPI_Win_flush).
+     *
+     *  @param[in] rank The process whose operations are completed.
+     *
+     *  @throw std::runtime_error if *this has no window. Strong throw
+     *                            guarantee.
+     *  @throw std::out_of_range if @p rank is not in [0, size()). Strong throw
+     *                           guarantee.
+     */
+    void flush(size_type rank) const;
+
+    /** @brief Completes all operations issued to any process, without ending
+     *         the epoch (MPI_Win_flush_all).
+     *
+     *  @throw std::runtime_error if *this has no window. Strong throw
+     *                            guarantee.
+     */
+    void flush_all() const;
+
+    /** @brief Collectively separates RMA operations (MPI_Win_fence).
+     *
+     *  Every process must call this. Operations issued before the fence are
+     *  complete after it. Fences may not be mixed with locks.
+     *
+     *  @throw std::runtime_error if *this has no window. Strong throw
+     *                            guarantee.
+     */
+    void fence() const;
+
+    // -------------------------------------------------------------------------
+    // -- One-sided Operations
+    // -------------------------------------------------------------------------
+
+    /** @brief Writes @p data into @p rank's region (MPI_Put).
+     *
+     *  Must be called inside an access epoch on @p rank. @p data may not be
+     *  modified until the operation is completed (e.g., by flush or unlock).
+     *
+     *  @tparam T A contiguous_range type, deduced from @p data.
+     *
+     *  @param[in] data   The elements to write.
+     *  @param[in] rank   The process whose region is written.
+     *  @param[in] offset Where the first element goes, in elements of @p T.
+     *
+     *  @throw std::runtime_error if *this has no window. Strong throw
+     *                            guarantee.
+     *  @throw std::out_of_range if @p rank is not a valid rank, or if @p data
+     *                           does not fit in @p rank's region at
+     *                           @p offset. Strong throw guarantee.
+     */
+    template<contiguous_range T>
+    void put(const T& data, size_type rank, offset_type offset) const {
+        const auto [p, n, disp] = bytes_(data, offset);
+        put_(const_binary_reference(p, n), rank, disp);
+    }
+
+    /** @brief Reads from @p rank's region into @p out (MPI_Get).
+     *
+     *  Must be called inside an access epoch on @p rank. @p out does not hold
+     *  the result until the operation is completed (e.g., by flush or
+     *  unlock). Reads `size(out)` elements.
+     *
+     *  @tparam T A contiguous_range type, deduced from @p out. Views (e.g.,
+     *            std::span) may be passed as temporaries.
+     *
+     *  @param[out] out   Where the elements go.
+     *  @param[in] rank   The process whose region is read.
+     *  @param[in] offset Where the first element is, in elements of @p T.
+     *
+     *  @throw std::runtime_error if *this has no window. Strong throw
+     *                            guarantee.
+     *  @throw std::out_of_range if @p rank is not a valid rank, or if the
+     *                           elements are not in @p rank's region. Strong
+     *                           throw guarantee.
+     */
+    template<contiguous_range T>
+    void get(T&& out, size_type rank, offset_type offset) const {
+        using pointer = decltype(detail_::contiguous_data(out));
+        static_assert(!std::is_const_v<std::remove_pointer_t<pointer>>,
+                      "Can not get into read-only elements");
+        const auto [p, n, disp] = bytes_(out, offset);
+        get_(binary_reference(const_cast<std::byte*>(p), n), rank, disp);
+    }
+
+    /** @brief Combines @p data with the elements in @p rank's region
+     *         (MPI_Accumulate).
+     *
+     *  Element `i` of the target becomes `op(target[i], data[i])`. Unlike
+     *  put, concurrent accumulates to the same element (with the same @p op)
+     *  are well defined, each element is updated atomically. Must be called
+     *  inside an access epoch on @p rank.
+     *
+     *  @tparam T A contiguous_range type whose elements have a predefined MPI
+     *            datatype (MPI's operations are not defined for the data
+     *            types of registered structs).
+     *  @tparam Op A functor which maps to a predefined MPI operation (MPI
+     *             does not allow user-defined operations here). Defaults to
+     *             std::plus.
+     *
+     *  @param[in] data   The elements to combine into the target.
+     *  @param[in] rank   The process whose region is updated.
+     *  @param[in] offset Where the first element is, in elements of @p T.
+     *  @param[in] op     The operation to combine the elements with.
+     *
+     *  @throw std::runtime_error if *this has no window. Strong throw
+     *                            guarantee.
+     *  @throw std::out_of_range if @p rank is not a valid rank, or if the
+     *                           elements are not in @p rank's region. Strong
+     *                           throw guarantee.
+     */
+    template<contiguous_range T,
+             typename Op = std::plus<contiguous_value_t<T>>>
+    void accumulate(const T& data, size_type rank, offset_type offset,
+                    [[maybe_unused]] Op op = {}) const {
+        using value_type = contiguous_value_t<T>;
+        static_assert(is_predefined_mpi_type_v<value_type>,
+                      "Accumulate requires elements with a predefined MPI "
+                      "datatype");
+        static_assert(has_mpi_op_v<Op>,
+                      "Accumulate requires a predefined MPI operation");
+        const auto [p, n, disp] = bytes_(data, offset);
+        accumulate_(p, n / sizeof(value_type), MPIDataType<value_type>::type(),
+                    mpi_op_v<Op>, rank, disp);
+    }
+
+    /** @brief Atomically combines @p value with one element of @p rank's
+     *         region, returning the element's old value (MPI_Fetch_and_op).
+     *
+     *  The element at @p offset becomes `op(old, value)` and `old` is
+     *  returned. Like accumulate, concurrent calls on the same element are
+     *  atomic with respect to one another, which makes this the building
+     *  block for shared counters (e.g., fetch-and-add with std::plus). Must
+     *  be called inside an access epoch on @p rank. Unlike the other
+     *  one-sided operations this one blocks until the result has arrived
+     *  (it flushes @p rank).
+     *
+     *  @tparam T The type of the element. Must have a predefined MPI
+     *            datatype.
+     *  @tparam Op A functor which maps to a predefined MPI operation.
+     *             Defaults to std::plus.
+     *
+     *  @param[in] value  The value to combine into the target.
+     *  @param[in] rank   The process whose region is updated.
+     *  @param[in] offset Which element to update, in elements of @p T.
+     *  @param[in] op     The operation to combine the values with.
+     *
+     *  @return The value of the element before @p op was applied.
+     *
+     *  @throw std::runtime_error if *this has no window. Strong throw
+     *                            guarantee.
+     *  @throw std::out_of_range if @p rank is not a valid rank, or if the
+     *                           element is not in @p rank's region. Strong
+     *                           throw guarantee.
+     */
+    template<typename T, typename Op = std::plus<T>>
+    T fetch_and_op(const T& value, size_type rank, offset_type offset,
+                   [[maybe_unused]] Op op = {}) const {
+        static_assert(is_predefined_mpi_type_v<T>,
+                      "Fetch-and-op requires a predefined MPI datatype");
+        static_assert(has_mpi_op_v<Op>,
+                      "Fetch-and-op requires a predefined MPI operation");
+        T old{};
+        fetch_and_op_(&value, &old, MPIDataType<T>::type(), mpi_op_v<Op>, rank,
+                      offset * sizeof(T));
+        return old;
+    }
+
+    /** @brief Exchanges the states of *this and @p other.
+     *
+     *  @param[in,out] other The window to swap with.
+     *
+     *  @throw None No throw guarantee.
+     */
+    void swap(RMAWindow& other) noexcept;
+
+private:
+    /// Code factorization for checking if *this has a PIMPL
+    bool has_pimpl_() const noexcept;
+
+    /// Returns the PIMPL, throws if there isn't one
+    const pimpl_type& pimpl_() const;
+
+    /// Pointer to the bytes of @p data, their number, and the byte offset
+    template<typename T>
+    static auto bytes_(const T& data, offset_type offset) {
+        using value_type = contiguous_value_t<T>;
+        const auto* p = reinterpret_cast<const std::byte*>(
+          detail_::contiguous_data(data));
+        const auto n = detail_::contiguous_size(data) * sizeof(value_type);
+        return std::make_tuple(p, n, offset * sizeof(value_type));
+    }
+
+    /// Wraps a call to m_pimpl_->put(data, rank, disp)
+    void put_(const_binary_reference data, size_type rank,
+              std::size_t disp) const;
+
+    /// Wraps a call to m_pimpl_->get(out, rank, disp)
+    void get_(binary_reference out, size_type rank, std::size_t disp) const;
+
+    /// Wraps a call to m_pimpl_->accumulate(data, n, type, op, rank, disp)
+    void accumulate_(const void* data, std::size_t n, MPI_Datatype type,
+                     MPI_Op op, size_type rank, std::size_t disp) const;
+
+    /// Wraps a call to m_pimpl_->fetch_and_op(value, old, type, op, rank, disp)
+    void fetch_and_op_(const void* value, void* old, MPI_Datatype type,
+                       MPI_Op op, size_type rank, std::size_t disp) const;
+
+    /// The object actually implementing *this
+    pimpl_pointer m_pimpl_;
+};
+
+/** @brief Holds a passive-target lock on one process of an RMAWindow.
+ *
+ *  The lock is taken in the ctor and released (completing all operations
+ *  issued to the process) in the dtor, so the lock is released even if an
+ *  exception is thrown while it is held.
+ */
+class RMALockGuard {
+public:
+    /// Type of the window being locked
+    using window_type = RMAWindow;
+
+    /// Type of a rank
+    using size_type = window_type::size_type;
+
+    /// Type of the kind of lock
+    using lock_type = window_type::lock_type;
+
+    /** @brief Locks @p rank of @p window.
+     *
+     *  @param[in] window The window to lock. Must outlive *this.
+     *  @param[in] rank   The process to lock.
+     *  @param[in] type   The kind of lock. Default is shared.
+     *
+     *  @throw std::runtime_error if @p window has no window. Strong throw
+     *                            guarantee.
+     *  @throw std::out_of_range if @p rank is not a valid rank. Strong throw
+     *                           guarantee.
+     */
+    RMALockGuard(const window_type& window, size_type rank,
+                 lock_type type = lock_type::shared) :
+      m_window_(window), m_rank_(rank) {
+        m_window_.lock(m_rank_, type);
+    }
+
+    /// Deleted because the lock can only be released once
+    RMALockGuard(const RMALockGuard&) = delete;
+
+    /// Deleted because the lock can only be released once
+    RMALockGuard& operator=(const RMALockGuard&) = delete;
+
+    /// Releases the lock
+    ~RMALockGuard() noexcept { m_window_.unlock(m_rank_); }
+
+private:
+    /// The window being locked
+    const window_type& m_window_;
+
+    /// The process being locked
+    size_type m_rank_;
+};
+
+} // namespace parallelzone::mpi_helpers
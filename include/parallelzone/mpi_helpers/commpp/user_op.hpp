@@ -0,0 +1,182 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <mpi.h>
+#include <parallelzone/mpi_helpers/traits/mpi_data_type.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace parallelzone::mpi_helpers {
+
+/** @brief Registers an arbitrary callable as an MPI operation.
+ *
+ *  MPI only knows how to reduce with a handful of built-in operations (see
+ *  MPIOp). Anything else has to be registered with MPI_Op_create, which takes
+ *  a plain function pointer with no way to pass along state. UserOp gets
+ *  around this by storing the callable in an attribute of a private duplicate
+ *  of T's MPI datatype. MPI hands that datatype to the registered function,
+ *  which looks the callable back up and applies it element-wise. Since the
+ *  reduction is then done by MPI, it uses MPI's reduction algorithms (e.g.,
+ *  trees) rather than gathering everything to one process.
+ *
+ *  Reductions using a UserOp must use type() as their datatype and op() as
+ *  their operation. Since errors can not be thrown through MPI, reducing
+ *  any other datatype with op() aborts the program. The MPI objects are
+ *  freed when the last copy of the UserOp is destroyed (unless MPI has been
+ *  finalized by then).
+ *
+ *  If the callable is commutative, MPI is free to combine the contributions
+ *  in any order. Otherwise, MPI combines them in rank order, i.e., the result
+ *  is @f$x_0 \otimes x_1 \otimes \ldots \otimes x_{P-1}@f$. Either way the
+ *  callable must be associative.
+ *
+ *  @tparam T The type of the objects being reduced. Must have an MPI datatype.
+ */
+template<typename T>
+class UserOp {
+public:
+    /// Type of the objects being reduced
+    using value_type = T;
+
+    /// Type of the type-erased callable
+    using function_type = std::function<value_type(const T&, const T&)>;
+
+    static_assert(has_mpi_data_type_v<value_type>, "Is a recognized MPI type?");
+
+    /** @brief Creates a UserOp which does not wrap a callable.
+     *
+     *  @throw None No throw guarantee.
+     */
+    UserOp() noexcept = default;
+
+    /** @brief Registers @p fxn with MPI.
+     *
+     *  @tparam Fxn The type of a callable taking two (const references to)
+     *              value_type objects and returning something convertible to
+     *              value_type.
+     *
+     *  @param[in] fxn         The callable to register.
+     *  @param[in] commutative Can MPI change the order of the arguments?
+     *                         Default is false, which is always correct, but
+     *                         may be slower.
+     *
+     *  @throw std::bad_alloc if allocating the state fails. Strong throw
+     *                        guarantee.
+     */
+    template<typename Fxn, typename = std::enable_if_t<
+                             !std::is_same_v<std::decay_t<Fxn>, UserOp>>>
+    explicit UserOp(Fxn&& fxn, bool commutative = false) :
+      m_state_(std::make_shared<state_type>(
+        function_type(std::forward<Fxn>(fxn)), commutative)) {}
+
+    /// Does *this wrap a callable?
+    bool valid() const noexcept { return static_cast<bool>(m_state_); }
+
+    /// The MPI operation, MPI_OP_NULL if not valid()
+    MPI_Op op() const noexcept { return valid() ? m_state_->op : MPI_OP_NULL; }
+
+    /// The datatype reductions with op() must use
+    MPI_Datatype type() const noexcept {
+        return valid() ? m_state_->type : MPI_DATATYPE_NULL;
+    }
+
+    /// Was the callable registered as commutative?
+    bool commutative() const noexcept {
+        return valid() && m_state_->commutative;
+    }
+
+    /** @brief Calls the wrapped callable.
+     *
+     *  @param[in] lhs The first argument.
+     *  @param[in] rhs The second argument.
+     *
+     *  @return The result of calling the callable with @p lhs and @p rhs.
+     *
+     *  @throw std::bad_function_call if *this is not valid(). Strong throw
+     *                                guarantee.
+     */
+    value_type operator()(const T& lhs, const T& rhs) const {
+        if(!valid()) throw std::bad_function_call();
+        return m_state_->fxn(lhs, rhs);
+    }
+
+private:
+    /// The callable and the MPI objects it is registered with
+    struct state_type {
+        state_type(function_type f, bool commute) :
+          fxn(std::move(f)), commutative(commute) {
+            MPI_Type_dup(MPIDataType<value_type>::type(), &type);
+            MPI_Type_set_attr(type, keyval_(), &fxn);
+            MPI_Op_create(&apply_, commutative, &op);
+        }
+
+        ~state_type() noexcept {
+            int finalized = 0;
+            MPI_Finalized(&finalized);
+            if(finalized) return;
+            MPI_Op_free(&op);
+            MPI_Type_free(&type);
+        }
+
+        state_type(const state_type&)            = delete;
+        state_type& operator=(const state_type&) = delete;
+
+        function_type fxn;
+        bool commutative;
+        MPI_Datatype type = MPI_DATATYPE_NULL;
+        MPI_Op op         = MPI_OP_NULL;
+    };
+
+    /// The attribute key the callable is stored under (made on first use)
+    static int keyval_() {
+        static const int keyval = []() {
+            int rv;
+            MPI_Type_create_keyval(MPI_TYPE_NULL_COPY_FN,
+                                   MPI_TYPE_NULL_DELETE_FN, &rv, nullptr);
+            return rv;
+        }();
+        return keyval;
+    }
+
+    /// The function registered with MPI, inout[i] = fxn(in[i], inout[i])
+    static void apply_(void* in, void* inout, int* len, MPI_Datatype* type) {
+        void* attr = nullptr;
+        int found  = 0;
+        MPI_Type_get_attr(*type, keyval_(), &attr, &found);
+
+        // N.B. Exceptions can't propagate out of MPI, so this is fatal
+        if(!found || attr == nullptr) {
+            std::fprintf(stderr, "UserOp: reduction called with a datatype "
+                                 "other than UserOp::type()\n");
+            MPI_Abort(MPI_COMM_WORLD, 1);
+            return;
+        }
+        const auto& fxn = *static_cast<const function_type*>(attr);
+
+        const auto* lhs = static_cast<const value_type*>(in);
+        auto* rhs       = static_cast<value_type*>(inout);
+        for(int i = 0; i < *len; ++i) rhs[i] = fxn(lhs[i], rhs[i]);
+    }
+
+    /// Shared by all copies of *this
+    std::shared_ptr<state_type> m_state_;
+};
+
+} // namespace parallelzone::mpi_helpers
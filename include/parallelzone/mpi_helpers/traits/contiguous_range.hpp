@@ -0,0 +1,229 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <ranges>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace parallelzone::mpi_helpers {
+class BinaryBuffer;
+class BinaryView;
+class ConstBinaryView;
+
+/** @brief Opt-in trait for containers which store their elements contiguously
+ *
+ *  Containers modeling std::ranges::contiguous_range (std::vector,
+ *  std::array, std::span, std::valarray, ...) are detected automatically.
+ *  Containers which only expose their elements through `data()` and `size()`
+ *  members (e.g., a block of a tensor) should specialize this trait to inherit
+ *  from std::true_type. Such containers must also define `value_type`.
+ *
+ *  @tparam T The container type being registered.
+ */
+template<typename T>
+struct IsContiguousContainer : std::false_type {};
+
+namespace detail_ {
+
+/// A standard contiguous range whose elements can be copied as bytes
+template<typename T>
+concept trivially_copyable_range =
+  std::ranges::contiguous_range<T> && std::ranges::sized_range<T> &&
+  std::is_trivially_copyable_v<std::ranges::range_value_t<T>>;
+
+/// A container registered via IsContiguousContainer
+template<typename T>
+concept registered_container =
+  IsContiguousContainer<T>::value &&
+  std::is_trivially_copyable_v<typename T::value_type> && requires(T& t) {
+      { t.data() } -> std::convertible_to<const typename T::value_type*>;
+      { t.size() } -> std::convertible_to<std::size_t>;
+  };
+
+/// A container which can be made to hold any number of elements
+template<typename T>
+concept resizable_container =
+  std::default_initializable<T> && requires(T& t, std::size_t n) {
+      t.data();
+      t.resize(n);
+  };
+
+} // namespace detail_
+
+/** @brief Can objects of type @p T be sent as raw bytes?
+ *
+ *  Types satisfying this concept are sent by MPI directly from (and received
+ *  directly into) their storage, i.e., they do not need to be serialized. This
+ *  is the case for contiguous ranges of trivially copyable elements and for
+ *  containers registered with IsContiguousContainer.
+ *
+ *  @tparam T The type being inspected. cv-qualifiers and references are
+ *            ignored.
+ */
+template<typename T>
+concept contiguous_range =
+  detail_::trivially_copyable_range<std::remove_cvref_t<T>> ||
+  detail_::registered_container<std::remove_cvref_t<T>>;
+
+namespace detail_ {
+
+/// Pointer to the first element of @p c (prefers a data() member)
+template<typename T>
+auto contiguous_data(T&& c) noexcept {
+    if constexpr(requires { c.data(); }) {
+        return c.data();
+    } else {
+        return std::ranges::data(c);
+    }
+}
+
+/// Number of elements in @p c (prefers a size() member)
+template<typename T>
+std::size_t contiguous_size(const T& c) noexcept {
+    if constexpr(requires { c.size(); }) {
+        return c.size();
+    } else {
+        return std::ranges::size(c);
+    }
+}
+
+/** @brief Makes @p c hold @p n elements.
+ *
+ *  Containers which can not be resized (e.g., std::array) are left alone, but
+ *  must already hold @p n elements.
+ *
+ *  @throw std::runtime_error if @p c can not be resized and does not hold
+ *                            @p n elements. Strong throw guarantee.
+ */
+template<typename T>
+void resize_contiguous(T& c, std::size_t n) {
+    if constexpr(requires { c.resize(n); }) {
+        c.resize(n);
+    } else if constexpr(std::is_constructible_v<T, std::size_t>) {
+        c = T(n);
+    } else if(contiguous_size(c) != n) {
+        throw std::runtime_error("Container has the wrong number of elements");
+    }
+}
+
+} // namespace detail_
+
+/// The type of the elements of the contiguous range @p T
+template<typename T>
+using contiguous_value_t = std::remove_cv_t<std::remove_pointer_t<
+  decltype(detail_::contiguous_data(std::declval<T&>()))>>;
+
+/** @brief Works out the container data received as a @p T is stored in.
+ *
+ *  Receiving data requires a container which owns its elements and which can
+ *  be made to hold any number of them. If @p T is such a container (e.g.,
+ *  std::vector or std::string) the result is @p T. Otherwise (e.g., @p T is
+ *  a std::array, std::span, or std::valarray) the result is a std::vector of
+ *  the elements of @p T. Types which are not contiguous ranges map to
+ *  themselves.
+ *
+ *  @tparam T The unqualified type being inspected.
+ */
+template<typename T>
+struct ContiguousResult {
+    /// The type of the container
+    using type = T;
+};
+
+/// Specializes ContiguousResult for ranges we can't (or shouldn't) resize
+template<typename T>
+    requires(contiguous_range<T> && !detail_::resizable_container<T>)
+struct ContiguousResult<T> {
+    /// The type of the container
+    using type = std::vector<contiguous_value_t<T>>;
+};
+
+/// BinaryBuffer is made to hold n bytes with its ctor
+template<>
+struct ContiguousResult<BinaryBuffer> {
+    /// The type of the container
+    using type = BinaryBuffer;
+};
+
+/// Data received as a BinaryView is stored in a BinaryBuffer
+template<>
+struct ContiguousResult<BinaryView> {
+    /// The type of the container
+    using type = BinaryBuffer;
+};
+
+/// Data received as a ConstBinaryView is stored in a BinaryBuffer
+template<>
+struct ContiguousResult<ConstBinaryView> {
+    /// The type of the container
+    using type = BinaryBuffer;
+};
+
+/// Convenience type for accessing ContiguousResult<T>::type
+template<typename T>
+using contiguous_result_t = typename ContiguousResult<T>::type;
+
+/** @brief Works out the type which owns a copy of a @p T.
+ *
+ *  Operations which return the same number of elements they were given (e.g.,
+ *  broadcast and reduce) return @p T, unless @p T is a view (std::span,
+ *  std::string_view, BinaryView, ...). Views do not own their elements, so
+ *  for them the result is contiguous_result_t<T>.
+ *
+ *  @tparam T The unqualified type being inspected.
+ */
+template<typename T>
+using contiguous_owner_t =
+  std::conditional_t<std::ranges::borrowed_range<T> ||
+                       std::is_same_v<T, BinaryView> ||
+                       std::is_same_v<T, ConstBinaryView>,
+                     contiguous_result_t<T>, T>;
+
+namespace detail_ {
+
+/// Makes an instance of @p T holding @p n (value-initialized) elements
+template<typename T>
+T make_contiguous(std::size_t n) {
+    T rv{};
+    resize_contiguous(rv, n);
+    return rv;
+}
+
+/** @brief Converts @p c into a contiguous_owner_t.
+ *
+ *  If @p c already owns its elements it is forwarded (i.e., rvalues are moved
+ *  and lvalues copied), otherwise its elements are copied into a new owner.
+ */
+template<typename T>
+contiguous_owner_t<std::decay_t<T>> to_contiguous_owner(T&& c) {
+    using owner_type = contiguous_owner_t<std::decay_t<T>>;
+    if constexpr(std::is_same_v<owner_type, std::decay_t<T>>) {
+        return std::forward<T>(c);
+    } else {
+        const auto* p = contiguous_data(c);
+        auto rv       = make_contiguous<owner_type>(contiguous_size(c));
+        std::copy(p, p + contiguous_size(c), contiguous_data(rv));
+        return rv;
+    }
+}
+
+} // namespace detail_
+} // namespace parallelzone::mpi_helpers
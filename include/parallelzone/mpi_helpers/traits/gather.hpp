@@ -35,7 +35,9 @@ namespace parallelzone::mpi_helpers {
  *  we directly pass the @p T object to gather, the hard part is where we go
  *  from there. If @p T is something like std::vector<double> we could get
  *  back a return of std::vector<std::vector<double>>, but a return of
- *  std::vector<double> is more efficient (i.e., we flatten it).
+ *  std::vector<double> is more efficient (i.e., we flatten it). Containers
+ *  which can not hold the flattened result (e.g., std::array or std::span)
+ *  are flattened into the container given by contiguous_result_t.
  *
  *  All of this logic is wrapped up in this type def.
  *
@@ -45,6 +47,7 @@ namespace parallelzone::mpi_helpers {
  */
 template<typename T>
 using gather_return_t =
-  std::optional<std::conditional_t<needs_serialized_v<T>, std::vector<T>, T>>;
+  std::optional<std::conditional_t<needs_serialized_v<T>, std::vector<T>,
+                                   contiguous_result_t<T>>>;
 
 } // namespace parallelzone::mpi_helpers
@@ -18,9 +18,41 @@
 #include <complex>
 #include <mpi.h>
 #include <type_traits>
+#include <utility>
 
 namespace parallelzone::mpi_helpers {
 
+/** @brief A value and the index it came from.
+ *
+ *  MPI's MINLOC and MAXLOC operations reduce pairs made of a value and an
+ *  integer index (usually the rank the value came from), and only work with
+ *  the pair types MPI predefines. ValueLoc has the same layout as those pair
+ *  types, so arrays of ValueLoc objects can be reduced with min_loc and
+ *  max_loc (see mpi_op.hpp).
+ *
+ *  @tparam T The type of the value. ValueLoc<T> only maps to an MPI data
+ *            type for @p T being float, double, long double, short, int, or
+ *            long.
+ */
+template<typename T>
+struct ValueLoc {
+    /// The value being compared
+    T value;
+
+    /// Where the value came from
+    int loc;
+
+    /// Are the values and the locations the same?
+    bool operator==(const ValueLoc& rhs) const noexcept {
+        return value == rhs.value && loc == rhs.loc;
+    }
+
+    /// Is any part of *this different from @p rhs?
+    bool operator!=(const ValueLoc& rhs) const noexcept {
+        return !(*this == rhs);
+    }
+};
+
 /** @brief Primary template for mapping type @p T to its MPI enum.
  *
  *  Each MPI implementation needs to define MPI enumerations for types like
@@ -31,7 +63,8 @@ namespace parallelzone::mpi_helpers {
  *  MPIDataType<T>::value will be false. Second, if @p T maps to an MPI data
  *  type, then MPIDataType<T>::type() will return this type (N.B. this is a
  *  function and not a typedef to get around weirdness with how various MPI
- *  vendors implement the enumerations).
+ *  vendors implement the enumerations). Types which map to a data type MPI
+ *  predefines also have MPIDataType<T>::is_predefined set to true.
  *
  *  @tparam T The type we are mapping to an MPI data type.
  */
@@ -42,6 +75,7 @@ struct MPIDataType : std::false_type {};
 #define REGISTER_TYPE(cxx_type, mpi_type)           \
     template<>                                      \
     struct MPIDataType<cxx_type> : std::true_type { \
+        static constexpr bool is_predefined = true; \
         static auto type() { return mpi_type; }     \
     }
 
@@ -49,11 +83,13 @@ REGISTER_TYPE(char, MPI_CHAR);
 REGISTER_TYPE(signed short, MPI_SHORT);
 REGISTER_TYPE(signed int, MPI_INT);
 REGISTER_TYPE(signed long, MPI_LONG);
+REGISTER_TYPE(signed long long, MPI_LONG_LONG);
 REGISTER_TYPE(signed char, MPI_SIGNED_CHAR);
 REGISTER_TYPE(unsigned char, MPI_UNSIGNED_CHAR);
 REGISTER_TYPE(unsigned short, MPI_UNSIGNED_SHORT);
 REGISTER_TYPE(unsigned int, MPI_UNSIGNED);
 REGISTER_TYPE(unsigned long int, MPI_UNSIGNED_LONG);
+REGISTER_TYPE(unsigned long long, MPI_UNSIGNED_LONG_LONG);
 REGISTER_TYPE(float, MPI_FLOAT);
 REGISTER_TYPE(double, MPI_DOUBLE);
 REGISTER_TYPE(long double, MPI_LONG_DOUBLE);
@@ -62,6 +98,12 @@ REGISTER_TYPE(std::complex<float>, MPI_C_FLOAT_COMPLEX);
 REGISTER_TYPE(std::complex<double>, MPI_C_DOUBLE_COMPLEX);
 REGISTER_TYPE(std::complex<long double>, MPI_C_LONG_DOUBLE_COMPLEX);
 REGISTER_TYPE(std::byte, MPI_BYTE);
+REGISTER_TYPE(ValueLoc<float>, MPI_FLOAT_INT);
+REGISTER_TYPE(ValueLoc<double>, MPI_DOUBLE_INT);
+REGISTER_TYPE(ValueLoc<long double>, MPI_LONG_DOUBLE_INT);
+REGISTER_TYPE(ValueLoc<signed short>, MPI_SHORT_INT);
+REGISTER_TYPE(ValueLoc<signed int>, MPI_2INT);
+REGISTER_TYPE(ValueLoc<signed long>, MPI_LONG_INT);
 
 #undef REGISTER_TYPE
 
@@ -69,12 +111,144 @@ REGISTER_TYPE(std::byte, MPI_BYTE);
 template<typename T>
 static constexpr bool has_mpi_data_type_v = MPIDataType<T>::value;
 
+namespace detail_ {
+
+/// MPIDataType<T>::is_predefined, or false if it isn't declared
+template<typename T, typename = void>
+struct IsPredefined : std::false_type {};
+
+template<typename T>
+struct IsPredefined<T, std::void_t<decltype(MPIDataType<T>::is_predefined)>>
+  : std::bool_constant<MPIDataType<T>::is_predefined> {};
+
+} // namespace detail_
+
+/** @brief Convenience variable for determining if @p T maps to a data type
+ *         MPI predefines.
+ *
+ *  MPI's predefined operations (MPI_SUM, MPI_MIN, etc.) are only defined for
+ *  predefined data types, so derived data types (e.g., those of structs
+ *  registered with PZ_REGISTER_MPI_STRUCT) have to be reduced with a UserOp.
+ *
+ *  @tparam T The type to check.
+ */
+template<typename T>
+static constexpr bool is_predefined_mpi_type_v =
+  detail_::IsPredefined<T>::value;
+
+namespace detail_ {
+
+/// Commits @p type and arranges for it to be freed by MPI_Finalize
+inline MPI_Datatype commit_until_finalize(MPI_Datatype type) {
+    MPI_Type_commit(&type);
+
+    // MPI_Finalize deletes MPI_COMM_SELF's attributes before anything else
+    auto free_type = [](MPI_Comm, int, void* p, void*) {
+        auto* p_type = static_cast<MPI_Datatype*>(p);
+        MPI_Type_free(p_type);
+        delete p_type;
+        return MPI_SUCCESS;
+    };
+    int keyval;
+    MPI_Comm_create_keyval(MPI_COMM_NULL_COPY_FN, free_type, &keyval, nullptr);
+    MPI_Comm_set_attr(MPI_COMM_SELF, keyval, new MPI_Datatype(type));
+    MPI_Comm_free_keyval(&keyval);
+    return type;
+}
+
+} // namespace detail_
+
+/** @brief Builds the MPI data type of a trivially copyable struct.
+ *
+ *  MPI can only describe a struct if it is told the type and offset of each
+ *  member. This class works that out from pointers to the members of @p T
+ *  and builds the data type with MPI_Type_create_struct. Members may be of
+ *  any type with an MPI data type (including other registered structs) or
+ *  arrays thereof. The extent of the data type is sizeof(T), so arrays of
+ *  @p T (e.g., the elements of a std::vector<T>) are described correctly
+ *  even if @p T has padding.
+ *
+ *  The data type is built and committed the first time type() is called,
+ *  which must happen after MPI is initialized, and is freed by MPI_Finalize.
+ *  Every member which should be sent must be listed; the others (and any
+ *  padding) are left untouched on the receiving end.
+ *
+ *  Usually this class is used through PZ_REGISTER_MPI_STRUCT rather than
+ *  directly.
+ *
+ *  @tparam T The struct being described. Must be trivially copyable and
+ *            default constructible.
+ *  @tparam Members Pointers to the members of @p T, e.g., `&T::idx`.
+ */
+template<typename T, auto... Members>
+struct MPIStruct : std::true_type {
+    static_assert(std::is_trivially_copyable_v<T>, "Is trivially copyable?");
+    static_assert(sizeof...(Members) > 0, "Has at least one member?");
+
+    /// MPI's predefined operations don't work on derived data types
+    static constexpr bool is_predefined = false;
+
+    /// The (cached) MPI data type for @p T
+    static MPI_Datatype type() {
+        static const MPI_Datatype rv = make_type_();
+        return rv;
+    }
+
+private:
+    /// Type of the member @p Member points to
+    template<auto Member>
+    using member_type =
+      std::remove_reference_t<decltype(std::declval<T&>().*Member)>;
+
+    /// Type of the elements of @p Member (itself, unless it's an array)
+    template<auto Member>
+    using element_type = std::remove_all_extents_t<member_type<Member>>;
+
+    /// Number of elements in @p Member (1, unless it's an array)
+    template<auto Member>
+    static constexpr int length_ =
+      sizeof(member_type<Member>) / sizeof(element_type<Member>);
+
+    /// Builds and commits the data type
+    static MPI_Datatype make_type_() {
+        static_assert((has_mpi_data_type_v<element_type<Members>> && ...),
+                      "Is each member a type MPI knows about?");
+        constexpr int n = sizeof...(Members);
+        int lengths[n]{length_<Members>...};
+        MPI_Datatype types[n]{MPIDataType<element_type<Members>>::type()...};
+
+        const T dummy{};
+        MPI_Aint base;
+        MPI_Get_address(&dummy, &base);
+        MPI_Aint disp[n]{address_(dummy.*Members)...};
+        for(auto& x : disp) x = MPI_Aint_diff(x, base);
+
+        MPI_Datatype packed, rv;
+        MPI_Type_create_struct(n, lengths, disp, types, &packed);
+        MPI_Type_create_resized(packed, 0, sizeof(T), &rv);
+        MPI_Type_free(&packed);
+        return detail_::commit_until_finalize(rv);
+    }
+
+    /// Wraps MPI_Get_address
+    template<typename U>
+    static MPI_Aint address_(const U& member) {
+        MPI_Aint rv;
+        MPI_Get_address(&member, &rv);
+        return rv;
+    }
+};
+
 /** @brief Convenience variable for getting the MPI data type @p T maps to.
  *
  *  Attempting to use this variable with a type @p T for which
  *  `has_mpi_data_type_v<T>` is false will result in a compile error along the
  *  lines of "MPIDataType<T> has no member type()".
  *
+ *  N.B. This variable is initialized before MPI is, so it only works for the
+ *  data types MPI predefines. For structs registered with
+ *  PZ_REGISTER_MPI_STRUCT call MPIDataType<T>::type() instead.
+ *
  *  @tparam T The type to map to its MPI data type.
  */
 template<typename T>
@@ -96,3 +270,22 @@ using enable_if_has_mpi_data_type_t =
   std::enable_if_t<has_mpi_data_type_v<T>, U>;
 
 } // namespace parallelzone::mpi_helpers
+
+/** @brief Registers the trivially copyable struct @p cxx_type with MPI.
+ *
+ *  After registration, @p cxx_type has an MPI data type (see MPIStruct), so
+ *  std::vector<cxx_type> can be reduced (e.g., with a UserOp) and sent with
+ *  MPI's knowledge of the layout. Must be used at global scope, e.g.:
+ *
+ *  ```
+ *  struct IdxVal { int idx; double val; };
+ *  PZ_REGISTER_MPI_STRUCT(IdxVal, &IdxVal::idx, &IdxVal::val);
+ *  ```
+ *
+ *  @param[in] cxx_type The struct to register.
+ *  @param[in] ... Pointers to the members of @p cxx_type to send.
+ */
+#define PZ_REGISTER_MPI_STRUCT(cxx_type, ...)                  \
+    template<>                                                 \
+    struct parallelzone::mpi_helpers::MPIDataType<cxx_type>    \
+      : parallelzone::mpi_helpers::MPIStruct<cxx_type, __VA_ARGS__> {}
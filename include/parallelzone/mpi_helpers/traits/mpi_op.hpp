@@ -18,9 +18,74 @@
 #include <algorithm>
 #include <functional>
 #include <mpi.h>
+#include <parallelzone/mpi_helpers/traits/mpi_data_type.hpp>
 
 namespace parallelzone::mpi_helpers {
 
+/** @brief Functor returning the smaller of two objects.
+ *
+ *  The C++ standard library has std::min, but no functor version of it
+ *  (std::less compares, it does not select). This functor fills that gap and
+ *  maps to MPI_MIN.
+ *
+ *  @tparam T The type of the objects being compared.
+ */
+template<typename T>
+struct minimum {
+    /// Returns @p lhs if @p rhs is not smaller than it, else @p rhs
+    constexpr const T& operator()(const T& lhs, const T& rhs) const {
+        return std::min(lhs, rhs);
+    }
+};
+
+/** @brief Functor returning the larger of two objects.
+ *
+ *  This is the maximum analog of minimum and maps to MPI_MAX.
+ *
+ *  @tparam T The type of the objects being compared.
+ */
+template<typename T>
+struct maximum {
+    /// Returns @p lhs if @p rhs is not larger than it, else @p rhs
+    constexpr const T& operator()(const T& lhs, const T& rhs) const {
+        return std::max(lhs, rhs);
+    }
+};
+
+/** @brief Functor selecting the smaller value, and where it came from.
+ *
+ *  This functor maps to MPI_MINLOC, i.e., reducing an array of ValueLoc
+ *  objects with it gives the minimum value and its location (the "argmin").
+ *  Ties are broken in favor of the smaller location, as MPI does.
+ *
+ *  @tparam T A ValueLoc instantiation.
+ */
+template<typename T>
+struct min_loc {
+    /// Returns the pair with the smaller value (smaller loc if tied)
+    constexpr T operator()(const T& lhs, const T& rhs) const {
+        if(lhs.value < rhs.value) return lhs;
+        if(rhs.value < lhs.value) return rhs;
+        return T{lhs.value, std::min(lhs.loc, rhs.loc)};
+    }
+};
+
+/** @brief Functor selecting the larger value, and where it came from.
+ *
+ *  This is the maximum analog of min_loc and maps to MPI_MAXLOC.
+ *
+ *  @tparam T A ValueLoc instantiation.
+ */
+template<typename T>
+struct max_loc {
+    /// Returns the pair with the larger value (smaller loc if tied)
+    constexpr T operator()(const T& lhs, const T& rhs) const {
+        if(rhs.value < lhs.value) return lhs;
+        if(lhs.value < rhs.value) return rhs;
+        return T{lhs.value, std::min(lhs.loc, rhs.loc)};
+    }
+};
+
 /** @brief Maps a functor to an MPI operation.
  *
  *  In C++ when an algorithm needs a generic function, one typically passes a
@@ -54,6 +119,10 @@ REGISTER_OP(std::bit_and, MPI_BAND);
 REGISTER_OP(std::logical_or, MPI_LOR);
 REGISTER_OP(std::bit_or, MPI_BOR);
 REGISTER_OP(std::bit_xor, MPI_BXOR);
+REGISTER_OP(minimum, MPI_MIN);
+REGISTER_OP(maximum, MPI_MAX);
+REGISTER_OP(min_loc, MPI_MINLOC);
+REGISTER_OP(max_loc, MPI_MAXLOC);
 
 #undef REGISTER_OP
 
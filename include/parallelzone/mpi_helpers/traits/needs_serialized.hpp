@@ -15,7 +15,9 @@
  */
 
 #pragma once
+#include <parallelzone/mpi_helpers/traits/contiguous_range.hpp>
 #include <parallelzone/mpi_helpers/traits/mpi_data_type.hpp>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -28,7 +30,9 @@ class ConstBinaryView;
  *
  *  This is the primary template. When this template is picked NeedsSerialized
  *  will contain a static member `value` set to true. Users should specialize
- *  this class for types that do not need serialized.
+ *  this class for types that do not need serialized. Containers which store
+ *  their elements contiguously should instead specialize
+ *  IsContiguousContainer, which also tells CommPP how to access the elements.
  *
  *  @tparam T The type we are inspecting.
  */
@@ -39,17 +43,16 @@ struct NeedsSerialized : std::true_type {};
 template<>
 struct NeedsSerialized<std::string> : std::false_type {};
 
-/** @brief Specialization for std::vector<T> (@p T trivially copyable)
- *
- *  Trivially copyable types are stored contiguously, thus a std::vector of
- *  them does not need to be serialized (it's perhaps worth noting that
- *  std::vector itself is not trivially copyable).
+/** @brief Specialization for contiguous ranges of trivially copyable elements
  *
+ *  This covers std::vector<T>, std::array<T, N>, std::span<T>, and
+ *  std::valarray<T> (for trivially copyable T), as well as containers
+ *  registered with IsContiguousContainer. The elements of such containers can
+ *  be sent as raw bytes (it's perhaps worth noting that most of the containers
+ *  themselves are not trivially copyable).
  */
-template<typename T>
-struct NeedsSerialized<std::vector<T>,
-                       std::enable_if_t<std::is_trivially_copyable_v<T>>>
-  : std::false_type {};
+template<contiguous_range T>
+struct NeedsSerialized<T, void> : std::false_type {};
 
 /// Registers BinaryBuffer as not needing serialized
 template<>
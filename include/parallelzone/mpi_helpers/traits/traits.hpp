@@ -15,6 +15,7 @@
  */
 
 #pragma once
+#include <parallelzone/mpi_helpers/traits/contiguous_range.hpp>
 #include <parallelzone/mpi_helpers/traits/gather.hpp>
 #include <parallelzone/mpi_helpers/traits/mpi_data_type.hpp>
 #include <parallelzone/mpi_helpers/traits/mpi_op.hpp>
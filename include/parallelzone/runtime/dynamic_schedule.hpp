@@ -0,0 +1,107 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <stdexcept>
+
+namespace parallelzone::runtime {
+
+/** @brief Describes how RuntimeView::for_each_dynamic hands out tasks.
+ *
+ *  Dynamic loops split the tasks into chunks of consecutive tasks. Processes
+ *  claim chunks, one at a time, from a shared counter until none remain, so
+ *  processes which get cheap tasks simply claim more of them. Larger chunks
+ *  mean fewer trips to the counter, smaller chunks mean better balance at the
+ *  end of the loop. The kinds of schedules are:
+ *
+ *  - fixed: every chunk has chunk_size() tasks (the last chunk may have
+ *    fewer).
+ *  - guided: chunks start large and shrink as the loop progresses. Each chunk
+ *    is 1 / (2P) of the tasks which remain (P being the number of processes),
+ *    but never fewer than chunk_size() tasks. This takes few trips to the
+ *    counter while the work is plentiful, and still balances the tail.
+ *
+ *  The chunks depend only on the schedule, the number of tasks, and the
+ *  number of processes, so every process agrees on them.
+ */
+class DynamicSchedule {
+public:
+    /// Type used for counting tasks
+    using size_type = std::size_t;
+
+    /// The ways of chunking the tasks
+    enum class kind_type {
+        fixed, ///< All chunks are the same size
+        guided ///< Chunks decrease in size as the loop progresses
+    };
+
+    /** @brief Creates a fixed schedule handing out one task at a time.
+     *
+     *  @throw None No throw guarantee.
+     */
+    DynamicSchedule() noexcept = default;
+
+    /** @brief Creates a schedule of the given kind.
+     *
+     *  @param[in] kind       How the tasks are chunked.
+     *  @param[in] chunk_size The size of each chunk for fixed schedules, the
+     *                        minimum size of a chunk for guided schedules.
+     *
+     *  @throw std::runtime_error if @p chunk_size is 0. Strong throw
+     *                            guarantee.
+     */
+    DynamicSchedule(kind_type kind, size_type chunk_size) :
+      m_kind_(kind), m_chunk_size_(chunk_size) {
+        if(chunk_size == 0)
+            throw std::runtime_error("Chunk size must be at least 1");
+    }
+
+    /// Creates a fixed schedule with chunks of @p chunk_size tasks
+    static DynamicSchedule fixed(size_type chunk_size) {
+        return DynamicSchedule(kind_type::fixed, chunk_size);
+    }
+
+    /// Creates a guided schedule with chunks of at least @p min_size tasks
+    static DynamicSchedule guided(size_type min_size = 1) {
+        return DynamicSchedule(kind_type::guided, min_size);
+    }
+
+    /// How the tasks are chunked
+    kind_type kind() const noexcept { return m_kind_; }
+
+    /// The (minimum, for guided schedules) number of tasks in a chunk
+    size_type chunk_size() const noexcept { return m_chunk_size_; }
+
+    /// Schedules are equal if they have the same kind and chunk size
+    bool operator==(const DynamicSchedule& rhs) const noexcept {
+        return m_kind_ == rhs.m_kind_ && m_chunk_size_ == rhs.m_chunk_size_;
+    }
+
+    /// Defined as the negation of operator==
+    bool operator!=(const DynamicSchedule& rhs) const noexcept {
+        return !(*this == rhs);
+    }
+
+private:
+    /// How the tasks are chunked
+    kind_type m_kind_ = kind_type::fixed;
+
+    /// The (minimum) number of tasks in a chunk
+    size_type m_chunk_size_ = 1;
+};
+
+} // namespace parallelzone::runtime
@@ -23,5 +23,7 @@
  *
  */
 
+#include <parallelzone/runtime/dynamic_schedule.hpp>
 #include <parallelzone/runtime/resource_set.hpp>
 #include <parallelzone/runtime/runtime_view.hpp>
+#include <parallelzone/runtime/task_scheduler.hpp>
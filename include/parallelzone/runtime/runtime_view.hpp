@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <functional>
 #include <parallelzone/mpi_helpers/commpp/commpp.hpp>
+#include <parallelzone/runtime/dynamic_schedule.hpp>
 #include <parallelzone/runtime/resource_set.hpp>
 
 namespace parallelzone::runtime {
@@ -100,6 +102,18 @@ public:
     /// Type of a callback function
     using callback_function_type = std::function<void()>;
 
+    /// Type describing how dynamic loops hand out tasks
+    using schedule_type = DynamicSchedule;
+
+    /// Type of a function run on each task of a dynamic loop
+    using task_function_type = std::function<void(size_type)>;
+
+    /// Type of the statistics collected about communication
+    using comm_stats_type = mpi_helpers::CommStats;
+
+    /// Type of the thresholds used to pick collective algorithms
+    using tuning_type = mpi_helpers::CollectiveTuning;
+
     // -------------------------------------------------------------------------
     // -- Ctors, Assignment, Dtor
     // -------------------------------------------------------------------------
@@ -426,6 +440,20 @@ public:
         return comm_().gather(std::forward<T>(input));
     }
 
+    /** @brief All gather where each ResourceSet's data is already in place.
+     *
+     *  @p data is split into one block per ResourceSet. Block `i` of
+     *  ResourceSet `i` is its contribution; on return every block is filled
+     *  in. This is ultimately equivalent to calling MPI_Allgather with
+     *  MPI_IN_PLACE.
+     *
+     *  @param[in,out] data The result, with this ResourceSet's block filled in.
+     */
+    template<typename U>
+    void gather_in_place(std::span<U> data) const {
+        comm_().gather_in_place(data);
+    }
+
     /** @brief Performs an all gatherv on the provided data.
      *
      *  This method behaves identically to gather except that each process may
@@ -447,6 +475,25 @@ public:
         return comm_().gatherv(std::forward<T>(input));
     }
 
+    /** @brief All gatherv which also says where each process's data went.
+     *
+     *  This method behaves like gatherv, but additionally returns how many
+     *  elements came from each ResourceSet and the index of each one's first
+     *  element, so the result can be sliced without copying. See
+     *  CommPP::gatherv_with_counts for more details.
+     *
+     *  @tparam T The qualified (cv and/or reference) type of @p input. Must
+     *            be a contiguous container which does not need serialized.
+     *
+     *  @param[in] input The local data being sent by the current process.
+     *
+     *  @return A tuple of the gathered data, the counts, and the offsets.
+     */
+    template<typename T>
+    auto gatherv_with_counts(T&& input) const {
+        return comm_().gatherv_with_counts(std::forward<T>(input));
+    }
+
     /** @brief Performs an all reduce on the data.
      *
      * In a reduction operation involving @f$P@f$ processes, process
@@ -476,7 +523,9 @@ public:
      *  N.B. This method assumes that each process sends the same number of
      *  bytes.
      *
-     *  This method is equivalent to MPI_Allreduce.
+     *  This method is equivalent to MPI_Allreduce. @p op may be a functor
+     *  with a built-in MPI operation (e.g., std::plus or maximum), or any
+     *  callable combining two elements, see CommPP::reduce for details.
      *
      *  @param[in] input The data local to the current ResourceSet.
      *  @param[in] op    The functor being used to reduce the data.
@@ -489,6 +538,363 @@ public:
         return comm_().reduce(std::forward<T>(input), std::forward<Fxn>(op));
     }
 
+    /** @brief All reduce which overwrites @p data with the result.
+     *
+     *  This method behaves like reduce, but no buffer besides @p data is
+     *  needed. It is ultimately equivalent to calling MPI_Allreduce with
+     *  MPI_IN_PLACE.
+     *
+     *  @param[in,out] data On input the data local to the current ResourceSet,
+     *                      on output the result of the reduction.
+     *  @param[in]     op   The functor being used to reduce the data.
+     */
+    template<typename U, typename Fxn>
+    void reduce_in_place(std::span<U> data, Fxn&& op) const {
+        comm_().reduce_in_place(data, std::forward<Fxn>(op));
+    }
+
+    /** @brief Sends a copy of @p input from ResourceSet @p root to every
+     *         ResourceSet.
+     *
+     *  This method is equivalent to `at(root).ram().broadcast(input)`. See
+     *  CommPP::broadcast for more details.
+     *
+     *  This call is ultimately equivalent to calling MPI_Bcast.
+     *
+     *  @tparam T The qualified (cv and/or reference) type of @p input. @p T
+     *            will be deduced by the compiler and need not be specified.
+     *
+     *  @param[in] input The data to send. Only the value on ResourceSet
+     *                   @p root is used.
+     *  @param[in] root  The rank of the ResourceSet which has the data.
+     *
+     *  @return A local copy of the data held by ResourceSet @p root.
+     */
+    template<typename T>
+    auto broadcast(T&& input, size_type root) const {
+        return comm_().broadcast(std::forward<T>(input), root);
+    }
+
+    /** @brief Splits up @p input on ResourceSet @p root and sends one piece
+     *         to each ResourceSet.
+     *
+     *  This method is equivalent to `at(root).ram().scatter(input)`. See
+     *  CommPP::scatter for more details.
+     *
+     *  This call is ultimately equivalent to calling MPI_Scatter.
+     *
+     *  @tparam T The qualified (cv and/or reference) type of @p input. @p T
+     *            will be deduced by the compiler and need not be specified.
+     *
+     *  @param[in] input The container to split up. Only the value on
+     *                   ResourceSet @p root is used.
+     *  @param[in] root  The rank of the ResourceSet which has the data.
+     *
+     *  @return The local piece of @p input.
+     */
+    template<typename T>
+    auto scatter(T&& input, size_type root) const {
+        return comm_().scatter(std::forward<T>(input), root);
+    }
+
+    /** @brief Like scatter, but the pieces can be different sizes.
+     *
+     *  This method is equivalent to `at(root).ram().scatterv(input)`. See
+     *  CommPP::scatterv for more details.
+     *
+     *  This call is ultimately equivalent to calling MPI_Scatterv.
+     *
+     *  @tparam T The qualified (cv and/or reference) type of @p input. @p T
+     *            will be deduced by the compiler and need not be specified.
+     *
+     *  @param[in] input The container to split up. Only the value on
+     *                   ResourceSet @p root is used.
+     *  @param[in] root  The rank of the ResourceSet which has the data.
+     *
+     *  @return The local piece of @p input.
+     */
+    template<typename T>
+    auto scatterv(T&& input, size_type root) const {
+        return comm_().scatterv(std::forward<T>(input), root);
+    }
+
+    /** @brief Sends a different piece of @p input to each ResourceSet.
+     *
+     *  Piece `j` of @p input on ResourceSet `i` becomes piece `i` of the
+     *  result on ResourceSet `j`. See CommPP::alltoall for more details,
+     *  including what counts as a piece.
+     *
+     *  This call is ultimately equivalent to calling MPI_Alltoall (or
+     *  MPI_Alltoallv if @p T needs to be serialized).
+     *
+     *  @tparam T The qualified (cv and/or reference) type of @p input. @p T
+     *            will be deduced by the compiler and need not be specified.
+     *
+     *  @param[in] input The pieces to send to each ResourceSet.
+     *
+     *  @return The pieces received from each ResourceSet, in rank order.
+     */
+    template<typename T>
+    auto alltoall(T&& input) const {
+        return comm_().alltoall(std::forward<T>(input));
+    }
+
+    /** @brief Like alltoall, but the pieces can be different sizes.
+     *
+     *  ResourceSet `i` sends @p counts[j] elements of @p input to
+     *  ResourceSet `j`. See CommPP::alltoallv for more details.
+     *
+     *  This call is ultimately equivalent to calling MPI_Alltoallv.
+     *
+     *  @tparam T The qualified (cv and/or reference) type of @p input. @p T
+     *            will be deduced by the compiler and need not be specified.
+     *
+     *  @param[in] input  The elements to send.
+     *  @param[in] counts How many elements each ResourceSet gets.
+     *
+     *  @return A pair of the received elements and how many of them came from
+     *          each ResourceSet.
+     */
+    template<typename T>
+    auto alltoallv(T&& input,
+                   const mpi_helpers::CommPP::count_container& counts) const {
+        return comm_().alltoallv(std::forward<T>(input), counts);
+    }
+
+    /** @brief Starts an all gather and returns without waiting for it.
+     *
+     *  This method is the nonblocking version of gather. The returned future
+     *  owns the buffers used by the operation, so @p input may be reused right
+     *  away. Calling get() on the future waits for the operation to finish and
+     *  returns what gather would have returned.
+     *
+     *  This call is ultimately equivalent to calling MPI_Iallgather.
+     *
+     *  @tparam T The qualified (cv and/or reference) type of @p input. @p T
+     *            will be deduced by the compiler and need not be specified.
+     *
+     *  @param[in] input The data local to the current ResourceSet.
+     *
+     *  @return A future which resolves to a local copy of the gathered data.
+     */
+    template<typename T>
+    auto igather(T&& input) const {
+        return comm_().igather(std::forward<T>(input));
+    }
+
+    /** @brief Starts an all gatherv and returns without waiting for it.
+     *
+     *  This method is the nonblocking version of gatherv. See igather for
+     *  more details.
+     *
+     *  This call is ultimately equivalent to calling MPI_Iallgatherv.
+     *
+     *  @tparam T The qualified (cv and/or reference) type of @p input. @p T
+     *            will be deduced by the compiler and need not be specified.
+     *
+     *  @param[in] input The local data being sent by the current process.
+     *
+     *  @return A future which resolves to a local copy of the gathered data.
+     */
+    template<typename T>
+    auto igatherv(T&& input) const {
+        return comm_().igatherv(std::forward<T>(input));
+    }
+
+    /** @brief Starts an all reduce and returns without waiting for it.
+     *
+     *  This method is the nonblocking version of reduce. See igather for
+     *  more details.
+     *
+     *  This call is ultimately equivalent to calling MPI_Iallreduce.
+     *
+     *  @param[in] input The data local to the current ResourceSet.
+     *  @param[in] op    The functor being used to reduce the data.
+     *
+     *  @return A future which resolves to a local copy of the result of the
+     *          reduction.
+     */
+    template<typename T, typename Fxn>
+    auto ireduce(T&& input, Fxn&& op) const {
+        return comm_().ireduce(std::forward<T>(input), std::forward<Fxn>(op));
+    }
+
+    /** @brief Sets up an all reduce which can be run many times.
+     *
+     *  Iterative algorithms often reduce the same number of elements with the
+     *  same operation once per iteration. The returned object owns the input
+     *  and result buffers and is reused across iterations. See
+     *  CommPP::persistent_reduce for more details.
+     *
+     *  This is a collective call, every ResourceSet must make it.
+     *
+     *  @tparam T The type of the elements being reduced. Must be specified.
+     *  @tparam Fxn The type of the reduction functor. @p Fxn will be deduced
+     *              by the compiler and need not be specified.
+     *
+     *  @param[in] n_elems The number of elements being reduced.
+     *  @param[in] op      The functor being used to reduce the data.
+     *
+     *  @return The reusable reduction.
+     */
+    template<typename T, typename Fxn>
+    auto persistent_reduce(std::size_t n_elems, Fxn&& op) const {
+        return comm_().persistent_reduce<T>(n_elems, std::forward<Fxn>(op));
+    }
+
+    // -------------------------------------------------------------------------
+    // -- One-sided operations
+    // -------------------------------------------------------------------------
+
+    /** @brief Allocates memory which other ResourceSets can access directly.
+     *
+     *  Each ResourceSet allocates @p n_bytes (zero-initialized), which can
+     *  then be written, read, and accumulated into by any ResourceSet,
+     *  through the RAM of the ResourceSet owning it (e.g.,
+     *  `rv.at(i).ram().put(window, data, offset)`), without the owner taking
+     *  part. See CommPP::allocate_window for more details.
+     *
+     *  This is a collective call, every ResourceSet must make it. The window
+     *  is freed (also collectively) when it is destroyed.
+     *
+     *  @param[in] n_bytes The number of bytes this ResourceSet exposes.
+     *
+     *  @return The window.
+     *
+     *  @throw std::runtime_error if *this is a view of the null runtime.
+     *         Strong throw guarantee.
+     */
+    mpi_helpers::RMAWindow allocate_window(std::size_t n_bytes) const;
+
+    /** @brief Lets other ResourceSets access existing memory directly.
+     *
+     *  The same as allocate_window, except that the memory is provided by
+     *  the caller and must outlive the window. See CommPP::expose_window.
+     *
+     *  @param[in] region The memory this ResourceSet exposes.
+     *
+     *  @return The window.
+     *
+     *  @throw std::runtime_error if *this is a view of the null runtime.
+     *         Strong throw guarantee.
+     */
+    mpi_helpers::RMAWindow expose_window(mpi_helpers::BinaryView region) const;
+
+    // -------------------------------------------------------------------------
+    // -- Dynamic load balancing
+    // -------------------------------------------------------------------------
+
+    /** @brief Runs @p fxn on each task in [0, @p n_tasks), handing tasks out
+     *         to ResourceSets as they become free.
+     *
+     *  Statically assigning tasks (e.g., task `i` goes to ResourceSet
+     *  `i % size()`) wastes time when tasks take different amounts of time.
+     *  This method instead keeps a shared counter (on rank 0) of the next
+     *  unclaimed chunk of tasks. Each ResourceSet atomically increments the
+     *  counter (MPI_Fetch_and_op) to claim a chunk, runs @p fxn on each task
+     *  in it, and repeats until no chunks remain. Rank 0 does not need to
+     *  take part in the increments, it works on tasks like everyone else.
+     *  How the tasks are chunked is controlled by @p schedule.
+     *
+     *  Each task is run exactly once, by exactly one ResourceSet, but which
+     *  one is not known ahead of time. Any results must therefore be stored
+     *  somewhere all ResourceSets can reach, or combined afterwards (e.g.,
+     *  with reduce).
+     *
+     *  This is a collective call, every ResourceSet must make it with the
+     *  same @p n_tasks and @p schedule. If @p fxn throws on one ResourceSet,
+     *  that ResourceSet stops claiming tasks and the remaining ResourceSets
+     *  will (at best) hang when they try to finish the loop.
+     *
+     *  @param[in] n_tasks  The number of tasks.
+     *  @param[in] fxn      Called with the index of each task this
+     *                      ResourceSet claims.
+     *  @param[in] schedule How tasks are chunked. Default is a fixed schedule
+     *                      with one task per chunk.
+     *
+     *  @throw std::runtime_error if *this is a view of the null runtime.
+     *         Strong throw guarantee.
+     *  @throw ??? if @p fxn throws. Weak throw guarantee.
+     */
+    void for_each_dynamic(size_type n_tasks, task_function_type fxn,
+                          schedule_type schedule = {}) const;
+
+    // -------------------------------------------------------------------------
+    // -- Instrumentation
+    // -------------------------------------------------------------------------
+
+    /** @brief Turns recording statistics about communication on or off.
+     *
+     *  While on, every MPI operation ParallelZone does on behalf of *this
+     *  (and of its ResourceSets) is recorded. See
+     *  CommPP::set_instrumentation for what is recorded. The setting is
+     *  shared by all views of the runtime, and may differ from process to
+     *  process.
+     *
+     *  @param[in] on True to start recording, false to stop.
+     *
+     *  @throw std::runtime_error if *this is a view of the null runtime.
+     *         Strong throw guarantee.
+     */
+    void set_instrumentation(bool on);
+
+    /** @brief The communication statistics of every ResourceSet, combined.
+     *
+     *  The statistics recorded by each ResourceSet are summed, operation by
+     *  operation, so that, e.g., the "allgather" entry holds the total number
+     *  of calls, bytes, and time spent in all gathers over all ResourceSets.
+     *  The statistics are taken before combining them, so the communication
+     *  done by this call is not included.
+     *
+     *  This is a collective call, every ResourceSet must make it.
+     *
+     *  @return The combined statistics. The same on every ResourceSet.
+     *
+     *  @throw std::runtime_error if *this is a view of the null runtime.
+     *         Strong throw guarantee.
+     */
+    comm_stats_type comm_stats() const;
+
+    /** @brief Logs the combined communication statistics when the runtime
+     *         is finalized.
+     *
+     *  This registers (via stack_callback) a callback which calls
+     *  comm_stats() and logs the result, as a table, to logger(). Since the
+     *  callback is collective, this method must be called on every
+     *  ResourceSet. Combine with set_instrumentation(true) to get a report
+     *  of the whole run.
+     *
+     *  @throw std::runtime_error if *this is a view of the null runtime.
+     *         Strong throw guarantee.
+     *  @throw std::bad_alloc if there is problem adding the callback.
+     *         Strong throw guarantee.
+     */
+    void log_comm_stats_at_finalize();
+
+    // -------------------------------------------------------------------------
+    // -- Tuning
+    // -------------------------------------------------------------------------
+
+    /** @brief Picks the collective algorithms used by *this for this machine.
+     *
+     *  Measures (or loads from @p path) the thresholds at which the
+     *  collectives ParallelZone does on behalf of *this switch algorithms,
+     *  e.g., from flat to ring all gathers. See CommPP::tune for how the
+     *  thresholds are measured and when the file is used. Meant to be called
+     *  right after creating the runtime, with a file in a directory which
+     *  persists between runs, so that only the first run measures anything.
+     *
+     *  This is a collective call, every ResourceSet must make it.
+     *
+     *  @param[in] path The tuning file. Default is to always measure.
+     *
+     *  @return The tuning which is now used. The same on every ResourceSet.
+     *
+     *  @throw std::runtime_error if *this is a view of the null runtime, or
+     *         process 0 could not write @p path. Weak throw guarantee.
+     */
+    tuning_type tune_collectives(const std::string& path = "");
+
     // -------------------------------------------------------------------------
     // -- Utility methods
     // -------------------------------------------------------------------------
@@ -532,8 +938,18 @@ public:
     bool operator==(const RuntimeView& rhs) const;
 
 private:
-    /// Returns the MPI communicator as our internal CommPP object
-    mpi_helpers::CommPP comm_() const;
+    /** @brief Returns the communicator ParallelZone uses for collectives.
+     *
+     *  The result is a persistent, private duplicate of mpi_comm(), so calling
+     *  this method does not allocate or call into MPI, and messages sent on
+     *  it will never match messages the user sends on mpi_comm().
+     *
+     *  @return A read-only reference to the library's communicator.
+     *
+     *  @throw std::runtime_error if *this is a view of the null runtime.
+     *         Strong throw guarantee.
+     */
+    const mpi_helpers::CommPP& comm_() const;
 
     /** @brief Code factorization for ensuring *this is not null.
      *
@@ -0,0 +1,294 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <functional>
+#include <future>
+#include <memory>
+#include <parallelzone/mpi_helpers/binary_buffer/binary_buffer.hpp>
+#include <parallelzone/runtime/runtime_view.hpp>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+namespace parallelzone::runtime {
+namespace detail_ {
+class TaskSchedulerPIMPL;
+}
+
+/** @brief A handle to a function registered with a TaskScheduler.
+ *
+ *  The handle remembers the signature of the function, so tasks submitted
+ *  with it can be checked at compile time and their results deserialized
+ *  with the correct type.
+ *
+ *  @tparam Signature The function type of the registered function, e.g.,
+ *                    `double(int, const std::string&)`.
+ */
+template<typename Signature>
+class TaskHandle;
+
+template<typename R, typename... Args>
+class TaskHandle<R(Args...)> {
+public:
+    /// Type used to identify registered functions
+    using id_type = std::size_t;
+
+    /// Type returned by the registered function
+    using result_type = R;
+
+    /// Type the arguments are stored (and serialized) as
+    using arguments_type = std::tuple<std::decay_t<Args>...>;
+
+    /** @brief Wraps the id of a registered function.
+     *
+     *  Users should get handles from TaskScheduler::register_task.
+     *
+     *  @param[in] id The id of the registered function.
+     *
+     *  @throw None No throw guarantee.
+     */
+    explicit TaskHandle(id_type id) noexcept : m_id_(id) {}
+
+    /// The id of the registered function
+    id_type id() const noexcept { return m_id_; }
+
+private:
+    /// The id of the registered function
+    id_type m_id_;
+};
+
+/** @brief Runs tasks, submitted by any process, on whichever processes are
+ *         free.
+ *
+ *  A task is a registered function plus the arguments to call it with. Since
+ *  tasks may run on a different process than the one which submitted them,
+ *  functions are registered ahead of time (every process must register the
+ *  same functions, in the same order) and tasks are shipped around as the
+ *  function's id plus the cereal-serialized arguments. Results come back the
+ *  same way, through the std::future returned by submit.
+ *
+ *  Submitting a task only queues it. Tasks run when every process calls
+ *  run(). Each process starts on its own queue; once that is empty it steals
+ *  tasks from the queues of the other processes (in rank order, starting
+ *  with the next process). Queues are exposed through RMA windows and claimed
+ *  with atomic fetch-and-add, so a process whose tasks are being stolen does
+ *  not need to do anything for the steal to happen. Since no tasks are added
+ *  during run(), a process is done when it has found every queue empty. The
+ *  results are then sent back to the submitting processes, which makes their
+ *  futures ready.
+ *
+ *  If a task throws, the exception is caught where it ran, and the future of
+ *  the task throws a std::runtime_error with the same message. Other tasks
+ *  are not affected.
+ *
+ *  @code
+ *  TaskScheduler scheduler(rv);
+ *  auto square = scheduler.register_task([](int x) { return x * x; });
+ *  auto result = scheduler.submit(square, 3);
+ *  scheduler.run();
+ *  assert(result.get() == 9);
+ *  @endcode
+ */
+class TaskScheduler {
+public:
+    /// Type of the object implementing *this
+    using pimpl_type = detail_::TaskSchedulerPIMPL;
+
+    /// Type of a pointer to the PIMPL
+    using pimpl_pointer = std::unique_ptr<pimpl_type>;
+
+    /// Type used for counting tasks
+    using size_type = std::size_t;
+
+    /// Type used to identify registered functions
+    using id_type = std::size_t;
+
+    /// Type of the runtime the tasks run on
+    using runtime_type = RuntimeView;
+
+    /// Type of a buffer holding serialized arguments or results
+    using buffer_type = mpi_helpers::BinaryBuffer;
+
+    /// Type of a view of serialized arguments or results
+    using const_binary_reference = mpi_helpers::ConstBinaryView;
+
+    /// Type of a type-erased registered function: serialized args in,
+    /// serialized result out
+    using handler_type = std::function<buffer_type(const_binary_reference)>;
+
+    /// Type of the callback which receives a task's outcome. The first
+    /// argument is true if the task succeeded, in which case the second is
+    /// the serialized result; otherwise the second is the error message.
+    using completion_type = std::function<void(bool, const_binary_reference)>;
+
+    /// Counts of what a process did during a call to run()
+    struct run_stats_type {
+        /// The number of tasks this process ran
+        size_type n_run = 0;
+
+        /// How many of those were submitted by other processes
+        size_type n_stolen = 0;
+    };
+
+    /** @brief Creates a scheduler which runs tasks on @p rv.
+     *
+     *  @param[in] rv The processes tasks run on.
+     *
+     *  @throw std::bad_alloc if allocating the PIMPL fails. Strong throw
+     *                        guarantee.
+     */
+    explicit TaskScheduler(runtime_type rv);
+
+    /// Deleted because futures refer to the tasks in *this
+    TaskScheduler(const TaskScheduler&) = delete;
+
+    /// Deleted because futures refer to the tasks in *this
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    /// Takes the registered functions and queued tasks of @p other
+    TaskScheduler(TaskScheduler&& other) noexcept;
+
+    /// Replaces the state of *this with that of @p rhs
+    TaskScheduler& operator=(TaskScheduler&& rhs) noexcept;
+
+    /// Default dtor. Futures of tasks which never ran become broken promises
+    ~TaskScheduler() noexcept;
+
+    /** @brief Registers @p fxn so tasks can call it.
+     *
+     *  Every process must register the same functions in the same order, as
+     *  a function is identified by when it was registered. The arguments and
+     *  result of @p fxn must be serializable with cereal.
+     *
+     *  @tparam Fxn The type of a callable whose signature can be deduced by
+     *              std::function (so not generic lambdas).
+     *
+     *  @param[in] fxn The function to register.
+     *
+     *  @return A handle for submitting tasks which call @p fxn.
+     *
+     *  @throw std::bad_alloc if registering the function fails. Strong throw
+     *                        guarantee.
+     */
+    template<typename Fxn>
+    auto register_task(Fxn&& fxn) {
+        return register_(std::function{std::forward<Fxn>(fxn)});
+    }
+
+    /** @brief Queues a task which calls @p task with @p inputs.
+     *
+     *  The arguments are serialized right away, so the caller need not keep
+     *  them alive. The task will run during the next call to run(), possibly
+     *  on a different process.
+     *
+     *  @tparam R The return type of the registered function.
+     *  @tparam Args The parameters of the registered function.
+     *  @tparam Inputs The types of the inputs, must be convertible to
+     *                 @p Args.
+     *
+     *  @param[in] task   The function to call.
+     *  @param[in] inputs The arguments to call it with.
+     *
+     *  @return A future which becomes ready when run() returns.
+     *
+     *  @throw std::out_of_range if @p task was not registered with *this.
+     *                           Strong throw guarantee.
+     */
+    template<typename R, typename... Args, typename... Inputs>
+    std::future<R> submit(const TaskHandle<R(Args...)>& task,
+                          Inputs&&... inputs) {
+        using handle_type = TaskHandle<R(Args...)>;
+        static_assert(sizeof...(Inputs) == sizeof...(Args),
+                      "Wrong number of arguments for the task");
+        typename handle_type::arguments_type args(
+          std::forward<Inputs>(inputs)...);
+
+        auto promise = std::make_shared<std::promise<R>>();
+        auto future  = promise->get_future();
+        completion_type done = [promise](bool ok,
+                                         const_binary_reference bytes) {
+            if(!ok) {
+                std::string msg(reinterpret_cast<const char*>(bytes.data()),
+                                bytes.size());
+                promise->set_exception(
+                  std::make_exception_ptr(std::runtime_error(msg)));
+            } else if constexpr(std::is_void_v<R>) {
+                promise->set_value();
+            } else {
+                promise->set_value(mpi_helpers::from_binary_view<R>(bytes));
+            }
+        };
+        submit_(task.id(), mpi_helpers::make_binary_buffer(args),
+                std::move(done));
+        return future;
+    }
+
+    /// The number of functions registered with *this
+    size_type n_registered() const noexcept;
+
+    /// The number of tasks this process has queued since the last run()
+    size_type n_pending() const noexcept;
+
+    /** @brief Collectively runs every queued task, on every process.
+     *
+     *  When this returns every task queued before the call has run and its
+     *  future is ready. Every process must call this, even if it has not
+     *  queued any tasks.
+     *
+     *  @return What this process did.
+     *
+     *  @throw std::runtime_error if the processes have not registered the
+     *                            same number of functions (all processes
+     *                            throw, no tasks are run). Strong throw
+     *                            guarantee.
+     */
+    run_stats_type run();
+
+private:
+    /// Type-erases @p fxn and registers it
+    template<typename R, typename... Args>
+    TaskHandle<R(Args...)> register_(std::function<R(Args...)> fxn) {
+        using args_type = typename TaskHandle<R(Args...)>::arguments_type;
+        handler_type handler = [fxn = std::move(fxn)](
+                                 const_binary_reference bytes) {
+            auto args = mpi_helpers::from_binary_view<args_type>(bytes);
+            if constexpr(std::is_void_v<R>) {
+                std::apply(fxn, std::move(args));
+                return buffer_type{};
+            } else {
+                return mpi_helpers::make_binary_buffer(
+                  std::apply(fxn, std::move(args)));
+            }
+        };
+        return TaskHandle<R(Args...)>(add_handler_(std::move(handler)));
+    }
+
+    /// Adds @p handler to the registry, returning its id
+    id_type add_handler_(handler_type handler);
+
+    /// Queues a call to function @p id with serialized arguments @p args
+    void submit_(id_type id, buffer_type args, completion_type done);
+
+    /// Returns the PIMPL, throws std::runtime_error if *this was moved from
+    pimpl_type& pimpl_();
+
+    /// The object actually implementing *this
+    pimpl_pointer m_pimpl_;
+};
+
+} // namespace parallelzone::runtime
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <parallelzone/mpi_helpers/binary_buffer/codec.hpp>
+#include <stdexcept>
+
+namespace parallelzone::mpi_helpers {
+namespace {
+
+/// Appends @p n to @p out as an LEB128 varint
+void put_varint(Codec::buffer_type& out, std::size_t n) {
+    while(n >= 0x80) {
+        out.push_back(std::byte(n & 0x7F) | std::byte{0x80});
+        n >>= 7;
+    }
+    out.push_back(std::byte(n));
+}
+
+/// Reads an LEB128 varint starting at @p p, advancing @p p past it
+std::size_t get_varint(const std::byte*& p, const std::byte* end) {
+    std::size_t rv = 0;
+    for(unsigned shift = 0; p != end && shift < 64; shift += 7) {
+        const auto byte = std::to_integer<std::size_t>(*p++);
+        rv |= (byte & 0x7F) << shift;
+        if(byte < 0x80) return rv;
+    }
+    throw std::runtime_error("Malformed zero-run data: bad length");
+}
+
+} // namespace
+
+void ZeroRunCodec::compress_(const_view_type data, buffer_type& out) const {
+    const auto* p       = data.data();
+    const size_type n   = data.size();
+    constexpr auto zero = std::byte{0};
+
+    // Mostly literal data grows by a few bytes per record, at worst
+    out.reserve(out.size() + n + n / m_min_run_ + 16);
+
+    size_type literal_begin = 0;
+    size_type i             = 0;
+    while(i < n) {
+        i = std::find(p + i, p + n, zero) - p;
+        size_type j = i;
+        while(j < n && p[j] == zero) ++j;
+
+        // Short runs stay in the literal, unless they end the data
+        if(j - i >= m_min_run_ || j == n) {
+            put_varint(out, i - literal_begin);
+            out.insert(out.end(), p + literal_begin, p + i);
+            put_varint(out, j - i);
+            literal_begin = j;
+        }
+        i = j;
+    }
+}
+
+void ZeroRunCodec::decompress_(const_view_type data, view_type out) const {
+    const auto* p   = data.data();
+    const auto* end = p + data.size();
+    auto* q         = out.data();
+    auto* q_end     = q + out.size();
+
+    auto check = [&](std::size_t n, std::size_t n_left) {
+        if(n > n_left)
+            throw std::runtime_error("Malformed zero-run data: overflow");
+    };
+
+    while(p != end) {
+        const auto n_literal = get_varint(p, end);
+        check(n_literal, end - p);
+        check(n_literal, q_end - q);
+        if(n_literal > 0) std::memcpy(q, p, n_literal);
+        p += n_literal;
+        q += n_literal;
+
+        const auto n_zeros = get_varint(p, end);
+        check(n_zeros, q_end - q);
+        if(n_zeros > 0) std::memset(q, 0, n_zeros);
+        q += n_zeros;
+    }
+    if(q != q_end)
+        throw std::runtime_error("Malformed zero-run data: too short");
+}
+
+} // namespace parallelzone::mpi_helpers
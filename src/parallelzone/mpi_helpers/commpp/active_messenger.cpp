@@ -0,0 +1,83 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "detail_/active_messenger_pimpl.hpp"
+#include <parallelzone/mpi_helpers/commpp/active_messenger.hpp>
+#include <stdexcept>
+
+namespace parallelzone::mpi_helpers {
+
+// -----------------------------------------------------------------------------
+// -- CTors, Assignment, and Dtor
+// -----------------------------------------------------------------------------
+
+ActiveMessenger::ActiveMessenger(const CommPP& comm, std::size_t batch_size) :
+  m_pimpl_(std::make_unique<pimpl_type>(comm, batch_size)) {}
+
+ActiveMessenger::ActiveMessenger(ActiveMessenger&& other) noexcept = default;
+
+ActiveMessenger& ActiveMessenger::operator=(ActiveMessenger&& rhs) noexcept =
+  default;
+
+ActiveMessenger::~ActiveMessenger() noexcept = default;
+
+// -----------------------------------------------------------------------------
+// -- Messaging
+// -----------------------------------------------------------------------------
+
+void ActiveMessenger::flush() {
+    if(m_pimpl_) m_pimpl_->flush();
+}
+
+std::size_t ActiveMessenger::poll() { return pimpl_().poll(); }
+
+void ActiveMessenger::fence() { pimpl_().fence(); }
+
+// -----------------------------------------------------------------------------
+// -- Getters
+// -----------------------------------------------------------------------------
+
+ActiveMessenger::size_type ActiveMessenger::source() const noexcept {
+    return m_pimpl_ ? m_pimpl_->m_source_ : MPI_PROC_NULL;
+}
+
+std::size_t ActiveMessenger::batch_size() const noexcept {
+    return m_pimpl_ ? m_pimpl_->m_batch_size_ : 0;
+}
+
+ActiveMessenger::stats_type ActiveMessenger::stats() const noexcept {
+    return m_pimpl_ ? m_pimpl_->m_stats_ : stats_type{};
+}
+
+// -----------------------------------------------------------------------------
+// -- Private Methods
+// -----------------------------------------------------------------------------
+
+ActiveMessenger::id_type ActiveMessenger::add_handler_(handler_type handler) {
+    return pimpl_().add_handler(std::move(handler));
+}
+
+void ActiveMessenger::send_(id_type id, size_type rank,
+                            const BinaryBuffer& args) {
+    pimpl_().send(id, rank, ConstBinaryView(args.data(), args.size()));
+}
+
+ActiveMessenger::pimpl_type& ActiveMessenger::pimpl_() const {
+    if(m_pimpl_) return *m_pimpl_;
+    throw std::runtime_error("ActiveMessenger has been moved from");
+}
+
+} // namespace parallelzone::mpi_helpers
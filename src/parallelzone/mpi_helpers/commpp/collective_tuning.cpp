@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fstream>
+#include <parallelzone/mpi_helpers/commpp/collective_tuning.hpp>
+#include <sstream>
+#include <stdexcept>
+
+namespace parallelzone::mpi_helpers {
+namespace {
+
+using size_type = CollectiveTuning::size_type;
+
+/// Writes a threshold, spelling out thresholds which are never reached
+std::string threshold_string(size_type n) {
+    return n == CollectiveTuning::never ? "never" : std::to_string(n);
+}
+
+/// Reverses threshold_string
+size_type parse_size(const std::string& key, const std::string& value) {
+    if(value == "never") return CollectiveTuning::never;
+    std::size_t n_read = 0;
+    size_type rv       = 0;
+    try {
+        rv = std::stoull(value, &n_read);
+    } catch(const std::exception&) { n_read = 0; }
+    if(n_read == 0 || n_read != value.size() || value[0] == '-')
+        throw std::runtime_error("Bad value '" + value + "' for " + key);
+    return rv;
+}
+
+} // namespace
+
+std::string CollectiveTuning::to_string() const {
+    std::ostringstream os;
+    os << "# ParallelZone collective tuning\n"
+       << "n_procs " << n_procs << '\n'
+       << "n_nodes " << n_nodes << '\n'
+       << "eager_threshold " << threshold_string(eager_threshold) << '\n'
+       << "ring_threshold " << threshold_string(ring_threshold) << '\n'
+       << "hierarchical_threshold "
+       << threshold_string(hierarchical_threshold) << '\n'
+       << "compress " << (compress ? 1 : 0) << '\n';
+    return os.str();
+}
+
+CollectiveTuning CollectiveTuning::from_string(const std::string& text) {
+    CollectiveTuning rv;
+    std::istringstream is(text);
+    std::string line;
+    while(std::getline(is, line)) {
+        line = line.substr(0, line.find('#'));
+        std::istringstream words(line);
+        std::string key, value;
+        if(!(words >> key)) continue; // Blank line
+        if(!(words >> value)) throw std::runtime_error("No value for " + key);
+
+        if(key == "n_procs") {
+            rv.n_procs = parse_size(key, value);
+        } else if(key == "n_nodes") {
+            rv.n_nodes = parse_size(key, value);
+        } else if(key == "eager_threshold") {
+            rv.eager_threshold = parse_size(key, value);
+        } else if(key == "ring_threshold") {
+            rv.ring_threshold = parse_size(key, value);
+        } else if(key == "hierarchical_threshold") {
+            rv.hierarchical_threshold = parse_size(key, value);
+        } else if(key == "compress") {
+            const auto on = parse_size(key, value);
+            if(on > 1) throw std::runtime_error("compress must be 0 or 1");
+            rv.compress = on == 1;
+        }
+    }
+    return rv;
+}
+
+void CollectiveTuning::save(const std::string& path) const {
+    std::ofstream file(path);
+    file << to_string();
+    if(!file) throw std::runtime_error("Could not write " + path);
+}
+
+CollectiveTuning CollectiveTuning::load(const std::string& path) {
+    std::ifstream file(path);
+    if(!file) throw std::runtime_error("Could not read " + path);
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return from_string(contents.str());
+}
+
+} // namespace parallelzone::mpi_helpers
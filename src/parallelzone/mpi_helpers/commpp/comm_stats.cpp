@@ -0,0 +1,106 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <iomanip>
+#include <parallelzone/mpi_helpers/commpp/comm_stats.hpp>
+#include <sstream>
+
+namespace parallelzone::mpi_helpers {
+
+// -----------------------------------------------------------------------------
+// -- OpStats
+// -----------------------------------------------------------------------------
+
+void OpStats::add_call(std::size_t sent, std::size_t received, duration mpi,
+                       bool blocking) noexcept {
+    ++n_calls;
+    bytes_sent += sent;
+    bytes_received += received;
+    mpi_time += mpi;
+    if(blocking) ++latency[bin(mpi)];
+}
+
+std::size_t OpStats::bin(duration mpi) noexcept {
+    using std::chrono::microseconds;
+    const auto us = std::chrono::duration_cast<microseconds>(mpi).count();
+    if(us <= 0) return 0;
+    const std::size_t rv = std::bit_width(static_cast<std::uint64_t>(us));
+    return std::min(rv, n_bins - 1);
+}
+
+OpStats& OpStats::operator+=(const OpStats& rhs) noexcept {
+    n_calls += rhs.n_calls;
+    bytes_sent += rhs.bytes_sent;
+    bytes_received += rhs.bytes_received;
+    mpi_time += rhs.mpi_time;
+    serialization_time += rhs.serialization_time;
+    for(std::size_t i = 0; i < n_bins; ++i) latency[i] += rhs.latency[i];
+    return *this;
+}
+
+// -----------------------------------------------------------------------------
+// -- CommStats
+// -----------------------------------------------------------------------------
+
+OpStats CommStats::total() const noexcept {
+    OpStats rv;
+    for(const auto& [name, stats] : ops) rv += stats;
+    return rv;
+}
+
+CommStats& CommStats::operator+=(const CommStats& rhs) {
+    for(const auto& [name, stats] : rhs.ops) ops[name] += stats;
+    return *this;
+}
+
+std::string CommStats::to_string() const {
+    using seconds = std::chrono::duration<double>;
+
+    std::ostringstream os;
+    os << std::left << std::setw(12) << "operation" << std::right
+       << std::setw(11) << "calls" << std::setw(15) << "sent (B)"
+       << std::setw(15) << "received (B)" << std::setw(13) << "MPI (s)"
+       << std::setw(13) << "serial. (s)" << '\n';
+    os << std::fixed << std::setprecision(6);
+    for(const auto& [name, stats] : ops) {
+        os << std::left << std::setw(12) << name << std::right
+           << std::setw(11) << stats.n_calls << std::setw(15)
+           << stats.bytes_sent << std::setw(15) << stats.bytes_received
+           << std::setw(13) << seconds(stats.mpi_time).count()
+           << std::setw(13) << seconds(stats.serialization_time).count()
+           << '\n';
+
+        // Only the non-empty bins, as [lower, upper) microseconds: count
+        os << "  latency (us):";
+        for(std::size_t i = 0; i < OpStats::n_bins; ++i) {
+            if(stats.latency[i] == 0) continue;
+            os << " [" << (i == 0 ? 0 : std::size_t{1} << (i - 1)) << ", ";
+            if(i + 1 == OpStats::n_bins) {
+                os << "inf";
+            } else {
+                os << (std::size_t{1} << i);
+            }
+            os << "): " << stats.latency[i];
+        }
+        os << '\n';
+    }
+    return os.str();
+}
+
+} // namespace parallelzone::mpi_helpers
@@ -30,6 +30,8 @@ CommPP::CommPP(mpi_comm_type comm) :
   m_pimpl_(comm != MPI_COMM_NULL ? std::make_unique<pimpl_type>(comm) :
                                    nullptr) {}
 
+CommPP::CommPP(pimpl_pointer pimpl) noexcept : m_pimpl_(std::move(pimpl)) {}
+
 CommPP::CommPP(const CommPP& other) :
   m_pimpl_(other.has_pimpl_() ? other.m_pimpl_->clone() : nullptr) {}
 
@@ -66,6 +68,63 @@ CommPP::size_type CommPP::me() const noexcept {
 
 void CommPP::swap(CommPP& other) noexcept { m_pimpl_.swap(other.m_pimpl_); }
 
+CommPP CommPP::duplicate() const {
+    if(!has_pimpl_()) return CommPP();
+    return CommPP(m_pimpl_->duplicate());
+}
+
+// -----------------------------------------------------------------------------
+// -- Collective Algorithms
+// -----------------------------------------------------------------------------
+
+void CommPP::set_hierarchical_threshold(std::size_t n_bytes) {
+    pimpl_().set_hierarchical_threshold(n_bytes);
+}
+
+std::size_t CommPP::hierarchical_threshold() const {
+    return pimpl_().hierarchical_threshold();
+}
+
+void CommPP::set_node_color(size_type color) { pimpl_().set_node_color(color); }
+
+void CommPP::set_tuning(const tuning_type& tuning) {
+    pimpl_().set_tuning(tuning);
+}
+
+CommPP::tuning_type CommPP::tuning() const { return pimpl_().tuning(); }
+
+CommPP::tuning_type CommPP::tune(const std::string& path) {
+    return pimpl_().tune(path);
+}
+
+// -----------------------------------------------------------------------------
+// -- Compression
+// -----------------------------------------------------------------------------
+
+void CommPP::set_compression(codec_pointer codec, std::size_t threshold) {
+    pimpl_().set_compression(std::move(codec), threshold);
+}
+
+CommPP::compression_stats_type CommPP::compression_stats() const {
+    return pimpl_().compression_stats();
+}
+
+void CommPP::reset_compression_stats() { pimpl_().reset_compression_stats(); }
+
+// -----------------------------------------------------------------------------
+// -- Instrumentation
+// -----------------------------------------------------------------------------
+
+void CommPP::set_instrumentation(bool on) { pimpl_().set_instrumentation(on); }
+
+bool CommPP::instrumenting() const { return pimpl_().instrumenting(); }
+
+CommPP::comm_stats_type CommPP::comm_stats() const {
+    return pimpl_().comm_stats();
+}
+
+void CommPP::reset_comm_stats() { pimpl_().reset_comm_stats(); }
+
 bool CommPP::operator==(const CommPP& rhs) const noexcept {
     if(has_pimpl_() != rhs.has_pimpl_()) return false;
     if(!has_pimpl_()) return true; // Both Null
@@ -76,6 +135,26 @@ bool CommPP::operator!=(const CommPP& rhs) const noexcept {
     return !(*this == rhs);
 }
 
+// -----------------------------------------------------------------------------
+// -- Point-to-Point
+// -----------------------------------------------------------------------------
+
+CommPP::tag_type CommPP::tag(const std::string& name) const {
+    return pimpl_().tag(name);
+}
+
+// -----------------------------------------------------------------------------
+// -- One-Sided Communication
+// -----------------------------------------------------------------------------
+
+CommPP::window_type CommPP::allocate_window(std::size_t n_bytes) const {
+    return pimpl_().allocate_window(n_bytes);
+}
+
+CommPP::window_type CommPP::expose_window(binary_reference region) const {
+    return pimpl_().expose_window(region);
+}
+
 // -----------------------------------------------------------------------------
 // -- Private Methods
 // -----------------------------------------------------------------------------
@@ -87,19 +166,155 @@ const CommPP::pimpl_type& CommPP::pimpl_() const {
     throw std::runtime_error("CommPP does not have a PIMPL.");
 }
 
+CommPP::pimpl_type& CommPP::pimpl_() {
+    if(has_pimpl_()) return *m_pimpl_;
+    throw std::runtime_error("CommPP does not have a PIMPL.");
+}
+
 CommPP::binary_gather_return CommPP::gather_(const_binary_reference data,
-                                             opt_root_t root) const {
-    return pimpl_().gather(data, root);
+                                             opt_root_t root,
+                                             algorithm alg) const {
+    return pimpl_().gather(data, root, alg);
 }
 
 void CommPP::gather_(const_binary_reference data, binary_reference out_buffer,
-                     opt_root_t root) const {
-    pimpl_().gather(data, out_buffer, root);
+                     opt_root_t root, algorithm alg) const {
+    pimpl_().gather(data, out_buffer, root, alg);
+}
+
+void CommPP::gather_in_place_(binary_reference data) const {
+    pimpl_().gather_in_place(data);
 }
 
 CommPP::binary_gatherv_return CommPP::gatherv_(const_binary_reference data,
-                                               opt_root_t root) const {
-    return pimpl_().gatherv(data, root);
+                                               opt_root_t root,
+                                               algorithm alg) const {
+    return pimpl_().gatherv(data, root, alg);
+}
+
+void CommPP::gatherv_(const_binary_reference data, binary_reference out_buffer,
+                      const byte_count_container& sizes,
+                      const byte_offset_container& displacements,
+                      opt_root_t root, algorithm alg) const {
+    pimpl_().gatherv(data, out_buffer, sizes, displacements, root, alg);
+}
+
+void CommPP::broadcast_(binary_reference data, size_type root) const {
+    pimpl_().broadcast(data, root);
+}
+
+void CommPP::serialized_(const char* op, clock_type::time_point start) const {
+    pimpl_().record_serialization(op, clock_type::now() - start);
+}
+
+void CommPP::reduce_(const void* send, void* recv, int n_elems,
+                     MPI_Datatype type, MPI_Op op, opt_root_t root) const {
+    pimpl_().reduce(send, recv, n_elems, type, op, root);
+}
+
+CommPP::request_type CommPP::ireduce_(const void* send, void* recv,
+                                      int n_elems, MPI_Datatype type,
+                                      MPI_Op op, opt_root_t root) const {
+    return pimpl_().ireduce(send, recv, n_elems, type, op, root);
+}
+
+bool CommPP::compressing_() const { return pimpl_().compressing(); }
+
+CommPP::binary_type CommPP::compress_(const_binary_reference data) const {
+    return pimpl_().compress(data);
+}
+
+CommPP::binary_type CommPP::decompress_(const_binary_reference data) const {
+    return pimpl_().decompress(data);
+}
+
+void CommPP::scatter_(const_binary_reference data, binary_reference out_buffer,
+                      size_type root) const {
+    pimpl_().scatter(data, out_buffer, root);
+}
+
+void CommPP::scatterv_(const_binary_reference data,
+                       const byte_count_container& sizes,
+                       const byte_offset_container& displacements,
+                       binary_reference out_buffer, size_type root) const {
+    pimpl_().scatterv(data, sizes, displacements, out_buffer, root);
+}
+
+CommPP::byte_count_container CommPP::broadcast_sizes_(
+  byte_count_container sizes, size_type root) const {
+    sizes.resize(size());
+    broadcast_(binary_reference(sizes.data(), sizes.size()), root);
+    return sizes;
+}
+
+void CommPP::alltoall_(const_binary_reference data,
+                       binary_reference out_buffer) const {
+    pimpl_().alltoall(data, out_buffer);
+}
+
+void CommPP::alltoallv_(const_binary_reference data,
+                        const byte_count_container& sizes,
+                        const byte_offset_container& displacements,
+                        binary_reference out_buffer,
+                        const byte_count_container& out_sizes,
+                        const byte_offset_container& out_displacements) const {
+    pimpl_().alltoallv(data, sizes, displacements, out_buffer, out_sizes,
+                       out_displacements);
+}
+
+CommPP::byte_count_container CommPP::alltoall_sizes_(
+  const byte_count_container& sizes) const {
+    byte_count_container rv(size());
+    const_binary_reference send(sizes.data(), sizes.size());
+    alltoall_(send, binary_reference(rv.data(), rv.size()));
+    return rv;
+}
+
+CommPP::byte_offset_container CommPP::displacements_(
+  const byte_count_container& sizes) {
+    byte_offset_container rv(sizes.size(), 0);
+    for(std::size_t i = 1; i < sizes.size(); ++i)
+        rv[i] = rv[i - 1] + sizes[i - 1];
+    return rv;
+}
+
+CommPP::request_type CommPP::igather_(const_binary_reference data,
+                                      binary_reference out_buffer,
+                                      opt_root_t root) const {
+    return pimpl_().igather(data, out_buffer, root);
+}
+
+CommPP::request_type CommPP::igatherv_(
+  const_binary_reference data, binary_reference out_buffer,
+  const byte_count_container& sizes,
+  const byte_offset_container& displacements, opt_root_t root,
+  std::shared_ptr<const void>& keep_alive) const {
+    return pimpl_().igatherv(data, out_buffer, sizes, displacements, root,
+                             keep_alive);
+}
+
+void CommPP::send_(const_binary_reference data, size_type dest,
+                   tag_type tag) const {
+    pimpl_().send(data, dest, tag);
+}
+
+CommPP::request_type CommPP::isend_(const_binary_reference data,
+                                    size_type dest, tag_type tag) const {
+    return pimpl_().isend(data, dest, tag);
+}
+
+CommPP::probe_return CommPP::probe_(size_type source, tag_type tag,
+                                    bool block) const {
+    return pimpl_().probe(source, tag, block);
+}
+
+void CommPP::recv_(message_type& message, binary_reference out_buffer) const {
+    pimpl_().recv(message, out_buffer);
+}
+
+CommPP::request_type CommPP::irecv_(message_type& message,
+                                    binary_reference out_buffer) const {
+    return pimpl_().irecv(message, out_buffer);
 }
 
 } // namespace parallelzone::mpi_helpers
@@ -0,0 +1,155 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "active_messenger_pimpl.hpp"
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <stdexcept>
+#include <string>
+
+namespace parallelzone::mpi_helpers::detail_ {
+namespace {
+
+/// Type of the header of each record in a batch: handler id and byte count
+using header_type = std::array<std::uint64_t, 2>;
+
+/// Type of the rank at the start of each batch
+using rank_type = std::uint64_t;
+
+/// The tag batches are sent with (they're the only traffic on the comm)
+constexpr int batch_tag = 0;
+
+/// Appends the raw bytes of @p value to @p batch
+template<typename T>
+void append_bytes(std::vector<std::byte>& batch, const T& value) {
+    const auto* p = reinterpret_cast<const std::byte*>(&value);
+    batch.insert(batch.end(), p, p + sizeof(T));
+}
+
+} // namespace
+
+ActiveMessengerPIMPL::ActiveMessengerPIMPL(const CommPP& comm,
+                                           std::size_t batch_size) :
+  m_comm_(comm.duplicate()), m_batch_size_(batch_size) {
+    if(m_comm_.comm() == MPI_COMM_NULL)
+        throw std::runtime_error("Can not send messages on a null "
+                                 "communicator");
+    m_batches_.resize(m_comm_.size());
+    m_recv_ = m_comm_.irecv<batch_type>(MPI_ANY_SOURCE, batch_tag);
+}
+
+void ActiveMessengerPIMPL::send(id_type id, size_type rank,
+                                ConstBinaryView args) {
+    if(id >= m_handlers_.size())
+        throw std::out_of_range("Handler " + std::to_string(id) +
+                                " is not registered");
+    if(rank < 0 || rank >= m_comm_.size())
+        throw std::out_of_range("Rank " + std::to_string(rank) +
+                                " is not part of the communicator");
+
+    auto& batch = m_batches_[rank];
+    if(batch.empty()) append_bytes(batch, rank_type(m_comm_.me()));
+    append_bytes(batch, header_type{id, args.size()});
+    batch.insert(batch.end(), args.begin(), args.end());
+    ++m_stats_.n_sent;
+    if(batch.size() >= m_batch_size_) flush(rank);
+}
+
+void ActiveMessengerPIMPL::flush(size_type rank) {
+    auto& batch = m_batches_[rank];
+    if(batch.empty()) return;
+    m_in_flight_.push_back(m_comm_.isend(std::move(batch), rank, batch_tag));
+    batch = batch_type{};
+    ++m_stats_.n_batches;
+}
+
+void ActiveMessengerPIMPL::flush() {
+    for(size_type rank = 0; rank < m_comm_.size(); ++rank) flush(rank);
+}
+
+std::size_t ActiveMessengerPIMPL::poll() {
+    test_sends_();
+    std::size_t n_handled = 0;
+    while(m_recv_.ready()) {
+        auto batch = m_recv_.get();
+        m_recv_    = m_comm_.irecv<batch_type>(MPI_ANY_SOURCE, batch_tag);
+        ++m_n_received_;
+        n_handled += handle_(batch);
+    }
+    return n_handled;
+}
+
+void ActiveMessengerPIMPL::fence() {
+    // Each wave flushes, then sums the batches sent and received. Batches
+    // are only made while handling messages, so once the sums agree, and
+    // match the previous wave's, nothing is left in flight.
+    using counts_type = std::vector<std::uint64_t>;
+    counts_type previous{1, 0};
+    while(true) {
+        flush();
+        counts_type mine{m_stats_.n_batches, m_n_received_};
+        auto wave = m_comm_.ireduce(mine, std::plus<std::uint64_t>());
+        // Poll at least once, even if the reduction finished right away
+        do {
+            poll();
+        } while(!wave.ready());
+        const auto total = wave.get();
+        if(total[0] == total[1] && total == previous) break;
+        previous = total;
+    }
+
+    // Everything has been received, so the sends can complete
+    for(auto& sent : m_in_flight_) sent.wait();
+    m_in_flight_.clear();
+}
+
+void ActiveMessengerPIMPL::test_sends_() {
+    for(auto it = m_in_flight_.begin(); it != m_in_flight_.end();)
+        it = it->ready() ? m_in_flight_.erase(it) : std::next(it);
+}
+
+std::size_t ActiveMessengerPIMPL::handle_(const batch_type& batch) {
+    rank_type source;
+    std::memcpy(&source, batch.data(), sizeof(source));
+
+    // Restores m_source_ even if a handler throws
+    struct source_guard {
+        size_type& source;
+        ~source_guard() { source = MPI_PROC_NULL; }
+    } guard{m_source_};
+    m_source_ = source;
+
+    std::size_t n_handled = 0;
+    for(std::size_t i = sizeof(source); i < batch.size();) {
+        header_type header;
+        std::memcpy(header.data(), batch.data() + i, sizeof(header));
+        i += sizeof(header);
+        ConstBinaryView args(batch.data() + i, header[1]);
+        i += header[1];
+        if(header[0] >= m_handlers_.size())
+            throw std::runtime_error("Received a message for handler " +
+                                     std::to_string(header[0]) +
+                                     ", which is not registered");
+        ++m_stats_.n_handled;
+        ++n_handled;
+        m_handlers_[header[0]](args);
+    }
+    return n_handled;
+}
+
+} // namespace parallelzone::mpi_helpers::detail_
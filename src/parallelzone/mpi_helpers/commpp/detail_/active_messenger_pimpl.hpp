@@ -0,0 +1,119 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <list>
+#include <parallelzone/mpi_helpers/commpp/active_messenger.hpp>
+#include <parallelzone/mpi_helpers/commpp/commpp.hpp>
+#include <vector>
+
+namespace parallelzone::mpi_helpers::detail_ {
+
+/** @brief Implements the ActiveMessenger class.
+ *
+ *  A batch starts with the rank of the sender, followed by a sequence of
+ *  records, each of which is the id of the handler, the number of bytes of
+ *  arguments, and the arguments. Batches are sent with CommPP::isend (tag 0
+ *  on the duplicated communicator). One CommPP::irecv from any source is
+ *  always outstanding; each time it completes a new one is posted.
+ */
+class ActiveMessengerPIMPL {
+public:
+    /// Type of the class *this implements
+    using parent_type = ActiveMessenger;
+
+    /// Ultimately a typedef of ActiveMessenger::size_type
+    using size_type = parent_type::size_type;
+
+    /// Ultimately a typedef of ActiveMessenger::id_type
+    using id_type = parent_type::id_type;
+
+    /// Ultimately a typedef of ActiveMessenger::handler_type
+    using handler_type = parent_type::handler_type;
+
+    /// Ultimately a typedef of ActiveMessenger::stats_type
+    using stats_type = parent_type::stats_type;
+
+    /// Type of a batch of messages
+    using batch_type = std::vector<std::byte>;
+
+    /// Type of a future tracking a send (it owns the batch being sent)
+    using send_future = CommPP::future_type<void>;
+
+    /// Type of a future receiving a batch
+    using recv_future = CommPP::future_type<batch_type>;
+
+    /// Duplicates @p comm, see ActiveMessenger's ctor
+    ActiveMessengerPIMPL(const CommPP& comm, std::size_t batch_size);
+
+    /// Registers @p handler, returning its id
+    id_type add_handler(handler_type handler) {
+        m_handlers_.push_back(std::move(handler));
+        return m_handlers_.size() - 1;
+    }
+
+    /// Appends a message to @p rank's batch, sending it if it is full
+    void send(id_type id, size_type rank, ConstBinaryView args);
+
+    /// Sends the batch for @p rank, if it has any messages
+    void flush(size_type rank);
+
+    /// Sends every batch
+    void flush();
+
+    /// Handles every message which has arrived, see ActiveMessenger::poll
+    std::size_t poll();
+
+    /// Waits for every message to be handled, see ActiveMessenger::fence
+    void fence();
+
+    /// The duplicated communicator messages are sent on
+    CommPP m_comm_;
+
+    /// Batches are sent when they reach this many bytes
+    std::size_t m_batch_size_;
+
+    /// The registered handlers
+    std::vector<handler_type> m_handlers_;
+
+    /// The batch being built for each process
+    std::vector<batch_type> m_batches_;
+
+    /// Batches which have been sent, but may not have completed
+    std::list<send_future> m_in_flight_;
+
+    /// The receive for the next batch
+    recv_future m_recv_;
+
+    /// The number of batches this process has received
+    std::size_t m_n_received_ = 0;
+
+    /// The rank which sent the message being handled
+    size_type m_source_ = MPI_PROC_NULL;
+
+    /// What this process has done
+    stats_type m_stats_;
+
+private:
+    /// Completes the sends in m_in_flight_ which have finished
+    void test_sends_();
+
+    /// Runs the handlers of the messages in @p batch
+    std::size_t handle_(const batch_type& batch);
+};
+
+} // namespace parallelzone::mpi_helpers::detail_
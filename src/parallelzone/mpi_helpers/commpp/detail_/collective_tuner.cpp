@@ -0,0 +1,188 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "collective_tuner.hpp"
+#include "commpp_pimpl.hpp"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+namespace parallelzone::mpi_helpers::detail_ {
+namespace {
+
+using size_type      = CollectiveTuner::size_type;
+using size_container = CollectiveTuner::size_container;
+using algorithm      = CommPP::algorithm;
+
+/// Sizes of the blocks (per process) to try sending eagerly
+const size_container eager_blocks{8, 32, 128, 512, 2048, 8192};
+
+/// Sizes of the blocks (per process) to try all gathering with each algorithm
+const size_container allgather_blocks{1 << 10, 1 << 12, 1 << 14,
+                                      1 << 16, 1 << 18, 1 << 20};
+
+/// Each size is timed about this many bytes' worth (within limits)
+constexpr size_type bytes_per_batch = size_type(1) << 22;
+
+} // namespace
+
+CollectiveTuner::CollectiveTuner(const CommPPPIMPL& comm) :
+  m_comm_(comm), m_scratch_(comm.duplicate()) {}
+
+CollectiveTuner::~CollectiveTuner() noexcept = default;
+
+CollectiveTuner::tuning_type CollectiveTuner::measure() {
+    const auto& topo = m_comm_.topology();
+    const auto n     = m_comm_.size();
+
+    auto rv    = m_comm_.tuning();
+    rv.n_procs = n;
+    rv.n_nodes = topo.n_nodes();
+
+    // Step 0: Eager vs. two-phase all gathervs, for the blocks whose slots
+    //         automatic all gathervs would send
+    size_container blocks;
+    for(const auto block : eager_blocks) {
+        auto candidate            = rv;
+        candidate.eager_threshold = block;
+        if(candidate.goes_eager(n)) blocks.push_back(block);
+    }
+    rv.eager_threshold = 0;
+    if(!blocks.empty()) {
+        const auto two_phase = time_allgatherv_(blocks, algorithm::flat);
+        const auto eager     = time_allgatherv_(blocks, algorithm::eager);
+        rv.eager_threshold   = last_win(blocks, two_phase, eager);
+    }
+
+    // Step 1: Ring and hierarchical vs. flat all gathers
+    size_container totals;
+    for(const auto block : allgather_blocks) totals.push_back(block * n);
+    const auto flat = time_allgather_(totals, algorithm::flat);
+    if(n > 2) {
+        const auto ring   = time_allgather_(totals, algorithm::ring);
+        rv.ring_threshold = crossover(totals, flat, ring);
+    }
+    if(topo.n_nodes() > 1 && topo.n_nodes() < n) {
+        const auto hier = time_allgather_(totals, algorithm::hierarchical);
+        rv.hierarchical_threshold = crossover(totals, flat, hier);
+    }
+
+    // Step 2: Is compression worth it at the bandwidth of a flat all gather?
+    if(n > 1 && m_comm_.codec()) {
+        const double n_received = double(allgather_blocks.back()) * (n - 1);
+        rv.compress = measure_compression_(n_received / flat.back());
+    }
+    return rv;
+}
+
+size_type CollectiveTuner::crossover(const size_container& sizes,
+                                     const time_container& baseline,
+                                     const time_container& candidate) noexcept {
+    auto rv = tuning_type::never;
+    for(auto i = sizes.size(); i-- > 0;) {
+        if(candidate[i] >= baseline[i]) break;
+        rv = sizes[i];
+    }
+    return rv;
+}
+
+size_type CollectiveTuner::last_win(const size_container& sizes,
+                                    const time_container& baseline,
+                                    const time_container& candidate) noexcept {
+    size_type rv = 0;
+    for(std::size_t i = 0; i < sizes.size(); ++i) {
+        if(candidate[i] >= baseline[i]) break;
+        rv = sizes[i];
+    }
+    return rv;
+}
+
+bool CollectiveTuner::compression_pays_off(double seconds_per_byte,
+                                           double ratio,
+                                           double bandwidth) noexcept {
+    if(ratio <= 1.0) return false;
+    return seconds_per_byte < (1.0 - 1.0 / ratio) / bandwidth;
+}
+
+double CollectiveTuner::time_(const op_type& op, size_type n_bytes) const {
+    using clock_type     = std::chrono::steady_clock;
+    const size_type reps = std::clamp<size_type>(
+      bytes_per_batch / std::max<size_type>(n_bytes, 1), 2, 20);
+    const auto comm = m_scratch_->comm();
+
+    op(); // Warm up
+    double best = std::numeric_limits<double>::max();
+    for(int batch = 0; batch < 3; ++batch) {
+        MPI_Barrier(comm);
+        const auto start = clock_type::now();
+        for(size_type i = 0; i < reps; ++i) op();
+        const std::chrono::duration<double> dt = clock_type::now() - start;
+        best = std::min(best, dt.count() / double(reps));
+    }
+    double slowest = 0.0;
+    MPI_Allreduce(&best, &slowest, 1, MPI_DOUBLE, MPI_MAX, comm);
+    return slowest;
+}
+
+CollectiveTuner::time_container CollectiveTuner::time_allgather_(
+  const size_container& sizes, algorithm alg) const {
+    time_container rv;
+    for(const auto total : sizes) {
+        CommPPPIMPL::binary_type in(total / m_scratch_->size());
+        CommPPPIMPL::binary_type out(total);
+        CommPPPIMPL::const_binary_reference in_view(in.data(), in.size());
+        CommPPPIMPL::binary_reference out_view(out.data(), out.size());
+        auto op = [&]() {
+            m_scratch_->gather(in_view, out_view, std::nullopt, alg);
+        };
+        rv.push_back(time_(op, total));
+    }
+    return rv;
+}
+
+CollectiveTuner::time_container CollectiveTuner::time_allgatherv_(
+  const size_container& sizes, algorithm alg) const {
+    auto tuning = m_scratch_->tuning();
+    time_container rv;
+    for(const auto block : sizes) {
+        tuning.eager_threshold = alg == algorithm::eager ? block : 0;
+        m_scratch_->set_tuning(tuning);
+        CommPPPIMPL::binary_type in(block);
+        CommPPPIMPL::const_binary_reference in_view(in.data(), in.size());
+        auto op = [&]() { m_scratch_->gatherv(in_view, std::nullopt, alg); };
+        rv.push_back(time_(op, block * m_scratch_->size()));
+    }
+    return rv;
+}
+
+bool CollectiveTuner::measure_compression_(double bandwidth) const {
+    using seconds     = std::chrono::duration<double>;
+    const auto& stats = m_comm_.compression_stats();
+
+    // Sum the statistics over all of the processes, so they all agree
+    const seconds time = stats.compress_time + stats.decompress_time;
+    double local[3]    = {double(stats.bytes_in), double(stats.bytes_out),
+                          time.count()};
+    double total[3]    = {0.0, 0.0, 0.0};
+    MPI_Allreduce(local, total, 3, MPI_DOUBLE, MPI_SUM, m_scratch_->comm());
+
+    // Nothing has been compressed, so there is nothing to go on
+    if(total[0] == 0.0) return m_comm_.tuning().compress;
+    return compression_pays_off(total[2] / total[0], total[0] / total[1],
+                                bandwidth);
+}
+
+} // namespace parallelzone::mpi_helpers::detail_
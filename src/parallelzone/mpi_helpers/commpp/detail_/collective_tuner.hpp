@@ -0,0 +1,149 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <functional>
+#include <memory>
+#include <parallelzone/mpi_helpers/commpp/commpp.hpp>
+#include <vector>
+
+namespace parallelzone::mpi_helpers::detail_ {
+class CommPPPIMPL;
+
+/** @brief Measures the thresholds CommPP uses to pick collective algorithms.
+ *
+ *  For each algorithm a CollectiveTuning threshold controls, the tuner times
+ *  it and the default (flat, two-phase) algorithm over a range of message
+ *  sizes, and picks the threshold from where one starts beating the other.
+ *  The timings are the slowest process's (best of a few batches), so every
+ *  process picks the same thresholds. The measuring is done on a duplicate
+ *  of the communicator, so it does not show up in its statistics.
+ *
+ *  Measuring is a collective operation and takes a fraction of a second for
+ *  a handful of processes.
+ */
+class CollectiveTuner {
+public:
+    /// Type of the thresholds being measured
+    using tuning_type = CommPP::tuning_type;
+
+    /// Type used for sizes (in bytes)
+    using size_type = tuning_type::size_type;
+
+    /// Type of a list of message sizes (in bytes)
+    using size_container = std::vector<size_type>;
+
+    /// Type of a list of times (in seconds)
+    using time_container = std::vector<double>;
+
+    /** @brief Prepares to measure the tuning of @p comm.
+     *
+     *  This is a collective operation (it duplicates @p comm).
+     *
+     *  @param[in] comm The communicator to measure. Its current tuning is
+     *                  used for anything which can not be measured.
+     */
+    explicit CollectiveTuner(const CommPPPIMPL& comm);
+
+    /// Defaulted, nothrow dtor
+    ~CollectiveTuner() noexcept;
+
+    /** @brief Measures every threshold.
+     *
+     *  The ring threshold is only measured with more than two processes, the
+     *  hierarchical threshold with several nodes of several processes, and
+     *  compression if a codec is set and has compressed something. Otherwise
+     *  the values from the communicator's current tuning are kept.
+     *
+     *  @return The measured tuning, with n_procs and n_nodes filled in.
+     */
+    tuning_type measure();
+
+    /** @brief The first size from which @p candidate is always faster.
+     *
+     *  @param[in] sizes     The sizes which were timed, in ascending order.
+     *  @param[in] baseline  The time of the default algorithm at each size.
+     *  @param[in] candidate The time of the other algorithm at each size.
+     *
+     *  @return The smallest size at which (and above which) @p candidate is
+     *          faster than @p baseline, or tuning_type::never if it is not
+     *          faster at the largest size.
+     *
+     *  @throw None No throw guarantee.
+     */
+    static size_type crossover(const size_container& sizes,
+                               const time_container& baseline,
+                               const time_container& candidate) noexcept;
+
+    /** @brief The last size up to which @p candidate is always faster.
+     *
+     *  @param[in] sizes     The sizes which were timed, in ascending order.
+     *  @param[in] baseline  The time of the default algorithm at each size.
+     *  @param[in] candidate The time of the other algorithm at each size.
+     *
+     *  @return The largest size at which (and below which) @p candidate is
+     *          faster than @p baseline, or 0 if it is not faster at the
+     *          smallest size.
+     *
+     *  @throw None No throw guarantee.
+     */
+    static size_type last_win(const size_container& sizes,
+                              const time_container& baseline,
+                              const time_container& candidate) noexcept;
+
+    /** @brief Does compressing save more time than it costs?
+     *
+     *  Compressing a byte costs @p seconds_per_byte (compressing plus
+     *  decompressing), and saves sending `1 - 1 / ratio` bytes at
+     *  @p bandwidth bytes per second.
+     *
+     *  @param[in] seconds_per_byte The codec's cost per uncompressed byte.
+     *  @param[in] ratio            The codec's compression ratio.
+     *  @param[in] bandwidth        The network's bandwidth (bytes/second).
+     *
+     *  @return True if compression saves time and false otherwise.
+     *
+     *  @throw None No throw guarantee.
+     */
+    static bool compression_pays_off(double seconds_per_byte, double ratio,
+                                     double bandwidth) noexcept;
+
+private:
+    /// Type of an operation being timed
+    using op_type = std::function<void()>;
+
+    /// Average seconds per call of @p op on the slowest process
+    double time_(const op_type& op, size_type n_bytes) const;
+
+    /// Times the all gathers with @p alg for each total size in @p sizes
+    time_container time_allgather_(const size_container& sizes,
+                                   CommPP::algorithm alg) const;
+
+    /// Times the all gathervs of serialized blocks of each size in @p sizes
+    time_container time_allgatherv_(const size_container& sizes,
+                                    CommPP::algorithm alg) const;
+
+    /// Decides compression from the stats so far and @p bandwidth
+    bool measure_compression_(double bandwidth) const;
+
+    /// The communicator being tuned
+    const CommPPPIMPL& m_comm_;
+
+    /// A duplicate of m_comm_ to do the measuring on
+    std::unique_ptr<CommPPPIMPL> m_scratch_;
+};
+
+} // namespace parallelzone::mpi_helpers::detail_
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "comm_profiler.hpp"
+
+namespace parallelzone::mpi_helpers::detail_ {
+
+void CommProfiler::record(const char* op, std::size_t sent,
+                          std::size_t received, duration mpi,
+                          bool blocking) noexcept {
+    try {
+        std::lock_guard lock(m_mutex_);
+        m_stats_.ops[op].add_call(sent, received, mpi, blocking);
+    } catch(...) {
+        // Losing a record beats throwing out of an MPI operation
+    }
+}
+
+void CommProfiler::record_serialization(const char* op, duration t) noexcept {
+    try {
+        std::lock_guard lock(m_mutex_);
+        m_stats_.ops[op].serialization_time += t;
+    } catch(...) {
+        // Losing a record beats throwing out of an MPI operation
+    }
+}
+
+CommProfiler::stats_type CommProfiler::stats() const {
+    std::lock_guard lock(m_mutex_);
+    return m_stats_;
+}
+
+void CommProfiler::reset() {
+    std::lock_guard lock(m_mutex_);
+    m_stats_ = stats_type{};
+}
+
+} // namespace parallelzone::mpi_helpers::detail_
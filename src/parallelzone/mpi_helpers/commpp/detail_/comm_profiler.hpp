@@ -0,0 +1,143 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <parallelzone/mpi_helpers/commpp/comm_stats.hpp>
+
+namespace parallelzone::mpi_helpers::detail_ {
+
+/** @brief Collects the statistics of the operations done on a communicator.
+ *
+ *  CommProfiler is always compiled in, but only records anything while it is
+ *  enabled. When disabled, the cost of instrumenting an operation is a
+ *  relaxed atomic load (and possibly reading the clock). Copies of a
+ *  communicator share a CommProfiler, so each communicator has one set of
+ *  statistics no matter how many copies of it are in use.
+ *
+ *  CommProfiler is thread-safe.
+ */
+class CommProfiler {
+public:
+    /// Type of the statistics collected
+    using stats_type = CommStats;
+
+    /// Type used to measure time durations
+    using duration = OpStats::duration;
+
+    /// Type of the clock used to time operations
+    using clock_type = std::chrono::high_resolution_clock;
+
+    /** @brief Times one MPI operation for as long as it is in scope.
+     *
+     *  The operation is recorded when the timer is destroyed, if the
+     *  profiler was enabled when the timer was created. For nonblocking
+     *  operations the timer only covers starting the operation, so such
+     *  timers should be made with @p blocking set to false.
+     */
+    class OpTimer {
+    public:
+        /// Starts timing operation @p op, which moves the given bytes
+        OpTimer(CommProfiler& profiler, const char* op, std::size_t sent,
+                std::size_t received, bool blocking = true) :
+          m_profiler_(profiler.enabled() ? &profiler : nullptr),
+          m_op_(op),
+          m_sent_(sent),
+          m_received_(received),
+          m_blocking_(blocking) {
+            if(m_profiler_) m_start_ = clock_type::now();
+        }
+
+        /// Records the operation
+        ~OpTimer() noexcept {
+            if(!m_profiler_) return;
+            const auto t = clock_type::now() - m_start_;
+            m_profiler_->record(m_op_, m_sent_, m_received_, t, m_blocking_);
+        }
+
+        OpTimer(const OpTimer&)            = delete;
+        OpTimer& operator=(const OpTimer&) = delete;
+
+    private:
+        /// The profiler to record into, null if it was disabled
+        CommProfiler* m_profiler_;
+
+        /// The name of the operation
+        const char* m_op_;
+
+        /// The number of bytes sent and received
+        std::size_t m_sent_;
+        std::size_t m_received_;
+
+        /// False if only the start of a nonblocking operation is timed
+        bool m_blocking_;
+
+        /// When the operation started
+        clock_type::time_point m_start_;
+    };
+
+    /// Turns recording on or off
+    void enable(bool on) noexcept { m_enabled_.store(on); }
+
+    /// Is recording turned on?
+    bool enabled() const noexcept {
+        return m_enabled_.load(std::memory_order_relaxed);
+    }
+
+    /** @brief Records one call to operation @p op.
+     *
+     *  @param[in] op       The name of the operation.
+     *  @param[in] sent     The number of bytes this process sent.
+     *  @param[in] received The number of bytes this process received.
+     *  @param[in] mpi      The time the call spent in MPI.
+     *  @param[in] blocking False if the call only started a nonblocking
+     *                      operation (see OpStats::add_call).
+     *
+     *  @throw None No throw guarantee. If the statistics of @p op can not be
+     *              allocated the call is not recorded.
+     */
+    void record(const char* op, std::size_t sent, std::size_t received,
+                duration mpi, bool blocking = true) noexcept;
+
+    /** @brief Adds @p t to the serialization time of operation @p op.
+     *
+     *  Unlike record, this does not count as a call to @p op.
+     *
+     *  @throw None No throw guarantee. If the statistics of @p op can not be
+     *              allocated the time is not recorded.
+     */
+    void record_serialization(const char* op, duration t) noexcept;
+
+    /// A copy of the statistics recorded so far
+    stats_type stats() const;
+
+    /// Zeros the statistics
+    void reset();
+
+private:
+    /// Is recording on?
+    std::atomic<bool> m_enabled_ = false;
+
+    /// Guards m_stats_
+    mutable std::mutex m_mutex_;
+
+    /// The statistics recorded so far
+    stats_type m_stats_;
+};
+
+} // namespace parallelzone::mpi_helpers::detail_
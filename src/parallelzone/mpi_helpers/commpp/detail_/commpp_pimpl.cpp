@@ -14,14 +14,176 @@
  * limitations under the License.
  */
 
+#include "collective_tuner.hpp"
 #include "commpp_pimpl.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
 
 namespace parallelzone::mpi_helpers::detail_ {
 
 CommPPPIMPL::CommPPPIMPL(mpi_comm_type comm) :
-  m_comm_(comm), m_my_rank_(0), m_size_(0) {
+  m_comm_(comm),
+  m_my_rank_(0),
+  m_size_(0),
+  m_profiler_(std::make_shared<profiler_type>()) {
     MPI_Comm_rank(m_comm_, &m_my_rank_);
     MPI_Comm_size(m_comm_, &m_size_);
+
+    // MPI guarantees MPI_TAG_UB is at least 32767
+    void* p_tag_ub = nullptr;
+    int flag       = 0;
+    MPI_Comm_get_attr(m_comm_, MPI_TAG_UB, &p_tag_ub, &flag);
+    tag_type tag_ub = flag ? *static_cast<int*>(p_tag_ub) : 32767;
+    m_tags_         = std::make_shared<tag_registry_type>(tag_ub);
+}
+
+CommPPPIMPL::pimpl_pointer CommPPPIMPL::duplicate() const {
+    mpi_comm_type dup;
+    MPI_Comm_dup(m_comm_, &dup);
+
+    auto rv        = std::make_unique<CommPPPIMPL>(dup);
+    auto free_comm = [](const mpi_comm_type* p) {
+        int finalized;
+        MPI_Finalized(&finalized);
+        if(!finalized) MPI_Comm_free(const_cast<mpi_comm_type*>(p));
+        delete p;
+    };
+    rv->m_owner_ = comm_owner_pointer(new mpi_comm_type(dup), free_comm);
+
+    // The settings carry over, but the node layout is for the old comm
+    rv->m_tuning_                = m_tuning_;
+    rv->m_node_color_            = m_node_color_;
+    rv->m_codec_                 = m_codec_;
+    rv->m_compression_threshold_ = m_compression_threshold_;
+
+    // The duplicate is a different communicator, so it gets its own stats
+    rv->set_instrumentation(instrumenting());
+    return rv;
+}
+
+// -----------------------------------------------------------------------------
+// -- Collective Algorithms
+// -----------------------------------------------------------------------------
+
+void CommPPPIMPL::set_node_color(size_type color) {
+    m_node_color_ = color;
+    m_topology_.reset();
+}
+
+const CommPPPIMPL::topology_type& CommPPPIMPL::topology() const {
+    if(!m_topology_)
+        m_topology_ = std::make_shared<topology_type>(m_comm_, m_node_color_);
+    return *m_topology_;
+}
+
+CommPPPIMPL::tuning_type CommPPPIMPL::tune(const std::string& path) {
+    const size_type n_nodes = topology().n_nodes();
+
+    // Step 0: Process 0 looks for a tuning file measured with this layout
+    std::string text;
+    if(me() == 0 && !path.empty() && std::filesystem::exists(path)) {
+        try {
+            const auto loaded = tuning_type::load(path);
+            if(loaded.matches(size(), n_nodes)) text = loaded.to_string();
+        } catch(const std::runtime_error&) {} // Bad files are just replaced
+    }
+
+    // Step 1: Share what it found (if anything) with everybody
+    std::uint64_t n_chars = text.size();
+    bcast_bytes(&n_chars, sizeof(n_chars), 0, m_comm_);
+    if(n_chars > 0) {
+        text.resize(n_chars);
+        bcast_bytes(text.data(), n_chars, 0, m_comm_);
+        m_tuning_ = tuning_type::from_string(text);
+        return m_tuning_;
+    }
+
+    // Step 2: Measure the tuning and have process 0 save it
+    m_tuning_ = CollectiveTuner(*this).measure();
+    int saved = 1;
+    if(me() == 0 && !path.empty()) {
+        try {
+            m_tuning_.save(path);
+        } catch(const std::runtime_error&) { saved = 0; }
+    }
+    bcast_bytes(&saved, sizeof(saved), 0, m_comm_);
+    if(!saved) throw std::runtime_error("Could not write " + path);
+    return m_tuning_;
+}
+
+// -----------------------------------------------------------------------------
+// -- Compression
+// -----------------------------------------------------------------------------
+
+namespace {
+
+/// Header of a block made by compress: is it compressed, and original size
+constexpr std::size_t header_size = 1 + sizeof(std::uint64_t);
+
+/// Type of the clock used to time compression
+using clock_type = std::chrono::high_resolution_clock;
+
+} // namespace
+
+void CommPPPIMPL::set_compression(codec_pointer codec,
+                                  std::size_t threshold) noexcept {
+    m_codec_                 = std::move(codec);
+    m_compression_threshold_ = threshold;
+    reset_compression_stats();
+}
+
+CommPPPIMPL::binary_type CommPPPIMPL::compress(
+  const_binary_reference data) const {
+    if(!compressing()) throw std::runtime_error("Compression is off");
+    const auto start = clock_type::now();
+
+    const std::uint64_t n = data.size();
+    Codec::buffer_type block(header_size);
+    std::memcpy(block.data() + 1, &n, sizeof(n));
+
+    // Fall back to the raw bytes if compressing doesn't help
+    bool compressed = false;
+    if(n > 0 && n >= m_compression_threshold_) {
+        m_codec_->compress(data, block);
+        compressed = block.size() < header_size + n;
+        if(!compressed) block.resize(header_size);
+    }
+    if(!compressed) block.insert(block.end(), data.begin(), data.end());
+    block[0] = std::byte(compressed);
+
+    auto& stats = m_compression_stats_;
+    stats.bytes_in += n;
+    stats.bytes_out += block.size();
+    ++(compressed ? stats.n_compressed : stats.n_skipped);
+    stats.compress_time += clock_type::now() - start;
+    return make_binary_buffer(std::move(block));
+}
+
+CommPPPIMPL::binary_type CommPPPIMPL::decompress(
+  const_binary_reference data) const {
+    if(!compressing()) throw std::runtime_error("Compression is off");
+    if(data.size() < header_size)
+        throw std::runtime_error("Compressed block is missing its header");
+    const auto start = clock_type::now();
+
+    std::uint64_t n = 0;
+    std::memcpy(&n, data.data() + 1, sizeof(n));
+    const_binary_reference payload(data.data() + header_size,
+                                   data.size() - header_size);
+
+    binary_type rv(n);
+    if(*data.data() != std::byte{0}) {
+        m_codec_->decompress(payload, rv);
+    } else if(payload.size() == n) {
+        std::copy(payload.begin(), payload.end(), rv.begin());
+    } else {
+        throw std::runtime_error("Uncompressed block has the wrong size");
+    }
+
+    m_compression_stats_.decompress_time += clock_type::now() - start;
+    return rv;
 }
 
 // -----------------------------------------------------------------------------
@@ -29,23 +191,24 @@ CommPPPIMPL::CommPPPIMPL(mpi_comm_type comm) :
 // -----------------------------------------------------------------------------
 
 CommPPPIMPL::binary_gather_return CommPPPIMPL::gather(
-  const_binary_reference data, opt_root_t root) const {
+  const_binary_reference data, opt_root_t root, algorithm alg) const {
     // Everybody is root if root is not provided
     bool am_i_root = root.has_value() ? me() == *root : true;
 
     // Each rank sends n bytes, so if I'm root I get comm_size * n bytes.
     // All other ranks get nothing
-    int recv_size = !am_i_root ? 0 : size() * data.size();
+    std::size_t recv_size = !am_i_root ? 0 : size() * data.size();
     binary_type buffer(recv_size);
     binary_reference pbuffer(buffer.data(), buffer.size());
-    gather(data, pbuffer, root);
+    gather(data, pbuffer, root, alg);
     binary_gather_return rv;
     if(am_i_root) rv.emplace(std::move(buffer));
     return rv;
 }
 
 void CommPPPIMPL::gather(const_binary_reference data,
-                         binary_reference out_buffer, opt_root_t root) const {
+                         binary_reference out_buffer, opt_root_t root,
+                         algorithm alg) const {
     // Everybody is root if root is not provided
     auto am_i_root = root.has_value() ? me() == *root : true;
 
@@ -55,52 +218,61 @@ void CommPPPIMPL::gather(const_binary_reference data,
     if(am_i_root && out_buffer.size() < n_in * size())
         throw std::runtime_error("The provided buffer is not large enough...");
 
-    if(root.has_value()) {
-        MPI_Gather(p_in, n_in, MPI_BYTE, p_out, n_in, MPI_BYTE, *root, m_comm_);
+    const auto timer = time_(root ? "gather" : "allgather", n_in,
+                             am_i_root ? n_in * size() : 0);
+    if(!root.has_value() && choose_(n_in * size(), alg) != algorithm::flat) {
+        byte_count_container sizes(size(), n_in);
+        byte_offset_container disp(size(), 0);
+        for(size_type i = 1; i < size(); ++i) disp[i] = disp[i - 1] + n_in;
+        allgatherv_(data, sizes, disp, out_buffer, alg);
     } else {
-        MPI_Allgather(p_in, n_in, MPI_BYTE, p_out, n_in, MPI_BYTE, m_comm_);
+        gather_bytes(p_in, n_in, p_out, root, m_comm_);
     }
 }
 
+void CommPPPIMPL::gather_in_place(binary_reference data) const {
+    const std::size_t n_ranks = size();
+    if(data.size() % n_ranks)
+        throw std::runtime_error("Can not split the buffer evenly over the "
+                                 "processes");
+    const auto timer = time_("allgather", data.size() / n_ranks, data.size());
+    gather_bytes(MPI_IN_PLACE, data.size() / n_ranks, data.data(),
+                 std::nullopt, m_comm_);
+}
+
 CommPPPIMPL::binary_gatherv_return CommPPPIMPL::gatherv(
-  const_binary_reference data, opt_root_t root) const {
+  const_binary_reference data, opt_root_t root, algorithm alg) const {
+    // Only all gathervs can be eager, every process needs to see the slots
+    const bool eager = alg == algorithm::eager ||
+                       (alg == algorithm::automatic &&
+                        m_tuning_.goes_eager(size()));
+    if(!root.has_value() && eager) return eager_allgatherv_(data, alg);
+
     const bool am_i_root = root.has_value() ? me() == *root : true;
 
-    auto p_in = data.data();
-    int n_in  = data.size(); // Need the 'int' to convert from std::size_t
+    byte_count_type n_in = data.size();
 
-    // Step 0: Gather the data sizes (in bytes) to the root, result is 'sizes'
+    // Step 0: Every process learns the data sizes (in bytes), even if only
+    //         the root gets the data, so they all move the bytes the same way
     const_binary_reference local_size(&n_in, 1);
-    std::vector<int> sizes;
-    if(am_i_root) std::vector<int>(size(), 0).swap(sizes);
+    byte_count_container sizes(size(), 0);
     binary_reference size_buffer(sizes.data(), sizes.size());
-    gather(local_size, size_buffer, root);
+    gather(local_size, size_buffer, std::nullopt, algorithm::flat);
 
-    // Step 1: On root compute displacements and allocate buffer for gathered
+    // Step 1: Compute displacements and, on root, allocate buffer for gathered
     //         results. N.B. p_recv + disp[i] = address where rank i's data goes
-    std::vector<int> disp;
-    binary_type buffer;
-    if(am_i_root) {
-        int total = 0;
-        // In our case rank i's results go immediately after rank (i-1)'s
-        for(size_type i = 0; i < size(); ++i) {
-            disp.push_back(total);
-            total += sizes[i];
-        }
-        binary_type(std::size_t(total)).swap(buffer);
+    byte_offset_container disp;
+    byte_offset_type total = 0;
+    // In our case rank i's results go immediately after rank (i-1)'s
+    for(size_type i = 0; i < size(); ++i) {
+        disp.push_back(total);
+        total += sizes[i];
     }
+    binary_type buffer;
+    if(am_i_root) binary_type(std::size_t(total)).swap(buffer);
 
     // Step 2: Do the gatherv/all gatherv
-    auto* p_out        = buffer.data();
-    const auto* p_recv = sizes.data();
-    const auto* p_disp = disp.data();
-    auto byte          = MPI_BYTE;
-    if(root.has_value()) {
-        MPI_Gatherv(p_in, n_in, byte, p_out, p_recv, p_disp, byte, *root,
-                    m_comm_);
-    } else {
-        MPI_Allgatherv(p_in, n_in, byte, p_out, p_recv, p_disp, byte, m_comm_);
-    }
+    gatherv(data, buffer, sizes, disp, root, alg);
 
     // Step 3: Return buffer and sizes
     binary_gatherv_return rv;
@@ -111,6 +283,177 @@ CommPPPIMPL::binary_gatherv_return CommPPPIMPL::gatherv(
     return rv;
 }
 
+void CommPPPIMPL::gatherv(const_binary_reference data,
+                          binary_reference out_buffer,
+                          const byte_count_container& sizes,
+                          const byte_offset_container& displacements,
+                          opt_root_t root, algorithm alg) const {
+    const auto timer = time_(root ? "gatherv" : "allgatherv", data.size(),
+                             out_buffer.size());
+    if(!root.has_value()) {
+        allgatherv_(data, sizes, displacements, out_buffer, alg);
+    } else {
+        gatherv_bytes(data.data(), data.size(), out_buffer.data(), sizes,
+                      displacements, root, m_comm_);
+    }
+}
+
+void CommPPPIMPL::broadcast(binary_reference data, size_type root) const {
+    const bool am_i_root = me() == root;
+    const auto timer     = time_("broadcast", am_i_root ? data.size() : 0,
+                                 am_i_root ? 0 : data.size());
+    bcast_bytes(data.data(), data.size(), root, m_comm_);
+}
+
+void CommPPPIMPL::scatter(const_binary_reference data,
+                          binary_reference out_buffer, size_type root) const {
+    auto n_out = out_buffer.size();
+    if(me() == root && data.size() < n_out * size())
+        throw std::runtime_error("The provided data is not large enough...");
+
+    const auto timer = time_("scatter", me() == root ? n_out * size() : 0,
+                             n_out);
+    scatter_bytes(data.data(), out_buffer.data(), n_out, root, m_comm_);
+}
+
+void CommPPPIMPL::scatterv(const_binary_reference data,
+                           const byte_count_container& sizes,
+                           const byte_offset_container& displacements,
+                           binary_reference out_buffer, size_type root) const {
+    const auto n_sent = me() == root ? total_(sizes) : 0;
+    const auto timer  = time_("scatterv", n_sent, out_buffer.size());
+    scatterv_bytes(data.data(), sizes, displacements, out_buffer.data(),
+                   out_buffer.size(), root, m_comm_);
+}
+
+void CommPPPIMPL::alltoall(const_binary_reference data,
+                           binary_reference out_buffer) const {
+    const auto n_bytes = data.size();
+    if(n_bytes % size() != 0 || out_buffer.size() != n_bytes)
+        throw std::runtime_error("Buffers can not be evenly exchanged");
+
+    const byte_count_type n = n_bytes / size();
+    const auto timer        = time_("alltoall", n_bytes, n_bytes);
+    alltoall_bytes(data.data(), out_buffer.data(), n, m_comm_);
+}
+
+void CommPPPIMPL::alltoallv(
+  const_binary_reference data, const byte_count_container& sizes,
+  const byte_offset_container& displacements, binary_reference out_buffer,
+  const byte_count_container& out_sizes,
+  const byte_offset_container& out_displacements) const {
+    const auto timer = time_("alltoallv", total_(sizes), total_(out_sizes));
+    alltoallv_bytes(data.data(), sizes, displacements, out_buffer.data(),
+                    out_sizes, out_displacements, m_comm_);
+}
+
+void CommPPPIMPL::reduce(const void* send, void* recv, int n_elems,
+                         MPI_Datatype type, MPI_Op op, opt_root_t root) const {
+    const auto n_bytes   = type_bytes_(n_elems, type);
+    const auto am_i_root = root.has_value() ? me() == *root : true;
+    const auto timer     = time_(root ? "reduce" : "allreduce", n_bytes,
+                                 am_i_root ? n_bytes : 0);
+    if(root.has_value()) {
+        MPI_Reduce(send, recv, n_elems, type, op, *root, m_comm_);
+    } else {
+        MPI_Allreduce(send, recv, n_elems, type, op, m_comm_);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// -- Point-to-Point
+// -----------------------------------------------------------------------------
+
+void CommPPPIMPL::send(const_binary_reference data, size_type dest,
+                       tag_type tag) const {
+    const auto timer = time_("send", data.size(), 0);
+    send_bytes(data.data(), data.size(), dest, tag, m_comm_);
+}
+
+CommPPPIMPL::request_type CommPPPIMPL::isend(const_binary_reference data,
+                                             size_type dest,
+                                             tag_type tag) const {
+    const auto timer = time_post_("isend", data.size(), 0);
+    return isend_bytes(data.data(), data.size(), dest, tag, m_comm_);
+}
+
+CommPPPIMPL::probe_return CommPPPIMPL::probe(size_type source, tag_type tag,
+                                             bool block) const {
+    message_type message;
+    MPI_Status status;
+    int flag = 1;
+    if(block) {
+        MPI_Mprobe(source, tag, m_comm_, &message, &status);
+    } else {
+        MPI_Improbe(source, tag, m_comm_, &flag, &message, &status);
+    }
+
+    probe_return rv;
+    if(!flag) return rv;
+    rv.emplace(message, byte_count(status));
+    return rv;
+}
+
+void CommPPPIMPL::recv(message_type& message,
+                       binary_reference out_buffer) const {
+    const auto timer = time_("recv", 0, out_buffer.size());
+    mrecv_bytes(out_buffer.data(), out_buffer.size(), message);
+}
+
+CommPPPIMPL::request_type CommPPPIMPL::irecv(
+  message_type& message, binary_reference out_buffer) const {
+    const auto timer = time_post_("irecv", 0, out_buffer.size());
+    return imrecv_bytes(out_buffer.data(), out_buffer.size(), message);
+}
+
+// -----------------------------------------------------------------------------
+// -- Nonblocking Collectives
+// -----------------------------------------------------------------------------
+
+CommPPPIMPL::request_type CommPPPIMPL::igather(const_binary_reference data,
+                                               binary_reference out_buffer,
+                                               opt_root_t root) const {
+    auto am_i_root = root.has_value() ? me() == *root : true;
+
+    auto p_in  = data.data();
+    auto n_in  = data.size();
+    auto p_out = out_buffer.data();
+    if(am_i_root && out_buffer.size() < n_in * size())
+        throw std::runtime_error("The provided buffer is not large enough...");
+
+    const auto timer = time_post_(root ? "igather" : "iallgather", n_in,
+                                  am_i_root ? n_in * size() : 0);
+    return igather_bytes(p_in, n_in, p_out, root, m_comm_);
+}
+
+CommPPPIMPL::request_type CommPPPIMPL::igatherv(
+  const_binary_reference data, binary_reference out_buffer,
+  const byte_count_container& sizes,
+  const byte_offset_container& displacements, opt_root_t root,
+  std::shared_ptr<const void>& keep_alive) const {
+    const auto timer = time_post_(root ? "igatherv" : "iallgatherv",
+                                  data.size(), out_buffer.size());
+    return igatherv_bytes(data.data(), data.size(), out_buffer.data(), sizes,
+                          displacements, root, m_comm_, keep_alive);
+}
+
+CommPPPIMPL::request_type CommPPPIMPL::ireduce(const void* send, void* recv,
+                                               int n_elems, MPI_Datatype type,
+                                               MPI_Op op,
+                                               opt_root_t root) const {
+    const auto n_bytes   = type_bytes_(n_elems, type);
+    const auto am_i_root = root.has_value() ? me() == *root : true;
+    const auto timer     = time_post_(root ? "ireduce" : "iallreduce", n_bytes,
+                                      am_i_root ? n_bytes : 0);
+    request_type request;
+    if(root.has_value()) {
+        MPI_Ireduce(send, recv, n_elems, type, op, *root, m_comm_, &request);
+    } else {
+        MPI_Iallreduce(send, recv, n_elems, type, op, m_comm_, &request);
+    }
+    return request;
+}
+
 // -----------------------------------------------------------------------------
 // -- Utility functions
 // -----------------------------------------------------------------------------
@@ -124,4 +467,186 @@ bool CommPPPIMPL::operator==(const CommPPPIMPL& rhs) const noexcept {
     return result == MPI_IDENT;
 }
 
+// -----------------------------------------------------------------------------
+// -- Private Methods
+// -----------------------------------------------------------------------------
+
+std::size_t CommPPPIMPL::total_(const byte_count_container& sizes) noexcept {
+    byte_count_type rv = 0;
+    for(const auto x : sizes) rv += x;
+    return rv;
+}
+
+std::size_t CommPPPIMPL::type_bytes_(int n_elems,
+                                     MPI_Datatype type) const noexcept {
+    // Only worth asking MPI if the answer is going to be recorded
+    if(!instrumenting()) return 0;
+    int type_size = 0;
+    MPI_Type_size(type, &type_size);
+    return std::size_t(n_elems) * type_size;
+}
+
+CommPPPIMPL::algorithm CommPPPIMPL::choose_(std::size_t n_bytes,
+                                             algorithm alg) const {
+    if(alg == algorithm::eager) return algorithm::flat;
+    if(alg != algorithm::automatic) return alg;
+
+    // Hierarchical only pays off with multiple nodes of multiple processes
+    if(n_bytes >= m_tuning_.hierarchical_threshold) {
+        const auto& topo = topology();
+        if(topo.n_nodes() > 1 && topo.n_nodes() < size())
+            return algorithm::hierarchical;
+    }
+
+    // With two processes a ring is the same as flat, but slower
+    if(n_bytes >= m_tuning_.ring_threshold && size() > 2)
+        return algorithm::ring;
+    return algorithm::flat;
+}
+
+void CommPPPIMPL::allgatherv_(const_binary_reference data,
+                              const byte_count_container& sizes,
+                              const byte_offset_container& displacements,
+                              binary_reference out_buffer,
+                              algorithm alg) const {
+    switch(choose_(out_buffer.size(), alg)) {
+        case algorithm::hierarchical:
+            hierarchical_allgatherv_(data, sizes, out_buffer);
+            break;
+        case algorithm::ring:
+            ring_allgatherv_(data, sizes, displacements, out_buffer);
+            break;
+        default:
+            gatherv_bytes(data.data(), data.size(), out_buffer.data(), sizes,
+                          displacements, std::nullopt, m_comm_);
+    }
+}
+
+CommPPPIMPL::binary_gatherv_return CommPPPIMPL::eager_allgatherv_(
+  const_binary_reference data, algorithm alg) const {
+    // Explicitly asking for eager without setting a threshold uses 1 KiB
+    const std::size_t limit =
+      m_tuning_.eager_threshold ? m_tuning_.eager_threshold : 1024;
+    const std::size_t slot_size = sizeof(std::uint64_t) + limit;
+
+    // Step 0: Fill in this process's slot, the block is left out if too big
+    const std::uint64_t n_in = data.size();
+    binary_type slot(slot_size);
+    std::memcpy(slot.data(), &n_in, sizeof(n_in));
+    if(n_in <= limit)
+        std::memcpy(slot.data() + sizeof(n_in), data.data(), n_in);
+
+    // Step 1: All gather the slots
+    binary_type slots(slot_size * size());
+    const_binary_reference slot_view(slot.data(), slot.size());
+    binary_reference slots_view(slots.data(), slots.size());
+    gather(slot_view, slots_view, std::nullopt, algorithm::flat);
+
+    // Step 2: Work out where each block goes and if they all fit
+    byte_count_container sizes(size());
+    byte_offset_container disp(size());
+    byte_offset_type total = 0;
+    bool all_fit           = true;
+    for(size_type r = 0; r < size(); ++r) {
+        std::uint64_t n_r;
+        std::memcpy(&n_r, slots.data() + r * slot_size, sizeof(n_r));
+        sizes[r] = n_r;
+        disp[r]  = total;
+        total += n_r;
+        all_fit = all_fit && n_r <= limit;
+    }
+
+    // Step 3: Unpack the slots, or fall back to moving the blocks separately
+    binary_type buffer(static_cast<std::size_t>(total));
+    if(all_fit) {
+        for(size_type r = 0; r < size(); ++r) {
+            const auto* p_block = slots.data() + r * slot_size + sizeof(n_in);
+            std::memcpy(buffer.data() + disp[r], p_block, sizes[r]);
+        }
+    } else {
+        binary_reference out(buffer.data(), buffer.size());
+        const auto next = alg == algorithm::eager ? algorithm::flat : alg;
+        gatherv(data, out, sizes, disp, std::nullopt, next);
+    }
+
+    binary_gatherv_return rv;
+    rv.emplace(std::move(buffer), std::move(sizes));
+    return rv;
+}
+
+void CommPPPIMPL::ring_allgatherv_(const_binary_reference data,
+                                   const byte_count_container& sizes,
+                                   const byte_offset_container& displacements,
+                                   binary_reference out_buffer) const {
+    const size_type n   = size();
+    const auto next     = (me() + 1) % n;
+    const auto previous = (me() + n - 1) % n;
+    const auto tag      = m_tags_->tag("parallelzone::ring_allgatherv");
+
+    auto* p_out = out_buffer.data();
+    std::memcpy(p_out + displacements[me()], data.data(), data.size());
+    for(size_type step = 0; step + 1 < n; ++step) {
+        const auto send = (me() + n - step) % n;
+        const auto recv = (me() + n - step - 1) % n;
+        sendrecv_bytes(p_out + displacements[send], sizes[send], next,
+                       p_out + displacements[recv], sizes[recv], previous, tag,
+                       m_comm_);
+    }
+}
+
+void CommPPPIMPL::hierarchical_allgatherv_(const_binary_reference data,
+                                           const byte_count_container& sizes,
+                                           binary_reference out_buffer) const {
+    const auto& topo = topology();
+
+    // Step 0: Work out where each rank's bytes go if the bytes are grouped by
+    //         node (the "staged" layout) and where each node's block starts
+    byte_offset_container staged_disp(size(), 0);
+    byte_count_container node_sizes(topo.n_nodes(), 0);
+    byte_offset_container node_disp(topo.n_nodes(), 0);
+    byte_offset_type total = 0;
+    for(const auto r : topo.order()) {
+        staged_disp[r] = total;
+        total += sizes[r];
+        node_sizes[topo.node_of(r)] += sizes[r];
+    }
+    for(size_type n = 1; n < topo.n_nodes(); ++n)
+        node_disp[n] = node_disp[n - 1] + node_sizes[n - 1];
+
+    // If each node is a block of ranks the staged layout is the final layout
+    binary_type staged;
+    auto* p_staged = out_buffer.data();
+    if(!topo.in_order()) {
+        binary_type(std::size_t(total)).swap(staged);
+        p_staged = staged.data();
+    }
+
+    // Step 1: Gather each node's bytes to its leader (through shared memory)
+    byte_count_container member_sizes;
+    byte_offset_container member_disp;
+    for(const auto r : topo.members(topo.node_of(me()))) {
+        member_sizes.push_back(sizes[r]);
+        member_disp.push_back(staged_disp[r]);
+    }
+    gatherv_bytes(data.data(), data.size(), p_staged, member_sizes,
+                  member_disp, 0, topo.node_comm());
+
+    // Step 2: The leaders exchange their nodes' blocks (over the network)
+    if(topo.is_leader()) {
+        gatherv_bytes(MPI_IN_PLACE, 0, p_staged, node_sizes, node_disp,
+                      std::nullopt, topo.leader_comm());
+    }
+
+    // Step 3: Each leader shares the result with its node
+    bcast_bytes(p_staged, total, 0, topo.node_comm());
+
+    // Step 4: Put the bytes in rank order
+    if(topo.in_order()) return;
+    auto* p_out = out_buffer.data();
+    for(size_type r = 0; r < size(); ++r) {
+        std::memcpy(p_out, p_staged + staged_disp[r], sizes[r]);
+        p_out += sizes[r];
+    }
+}
+
 } // namespace parallelzone::mpi_helpers::detail_
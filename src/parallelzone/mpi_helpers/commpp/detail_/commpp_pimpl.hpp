@@ -15,6 +15,11 @@
  */
 
 #pragma once
+#include "comm_profiler.hpp"
+#include "large_count.hpp"
+#include "node_topology.hpp"
+#include "rma_window_pimpl.hpp"
+#include "tag_registry.hpp"
 #include <parallelzone/mpi_helpers/commpp/commpp.hpp>
 
 namespace parallelzone::mpi_helpers::detail_ {
@@ -23,6 +28,9 @@ namespace parallelzone::mpi_helpers::detail_ {
  *
  *  This class primarily exists to facilitate unit testing the implementations
  *  of the MPI ops without exposing them through the public API.
+ *
+ *  The MPI ops move bytes with the wrappers in large_count.hpp, so none of
+ *  them are limited to 2 GiB (on the calling process or in total).
  */
 class CommPPPIMPL {
 public:
@@ -47,6 +55,18 @@ public:
     /// Ultiamtely a typedef of CommPP::const_binary_reference
     using const_binary_reference = parent_type::const_binary_reference;
 
+    /// Ultimately a typedef of CommPP::byte_count_type
+    using byte_count_type = parent_type::byte_count_type;
+
+    /// Ultimately a typedef of CommPP::byte_offset_type
+    using byte_offset_type = parent_type::byte_offset_type;
+
+    /// Ultimately a typedef of CommPP::byte_count_container
+    using byte_count_container = parent_type::byte_count_container;
+
+    /// Ultimately a typedef of CommPP::byte_offset_container
+    using byte_offset_container = parent_type::byte_offset_container;
+
     /// Ultimately a typedef of CommPP::binary_gather_return
     using binary_gather_return = parent_type::binary_gather_return;
 
@@ -56,9 +76,63 @@ public:
     /// Ultimately a typedef of CommPP::binary_gatherv_return
     using binary_gatherv_return = parent_type::binary_gatherv_return;
 
+    /// Ultimately a typedef of CommPP::request_type
+    using request_type = parent_type::request_type;
+
+    /// Ultimately a typedef of CommPP::tag_type
+    using tag_type = parent_type::tag_type;
+
+    /// Ultimately a typedef of CommPP::message_type
+    using message_type = parent_type::message_type;
+
+    /// Ultimately a typedef of CommPP::probe_return
+    using probe_return = parent_type::probe_return;
+
+    /// Type of the object mapping string tags to integer tags
+    using tag_registry_type = TagRegistry;
+
+    /// Type of a pointer to the (shared) tag registry
+    using tag_registry_pointer = std::shared_ptr<tag_registry_type>;
+
     /// Type of an optional root
     using opt_root_t = std::optional<size_type>;
 
+    /// Ultimately a typedef of CommPP::algorithm
+    using algorithm = parent_type::algorithm;
+
+    /// Ultimately a typedef of CommPP::tuning_type
+    using tuning_type = parent_type::tuning_type;
+
+    /// Type of the object describing how processes are spread over nodes
+    using topology_type = NodeTopology;
+
+    /// Type of a pointer to the (lazily created, shared) node layout
+    using topology_pointer = std::shared_ptr<const topology_type>;
+
+    /// Type of the object managing the lifetime of an owned communicator
+    using comm_owner_pointer = std::shared_ptr<const mpi_comm_type>;
+
+    /// Ultimately a typedef of CommPP::codec_pointer
+    using codec_pointer = parent_type::codec_pointer;
+
+    /// Ultimately a typedef of CommPP::compression_stats_type
+    using compression_stats_type = parent_type::compression_stats_type;
+
+    /// Ultimately a typedef of CommPP::window_type
+    using window_type = parent_type::window_type;
+
+    /// Ultimately a typedef of CommPP::comm_stats_type
+    using comm_stats_type = parent_type::comm_stats_type;
+
+    /// Type of the object recording the statistics of each operation
+    using profiler_type = CommProfiler;
+
+    /// Type of a pointer to the (shared) profiler
+    using profiler_pointer = std::shared_ptr<profiler_type>;
+
+    /// Type of a duration measured by the profiler
+    using duration = profiler_type::duration;
+
     /** @brief Initializes *this from the MPI communicator @p comm
      *
      *  This ctor inspects @p comm and determines:
@@ -82,6 +156,18 @@ public:
      */
     pimpl_pointer clone() const { return std::make_unique<CommPPPIMPL>(*this); }
 
+    /** @brief Makes a PIMPL around a duplicate of the wrapped communicator.
+     *
+     *  This method calls MPI_Comm_dup on comm() and returns a PIMPL which
+     *  owns the result. Copies of the resulting PIMPL (e.g., via clone())
+     *  share ownership of the duplicate, which is freed with MPI_Comm_free
+     *  when the last copy is destroyed. If MPI has been finalized by then, the
+     *  communicator is simply forgotten.
+     *
+     *  @return A PIMPL owning a duplicate of comm().
+     */
+    pimpl_pointer duplicate() const;
+
     /** @brief Returns the MPI communicator behind *this
      *
      *  When *this was constructed it was given the handle to an MPI
@@ -128,6 +214,146 @@ public:
      */
     size_type me() const noexcept { return m_my_rank_; }
 
+    // -------------------------------------------------------------------------
+    // -- Collective Algorithms
+    // -------------------------------------------------------------------------
+
+    /// Sets the total size at which automatic all gathers go hierarchical
+    void set_hierarchical_threshold(std::size_t n_bytes) noexcept {
+        m_tuning_.hierarchical_threshold = n_bytes;
+    }
+
+    /// The total size at which automatic all gathers go hierarchical
+    std::size_t hierarchical_threshold() const noexcept {
+        return m_tuning_.hierarchical_threshold;
+    }
+
+    /// Sets the thresholds automatic collectives use to pick an algorithm
+    void set_tuning(const tuning_type& tuning) noexcept { m_tuning_ = tuning; }
+
+    /// The thresholds automatic collectives use to pick an algorithm
+    const tuning_type& tuning() const noexcept { return m_tuning_; }
+
+    /** @brief Loads the tuning from @p path, or measures it with a
+     *         CollectiveTuner (and saves it to @p path).
+     *
+     *  This is a collective operation. Process 0 reads the file and
+     *  broadcasts the tuning if it matches the size() and number of nodes of
+     *  comm(). An empty @p path means always measure and never save.
+     *
+     *  @param[in] path The tuning file.
+     *
+     *  @return The tuning which was set.
+     *
+     *  @throw std::runtime_error if process 0 could not write @p path (on
+     *                            every process). The tuning is still set.
+     */
+    tuning_type tune(const std::string& path);
+
+    /** @brief Groups processes into nodes by @p color instead of by
+     *         shared-memory domain.
+     *
+     *  This only records @p color, the node layout is (re)computed the next
+     *  time topology() is called.
+     *
+     *  @param[in] color This process's node.
+     */
+    void set_node_color(size_type color);
+
+    /** @brief Returns how the processes of comm() are spread over nodes.
+     *
+     *  The layout is computed the first time this method is called, and
+     *  shared by copies of *this made afterwards. Since computing it is a
+     *  collective operation, the first call must be made on every process.
+     *
+     *  @return The node layout of comm().
+     */
+    const topology_type& topology() const;
+
+    // -------------------------------------------------------------------------
+    // -- Compression
+    // -------------------------------------------------------------------------
+
+    /** @brief Compresses blocks of at least @p threshold bytes with @p codec.
+     *
+     *  Also resets the statistics. A null @p codec turns compression off.
+     */
+    void set_compression(codec_pointer codec, std::size_t threshold) noexcept;
+
+    /// Is compression turned on (a codec is set and the tuning allows it)?
+    bool compressing() const noexcept { return m_codec_ && m_tuning_.compress; }
+
+    /// The codec set by set_compression (null if none)
+    const codec_pointer& codec() const noexcept { return m_codec_; }
+
+    /** @brief Compresses @p data into a self-describing block.
+     *
+     *  The block starts with a 9 byte header: a flag saying whether the rest
+     *  of the block is compressed, followed by the (64-bit) size of @p data.
+     *  If @p data is smaller than the threshold, or the codec does not make
+     *  it smaller, the rest of the block is a copy of @p data.
+     *
+     *  @param[in] data The bytes to compress.
+     *
+     *  @return The header followed by the (possibly) compressed bytes.
+     *
+     *  @throw std::runtime_error if compression is off. Strong throw
+     *                            guarantee.
+     */
+    binary_type compress(const_binary_reference data) const;
+
+    /** @brief Reverses compress.
+     *
+     *  @param[in] data A block made by compress (on any process).
+     *
+     *  @return The bytes which were given to compress.
+     *
+     *  @throw std::runtime_error if compression is off or @p data is
+     *                            malformed. Strong throw guarantee.
+     */
+    binary_type decompress(const_binary_reference data) const;
+
+    /// The statistics collected since compression was set or reset
+    const compression_stats_type& compression_stats() const noexcept {
+        return m_compression_stats_;
+    }
+
+    /// Zeros the statistics
+    void reset_compression_stats() noexcept { m_compression_stats_ = {}; }
+
+    // -------------------------------------------------------------------------
+    // -- Instrumentation
+    // -------------------------------------------------------------------------
+
+    /** @brief Turns recording the statistics of each operation on or off.
+     *
+     *  The statistics are kept by a profiler shared by all copies of *this,
+     *  so turning recording on (or off) affects every copy.
+     */
+    void set_instrumentation(bool on) noexcept { m_profiler_->enable(on); }
+
+    /// Is recording turned on?
+    bool instrumenting() const noexcept { return m_profiler_->enabled(); }
+
+    /// The statistics recorded (on this process) so far
+    comm_stats_type comm_stats() const { return m_profiler_->stats(); }
+
+    /// Zeros the statistics
+    void reset_comm_stats() { m_profiler_->reset(); }
+
+    /** @brief Adds @p t to the time operation @p op spent (de)serializing.
+     *
+     *  The MPI ops time themselves, but the objects are (de)serialized by
+     *  CommPP's templates, which report the time they took with this method.
+     *  Nothing is recorded if instrumenting() is false.
+     *
+     *  @param[in] op The name of the operation, e.g., "allgather".
+     *  @param[in] t  The time spent (de)serializing.
+     */
+    void record_serialization(const char* op, duration t) const noexcept {
+        if(instrumenting()) m_profiler_->record_serialization(op, t);
+    }
+
     // -------------------------------------------------------------------------
     // -- MPI Operations
     // -------------------------------------------------------------------------
@@ -165,6 +391,8 @@ public:
      *                  data. If @p root is set this operation will wrap a call
      *                  to MPI_Gather, otherwise (the default scenario), the
      *                  call will be to MPI_Allgather.
+     *  @param[in] alg  The algorithm to use if @p root is not set. Rooted
+     *                  gathers are always flat.
      *
      *  @return A std::optional. If @p root is not set, then the std::optional
      *          will contain the gathered bytes on each rank of this
@@ -174,7 +402,8 @@ public:
      *
      */
     binary_gather_return gather(const_binary_reference data,
-                                opt_root_t root = std::nullopt) const;
+                                opt_root_t root = std::nullopt,
+                                algorithm alg   = algorithm::automatic) const;
 
     /** @brief Binary-based gather call that can avoid copies.
      *
@@ -195,9 +424,26 @@ public:
      *                  is optional. If it is set then only @p root will
      *                  receive the result, if it is not set then every
      *                  process gets a copy of the result.
+     *  @param[in] alg  The algorithm to use if @p root is not set. Rooted
+     *                  gathers are always flat.
      */
     void gather(const_binary_reference data, binary_reference out_buffer,
-                opt_root_t root = std::nullopt) const;
+                opt_root_t root = std::nullopt,
+                algorithm alg   = algorithm::automatic) const;
+
+    /** @brief All gather where each rank's bytes are already in the result.
+     *
+     *  @p data is split into size() equally sized blocks. On entry, block
+     *  me() holds this rank's bytes; on exit, block `r` holds rank `r`'s
+     *  bytes. This wraps MPI_Allgather with MPI_IN_PLACE and is always flat.
+     *
+     *  @param[in,out] data The result, with this rank's block filled in.
+     *                      Must be the same length on every process.
+     *
+     *  @throw std::runtime_error if the length of @p data is not a multiple
+     *                            of size(). Strong throw guarantee.
+     */
+    void gather_in_place(binary_reference data) const;
 
     /** @brief Analog of gather(data, root) where the length of data can vary.
      *
@@ -214,6 +460,8 @@ public:
      *                  result. If @p root is set only the process with rank
      *                  @p root will get the result, otherwise each process
      *                  gets the result.
+     *  @param[in] alg  The algorithm to use if @p root is not set. Rooted
+     *                  gathers are always flat.
      *
      *  @return A std::optional around a pair. The first element of the pair
      *          is the concatenated bytes. The second element is an array such
@@ -222,7 +470,310 @@ public:
      *          only on the process of rank @p root if @p root was set.
      */
     binary_gatherv_return gatherv(const_binary_reference data,
-                                  opt_root_t root = std::nullopt) const;
+                                  opt_root_t root = std::nullopt,
+                                  algorithm alg   = algorithm::automatic) const;
+
+    /** @brief Gatherv into a pre-allocated buffer.
+     *
+     *  Unlike gatherv(data, root, alg), this method does not work out how
+     *  many bytes each process sends, the caller must have already done that
+     *  (e.g., with an all gather).
+     *
+     *  If @p root is set this method wraps a call to MPI_Gatherv, otherwise
+     *  it wraps a call to MPI_Allgatherv (or does a hierarchical all gather,
+     *  which assumes the blocks are back-to-back in rank order).
+     *
+     *  @param[in] data The local bytes to send.
+     *  @param[in] out_buffer Where the bytes go. Only needs to be allocated on
+     *                        processes receiving the result.
+     *  @param[in] sizes How many bytes each process sends. Must be set on
+     *                   every process, even if @p root is set, so they all
+     *                   move the bytes the same way.
+     *  @param[in] displacements The offset in @p out_buffer where each process'
+     *                           bytes go. Must be set on every process.
+     *  @param[in] root The zero-based rank of the root process, if any.
+     *  @param[in] alg  The algorithm to use if @p root is not set.
+     */
+    void gatherv(const_binary_reference data, binary_reference out_buffer,
+                 const byte_count_container& sizes,
+                 const byte_offset_container& displacements,
+                 opt_root_t root = std::nullopt,
+                 algorithm alg   = algorithm::automatic) const;
+
+    /** @brief Binary-based broadcast.
+     *
+     *  On process @p root, @p data holds the bytes to send. On every other
+     *  process @p data must be a pre-allocated buffer of the same size, which
+     *  will be overwritten with the bytes from process @p root.
+     *
+     *  This method wraps a call to MPI_Bcast.
+     *
+     *  @param[in,out] data The bytes to send (on @p root) or the buffer to
+     *                      receive them into (on all other processes).
+     *  @param[in] root The zero-based rank of the process sending the bytes.
+     */
+    void broadcast(binary_reference data, size_type root) const;
+
+    /** @brief Binary-based scatter into a pre-allocated buffer.
+     *
+     *  This is the inverse of gather(data, out_buffer, root). On process
+     *  @p root, @p data holds `this->size()` blocks of `b` bytes each, where
+     *  `b` is `out_buffer.size()`. Block `r` is sent to the process with rank
+     *  `r`, which receives it into @p out_buffer. @p out_buffer must be the
+     *  same size on every process. @p data is ignored on all other processes.
+     *
+     *  This method wraps a call to MPI_Scatter.
+     *
+     *  @param[in] data The bytes to scatter. Only used on process @p root.
+     *  @param[in] out_buffer Where this process's block of bytes goes.
+     *  @param[in] root The zero-based rank of the process sending the bytes.
+     *
+     *  @throw std::runtime_error if, on process @p root, @p data is not large
+     *                            enough. Strong throw guarantee.
+     */
+    void scatter(const_binary_reference data, binary_reference out_buffer,
+                 size_type root) const;
+
+    /** @brief Analog of scatter where the number of bytes each process gets
+     *         can vary.
+     *
+     *  This method wraps a call to MPI_Scatterv. The caller is responsible
+     *  for making sure each process' @p out_buffer is large enough (e.g., by
+     *  first broadcasting @p sizes).
+     *
+     *  @param[in] data The bytes to scatter. Only used on process @p root.
+     *  @param[in] sizes How many bytes each process gets. Must be set on
+     *                   every process, so they all move the bytes the same
+     *                   way.
+     *  @param[in] displacements The offset in @p data where each process'
+     *                           bytes start. Must be set on every process.
+     *  @param[in] out_buffer Where this process's bytes go.
+     *  @param[in] root The zero-based rank of the process sending the bytes.
+     */
+    void scatterv(const_binary_reference data,
+                  const byte_count_container& sizes,
+                  const byte_offset_container& displacements,
+                  binary_reference out_buffer, size_type root) const;
+
+    /** @brief Binary-based all-to-all exchange into a pre-allocated buffer.
+     *
+     *  Both @p data and @p out_buffer are made of `this->size()` blocks of
+     *  `b` bytes each, where `b` is `data.size() / this->size()`. Block `r`
+     *  of @p data is sent to the process with rank `r`, and block `r` of
+     *  @p out_buffer is received from the process with rank `r`. @p data must
+     *  be the same size on every process.
+     *
+     *  This method wraps a call to MPI_Alltoall.
+     *
+     *  @param[in] data The bytes to send.
+     *  @param[in] out_buffer Where the received bytes go.
+     *
+     *  @throw std::runtime_error if @p data can not be split evenly, or if
+     *                            @p out_buffer is not the same size as
+     *                            @p data. Strong throw guarantee.
+     */
+    void alltoall(const_binary_reference data,
+                  binary_reference out_buffer) const;
+
+    /** @brief Analog of alltoall where the number of bytes exchanged between
+     *         each pair of processes can vary.
+     *
+     *  This method wraps a call to MPI_Alltoallv. The caller is responsible
+     *  for making sure the processes agree on the sizes (e.g., by first
+     *  calling alltoall on @p sizes).
+     *
+     *  @param[in] data The bytes to send.
+     *  @param[in] sizes How many bytes are sent to each process.
+     *  @param[in] displacements The offset in @p data where the bytes for
+     *                           each process start.
+     *  @param[in] out_buffer Where the received bytes go.
+     *  @param[in] out_sizes How many bytes are received from each process.
+     *  @param[in] out_displacements The offset in @p out_buffer where the
+     *                               bytes from each process go.
+     */
+    void alltoallv(const_binary_reference data,
+                   const byte_count_container& sizes,
+                   const byte_offset_container& displacements,
+                   binary_reference out_buffer,
+                   const byte_count_container& out_sizes,
+                   const byte_offset_container& out_displacements) const;
+
+    /** @brief Element-wise reduction of @p n_elems elements.
+     *
+     *  If @p root is set this method wraps a call to MPI_Reduce, otherwise it
+     *  wraps a call to MPI_Allreduce.
+     *
+     *  @param[in] send    The elements to reduce, or MPI_IN_PLACE.
+     *  @param[in] recv    Where the result goes. Only used on processes
+     *                     receiving the result.
+     *  @param[in] n_elems The number of elements.
+     *  @param[in] type    The MPI type of the elements.
+     *  @param[in] op      The MPI operation combining two elements.
+     *  @param[in] root    The zero-based rank of the root process, if any.
+     */
+    void reduce(const void* send, void* recv, int n_elems, MPI_Datatype type,
+                MPI_Op op, opt_root_t root) const;
+
+    // -------------------------------------------------------------------------
+    // -- Point-to-Point
+    // -------------------------------------------------------------------------
+
+    /** @brief Sends bytes to process @p dest.
+     *
+     *  This method wraps MPI_Send.
+     *
+     *  @param[in] data The bytes to send.
+     *  @param[in] dest The rank of the process to send the bytes to.
+     *  @param[in] tag  The tag of the message.
+     */
+    void send(const_binary_reference data, size_type dest, tag_type tag) const;
+
+    /** @brief Starts sending bytes to process @p dest.
+     *
+     *  This method wraps MPI_Isend. @p data may not be touched until the
+     *  returned request completes.
+     *
+     *  @param[in] data The bytes to send.
+     *  @param[in] dest The rank of the process to send the bytes to.
+     *  @param[in] tag  The tag of the message.
+     *
+     *  @return The MPI request tracking the send.
+     */
+    request_type isend(const_binary_reference data, size_type dest,
+                       tag_type tag) const;
+
+    /** @brief Looks for (and claims) a message from @p source with @p tag.
+     *
+     *  This method wraps MPI_Mprobe (if @p block is true) or MPI_Improbe (if
+     *  @p block is false). Unlike MPI_Probe, the matched message is removed
+     *  from the queue, so it can only be received with recv(message, ...),
+     *  which makes probing and then receiving thread-safe.
+     *
+     *  @param[in] source The rank of the process which sent the message.
+     *  @param[in] tag    The tag of the message.
+     *  @param[in] block  Should this call wait for a matching message?
+     *
+     *  @return If a message was matched, the handle to the message and its
+     *          size in bytes. If @p block is false and no message was matched
+     *          the result is empty.
+     */
+    probe_return probe(size_type source, tag_type tag, bool block) const;
+
+    /** @brief Receives a message claimed by probe.
+     *
+     *  This method wraps MPI_Mrecv.
+     *
+     *  @param[in,out] message The handle returned by probe.
+     *  @param[in] out_buffer Where to put the bytes. Must be at least as large
+     *                        as the size returned by probe.
+     */
+    void recv(message_type& message, binary_reference out_buffer) const;
+
+    /** @brief Starts receiving a message claimed by probe.
+     *
+     *  This method wraps MPI_Imrecv. @p out_buffer may not be touched until
+     *  the returned request completes.
+     *
+     *  @param[in,out] message The handle returned by probe.
+     *  @param[in] out_buffer Where to put the bytes. Must be at least as large
+     *                        as the size returned by probe.
+     *
+     *  @return The MPI request tracking the receive.
+     */
+    request_type irecv(message_type& message,
+                       binary_reference out_buffer) const;
+
+    /** @brief Maps the string tag @p name to an integer tag.
+     *
+     *  The mapping is stored in a registry shared by all copies of *this (see
+     *  TagRegistry for details).
+     *
+     *  @param[in] name The string tag.
+     *
+     *  @return The integer tag for @p name.
+     *
+     *  @throw std::runtime_error if @p name collides with another tag.
+     */
+    tag_type tag(const std::string& name) const { return m_tags_->tag(name); }
+
+    // -------------------------------------------------------------------------
+    // -- One-Sided Communication
+    // -------------------------------------------------------------------------
+
+    /// Collectively allocates a window with @p n_bytes on this process
+    window_type allocate_window(std::size_t n_bytes) const {
+        return window_type(RMAWindowPIMPL::allocate(n_bytes, m_comm_));
+    }
+
+    /// Collectively exposes @p region through a window
+    window_type expose_window(binary_reference region) const {
+        return window_type(RMAWindowPIMPL::expose(region, m_comm_));
+    }
+
+    /** @brief Nonblocking analog of gather(data, out_buffer, root).
+     *
+     *  This method starts the gather and returns immediately. Neither @p data
+     *  nor @p out_buffer may be touched until the returned request completes.
+     *
+     *  If @p root is set this method wraps a call to MPI_Igather, otherwise it
+     *  wraps a call to MPI_Iallgather.
+     *
+     *  @param[in] data The local bytes to send. All processes must send the
+     *                  same number of bytes.
+     *  @param[in] out_buffer A pre-allocated buffer to put the bytes into. See
+     *                        gather(data, out_buffer, root) for details.
+     *  @param[in] root The zero-based rank of the root process, if any.
+     *
+     *  @return The MPI request tracking the operation.
+     *
+     *  @throw std::runtime_error if @p out_buffer is too small. Strong throw
+     *                            guarantee.
+     */
+    request_type igather(const_binary_reference data,
+                         binary_reference out_buffer,
+                         opt_root_t root = std::nullopt) const;
+
+    /** @brief Nonblocking gatherv into a pre-allocated buffer.
+     *
+     *  Unlike gatherv, this method does not work out how many bytes each
+     *  process sends, the caller must have already done that (e.g., with an
+     *  all gather). This method starts the gatherv and returns immediately.
+     *  None of the arguments may be touched until the returned request
+     *  completes.
+     *
+     *  If @p root is set this method wraps a call to MPI_Igatherv, otherwise it
+     *  wraps a call to MPI_Iallgatherv.
+     *
+     *  @param[in] data The local bytes to send.
+     *  @param[in] out_buffer Where the bytes go. Only needs to be allocated on
+     *                        processes receiving the result.
+     *  @param[in] sizes How many bytes each process sends. Must be set on
+     *                   every process, even if @p root is set.
+     *  @param[in] displacements The offset in @p out_buffer where each process'
+     *                           bytes go. Must be set on every process.
+     *  @param[in] root The zero-based rank of the root process, if any.
+     *  @param[out] keep_alive Set to anything else the request uses, must
+     *                         also outlive the request.
+     *
+     *  @return The MPI request tracking the operation.
+     */
+    request_type igatherv(const_binary_reference data,
+                          binary_reference out_buffer,
+                          const byte_count_container& sizes,
+                          const byte_offset_container& displacements,
+                          opt_root_t root,
+                          std::shared_ptr<const void>& keep_alive) const;
+
+    /** @brief Nonblocking analog of reduce.
+     *
+     *  If @p root is set this method wraps a call to MPI_Ireduce, otherwise it
+     *  wraps a call to MPI_Iallreduce. None of the arguments may be touched
+     *  until the returned request completes.
+     *
+     *  @return The MPI request tracking the operation.
+     */
+    request_type ireduce(const void* send, void* recv, int n_elems,
+                         MPI_Datatype type, MPI_Op op, opt_root_t root) const;
 
     // -------------------------------------------------------------------------
     // -- Utility functions
@@ -246,14 +797,104 @@ public:
     bool operator==(const CommPPPIMPL& rhs) const noexcept;
 
 private:
+    /// Starts timing operation @p op, which moves the given bytes
+    profiler_type::OpTimer time_(const char* op, std::size_t sent,
+                                 std::size_t received) const {
+        return profiler_type::OpTimer(*m_profiler_, op, sent, received);
+    }
+
+    /// Starts timing the posting of nonblocking operation @p op
+    profiler_type::OpTimer time_post_(const char* op, std::size_t sent,
+                                      std::size_t received) const {
+        return profiler_type::OpTimer(*m_profiler_, op, sent, received, false);
+    }
+
+    /// The total number of bytes in @p sizes
+    static std::size_t total_(const byte_count_container& sizes) noexcept;
+
+    /// The size of @p n_elems elements of @p type (0 if not instrumenting)
+    std::size_t type_bytes_(int n_elems, MPI_Datatype type) const noexcept;
+
+    /** @brief The algorithm an all gather of @p n_bytes (in total) uses.
+     *
+     *  Resolves algorithm::automatic per m_tuning_, and algorithm::eager to
+     *  algorithm::flat (sizes are already known when this is called).
+     */
+    algorithm choose_(std::size_t n_bytes, algorithm alg) const;
+
+    /** @brief All gatherv which sends the blocks along with their sizes.
+     *
+     *  Each process sends a fixed-size slot holding the size of its block
+     *  and, if it fits, the block itself. If every block fit the slots are
+     *  unpacked into the result, otherwise a second all gatherv (using
+     *  @p alg) moves the blocks.
+     */
+    binary_gatherv_return eager_allgatherv_(const_binary_reference data,
+                                            algorithm alg) const;
+
+    /** @brief Ring all gatherv.
+     *
+     *  Rank `r` contributes @p sizes[r] bytes, which land at
+     *  @p displacements[r] in @p out_buffer. In step `s` each process sends
+     *  block `me() - s` to the next process and receives block
+     *  `me() - s - 1` from the previous one.
+     */
+    void ring_allgatherv_(const_binary_reference data,
+                          const byte_count_container& sizes,
+                          const byte_offset_container& displacements,
+                          binary_reference out_buffer) const;
+
+    /// Dispatches an all gatherv (sizes known) to the algorithm @p alg
+    void allgatherv_(const_binary_reference data,
+                     const byte_count_container& sizes,
+                     const byte_offset_container& displacements,
+                     binary_reference out_buffer, algorithm alg) const;
+
+    /** @brief Hierarchical all gatherv.
+     *
+     *  Rank `r` contributes @p sizes[r] bytes. The bytes are gathered to each
+     *  node's leader, exchanged among the leaders, and broadcast to the rest
+     *  of the node. @p out_buffer gets the bytes in rank order.
+     */
+    void hierarchical_allgatherv_(const_binary_reference data,
+                                  const byte_count_container& sizes,
+                                  binary_reference out_buffer) const;
+
     /// The MPI communicator *this wraps
     mpi_comm_type m_comm_;
 
+    /// If *this owns m_comm_, this frees it when the last copy goes away
+    comm_owner_pointer m_owner_;
+
     /// The MPI rank (on m_comm_) for the current process
     size_type m_my_rank_;
 
     /// The number of MPI ranks associated with m_comm_
     size_type m_size_;
+
+    /// Maps string tags to integer tags, shared by copies of *this
+    tag_registry_pointer m_tags_;
+
+    /// The thresholds used to pick the algorithm of automatic collectives
+    tuning_type m_tuning_;
+
+    /// If set, overrides the shared-memory split into nodes
+    std::optional<size_type> m_node_color_;
+
+    /// The node layout, created the first time it's needed
+    mutable topology_pointer m_topology_;
+
+    /// The codec used to compress blocks, null if compression is off
+    codec_pointer m_codec_;
+
+    /// Blocks smaller than this many bytes are not compressed
+    std::size_t m_compression_threshold_ = 0;
+
+    /// Updated by compress and decompress, hence mutable
+    mutable compression_stats_type m_compression_stats_;
+
+    /// Records the statistics of each operation, shared by copies of *this
+    profiler_pointer m_profiler_;
 };
 
 } // namespace parallelzone::mpi_helpers::detail_
@@ -0,0 +1,509 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "large_count.hpp"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstring>
+
+namespace parallelzone::mpi_helpers::detail_ {
+namespace {
+
+/// The largest count passed to routines taking an int
+std::atomic<count_type> g_max_int_count{INT_MAX};
+
+/// Pointer arithmetic on a type-erased buffer
+std::byte* offset_(void* p, offset_type n) {
+    return static_cast<std::byte*>(p) + n;
+}
+
+/// Read-only pointer arithmetic on a type-erased buffer
+const std::byte* offset_(const void* p, offset_type n) {
+    return static_cast<const std::byte*>(p) + n;
+}
+
+#if MPI_VERSION < 4
+/// Do all of the values in @p xs fit in an int?
+template<typename T>
+bool fits_(const std::vector<T>& xs) {
+    const auto max = max_int_count();
+    return std::all_of(xs.begin(), xs.end(), [=](T x) { return x <= max; });
+}
+
+/// Converts @p xs to ints, only call if fits_(xs)
+template<typename T>
+std::vector<int> to_int_(const std::vector<T>& xs) {
+    return std::vector<int>(xs.begin(), xs.end());
+}
+
+/// Do all of @p sizes and @p disp fit in an int?
+bool fits_(const count_vector& sizes, const offset_vector& disp) {
+    return fits_(sizes) && fits_(disp);
+}
+
+/// Where the last process's bytes end
+count_type extent_(const count_vector& sizes, const offset_vector& disp) {
+    count_type rv = 0;
+    for(std::size_t i = 0; i < sizes.size(); ++i)
+        rv = std::max<count_type>(rv, disp[i] + sizes[i]);
+    return rv;
+}
+
+/// Owns a duplicate communicator so fallback messages are kept separate
+class DupComm {
+public:
+    explicit DupComm(MPI_Comm comm) { MPI_Comm_dup(comm, &m_comm_); }
+    DupComm(const DupComm&)            = delete;
+    DupComm& operator=(const DupComm&) = delete;
+    ~DupComm() noexcept { MPI_Comm_free(&m_comm_); }
+    operator MPI_Comm() const noexcept { return m_comm_; }
+
+private:
+    MPI_Comm m_comm_ = MPI_COMM_NULL;
+};
+
+/** @brief Describes pieces of a buffer for MPI_Alltoallw.
+ *
+ *  MPI_Alltoallw takes a datatype per process, so each process can describe
+ *  the pieces which do not fit in an int by itself: such a piece is one
+ *  element of a datatype starting at the piece (its displacement is 0).
+ *  Everything else is sent as MPI_BYTE, as MPI_Alltoallv would.
+ */
+class Pieces {
+public:
+    Pieces(const count_vector& sizes, const offset_vector& disp) {
+        const auto max = max_int_count();
+        for(std::size_t i = 0; i < sizes.size(); ++i) {
+            m_types_.push_back(MPI_BYTE);
+            if(sizes[i] == 0 || (sizes[i] <= max && disp[i] <= max)) {
+                m_counts_.push_back(sizes[i]);
+                m_disp_.push_back(sizes[i] == 0 ? 0 : disp[i]);
+                continue;
+            }
+            ByteType t(sizes[i]);
+            int length     = t.count();
+            MPI_Aint start = disp[i];
+            MPI_Type_create_hindexed(1, &length, &start, t.type(),
+                                     &m_types_.back());
+            MPI_Type_commit(&m_types_.back());
+            m_counts_.push_back(1);
+            m_disp_.push_back(0);
+        }
+    }
+    Pieces(const Pieces&)            = delete;
+    Pieces& operator=(const Pieces&) = delete;
+    ~Pieces() noexcept {
+        for(auto& t : m_types_)
+            if(t != MPI_BYTE) MPI_Type_free(&t);
+    }
+    const int* counts() const noexcept { return m_counts_.data(); }
+    const int* disp() const noexcept { return m_disp_.data(); }
+    const MPI_Datatype* types() const noexcept { return m_types_.data(); }
+
+private:
+    std::vector<int> m_counts_;
+    std::vector<int> m_disp_;
+    std::vector<MPI_Datatype> m_types_;
+};
+
+/// Waits on all of @p requests
+void wait_all_(std::vector<MPI_Request>& requests) {
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+}
+
+/// Gathers to @p root with point-to-point messages
+void p2p_gatherv_(const void* in, count_type n, void* out,
+                  const count_vector& sizes, const offset_vector& disp,
+                  int root, MPI_Comm comm) {
+    DupComm dup(comm);
+    int me, n_ranks;
+    MPI_Comm_rank(comm, &me);
+    MPI_Comm_size(comm, &n_ranks);
+
+    // N.B. In place is only allowed for all gathers, so disp is set
+    if(in == MPI_IN_PLACE) {
+        in = offset_(out, disp[me]);
+        n  = sizes[me];
+    }
+
+    if(me != root) {
+        ByteType t(n);
+        if(n > 0) MPI_Send(in, t.count(), t.type(), root, 0, dup);
+        return;
+    }
+
+    std::vector<MPI_Request> requests;
+    for(int r = 0; r < n_ranks; ++r) {
+        if(r == root || sizes[r] == 0) continue;
+        ByteType t(sizes[r]);
+        requests.emplace_back();
+        MPI_Irecv(offset_(out, disp[r]), t.count(), t.type(), r, 0, dup,
+                  &requests.back());
+    }
+    auto p_mine = offset_(out, disp[root]);
+    if(n > 0 && in != p_mine) std::memcpy(p_mine, in, n);
+    wait_all_(requests);
+}
+
+/// Gathers with MPI_Gatherv/MPI_Allgatherv, or point-to-point if needed
+void gatherv_(const void* in, count_type n, void* out,
+              const count_vector& sizes, const offset_vector& disp,
+              opt_root_t root, MPI_Comm comm) {
+    // N.B. Every process has the sizes, so they all take the same path
+    if(!fits_(sizes, disp)) {
+        p2p_gatherv_(in, n, out, sizes, disp, root.value_or(0), comm);
+        if(!root.has_value()) bcast_bytes(out, extent_(sizes, disp), 0, comm);
+        return;
+    }
+
+    auto int_sizes      = to_int_(sizes);
+    auto int_disp       = to_int_(disp);
+    const auto* p_sizes = int_sizes.data();
+    const auto* p_disp  = int_disp.data();
+    auto byte           = MPI_BYTE;
+    if(root.has_value()) {
+        MPI_Gatherv(in, n, byte, out, p_sizes, p_disp, byte, *root, comm);
+    } else {
+        MPI_Allgatherv(in, n, byte, out, p_sizes, p_disp, byte, comm);
+    }
+}
+#endif
+
+} // namespace
+
+count_type max_int_count() noexcept { return g_max_int_count; }
+
+void set_max_int_count(count_type n) noexcept {
+    g_max_int_count = std::clamp<count_type>(n, 1, INT_MAX);
+}
+
+// -----------------------------------------------------------------------------
+// -- ByteType
+// -----------------------------------------------------------------------------
+
+ByteType::ByteType(count_type n) {
+    const auto chunk = max_int_count();
+    if(n <= chunk) {
+        m_count_ = n;
+        return;
+    }
+
+    // Blocks of chunk bytes, followed by the remaining bytes
+    const count_type n_chunks = n / chunk;
+    const count_type n_left   = n % chunk;
+    MPI_Datatype chunk_type, bulk_type;
+    MPI_Type_contiguous(chunk, MPI_BYTE, &chunk_type);
+    MPI_Type_contiguous(n_chunks, chunk_type, &bulk_type);
+
+    int lengths[2]        = {1, int(n_left)};
+    MPI_Aint disp[2]      = {0, MPI_Aint(n_chunks * chunk)};
+    MPI_Datatype types[2] = {bulk_type, MPI_BYTE};
+    MPI_Type_create_struct(n_left > 0 ? 2 : 1, lengths, disp, types, &m_type_);
+    MPI_Type_commit(&m_type_);
+    MPI_Type_free(&bulk_type);
+    MPI_Type_free(&chunk_type);
+    m_count_ = 1;
+}
+
+ByteType::~ByteType() noexcept {
+    if(m_type_ == MPI_BYTE) return;
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if(!finalized) MPI_Type_free(&m_type_);
+}
+
+// -----------------------------------------------------------------------------
+// -- Collectives
+// -----------------------------------------------------------------------------
+
+count_type byte_count(const MPI_Status& status) {
+    count_type n = 0;
+#if MPI_VERSION >= 4
+    MPI_Get_count_c(&status, MPI_BYTE, &n);
+#else
+    MPI_Get_elements_x(&status, MPI_BYTE, &n);
+#endif
+    return n;
+}
+
+void bcast_bytes(void* data, count_type n, int root, MPI_Comm comm) {
+#if MPI_VERSION >= 4
+    MPI_Bcast_c(data, n, MPI_BYTE, root, comm);
+#else
+    ByteType t(n);
+    MPI_Bcast(data, t.count(), t.type(), root, comm);
+#endif
+}
+
+void gather_bytes(const void* in, count_type n, void* out, opt_root_t root,
+                  MPI_Comm comm) {
+#if MPI_VERSION >= 4
+    auto byte = MPI_BYTE;
+    if(root.has_value()) {
+        MPI_Gather_c(in, n, byte, out, n, byte, *root, comm);
+    } else {
+        MPI_Allgather_c(in, n, byte, out, n, byte, comm);
+    }
+#else
+    ByteType t(n);
+    auto [count, type] = std::make_pair(t.count(), t.type());
+    if(root.has_value()) {
+        MPI_Gather(in, count, type, out, count, type, *root, comm);
+    } else {
+        MPI_Allgather(in, count, type, out, count, type, comm);
+    }
+#endif
+}
+
+MPI_Request igather_bytes(const void* in, count_type n, void* out,
+                          opt_root_t root, MPI_Comm comm) {
+    MPI_Request request;
+#if MPI_VERSION >= 4
+    auto byte = MPI_BYTE;
+    if(root.has_value()) {
+        MPI_Igather_c(in, n, byte, out, n, byte, *root, comm, &request);
+    } else {
+        MPI_Iallgather_c(in, n, byte, out, n, byte, comm, &request);
+    }
+#else
+    // N.B. Freeing the datatype doesn't affect the pending operation
+    ByteType t(n);
+    auto [count, type] = std::make_pair(t.count(), t.type());
+    if(root.has_value()) {
+        MPI_Igather(in, count, type, out, count, type, *root, comm, &request);
+    } else {
+        MPI_Iallgather(in, count, type, out, count, type, comm, &request);
+    }
+#endif
+    return request;
+}
+
+void gatherv_bytes(const void* in, count_type n, void* out,
+                   const count_vector& sizes, const offset_vector& disp,
+                   opt_root_t root, MPI_Comm comm) {
+#if MPI_VERSION >= 4
+    const auto* p_sizes = sizes.data();
+    const auto* p_disp  = disp.data();
+    auto byte           = MPI_BYTE;
+    if(root.has_value()) {
+        MPI_Gatherv_c(in, n, byte, out, p_sizes, p_disp, byte, *root, comm);
+    } else {
+        MPI_Allgatherv_c(in, n, byte, out, p_sizes, p_disp, byte, comm);
+    }
+#else
+    gatherv_(in, n, out, sizes, disp, root, comm);
+#endif
+}
+
+MPI_Request igatherv_bytes(const void* in, count_type n, void* out,
+                           const count_vector& sizes, const offset_vector& disp,
+                           opt_root_t root, MPI_Comm comm,
+                           std::shared_ptr<const void>& keep_alive) {
+    MPI_Request request = MPI_REQUEST_NULL;
+    const auto byte     = MPI_BYTE;
+#if MPI_VERSION >= 4
+    const auto* p_sizes = sizes.data();
+    const auto* p_disp  = disp.data();
+    if(root.has_value()) {
+        MPI_Igatherv_c(in, n, byte, out, p_sizes, p_disp, byte, *root, comm,
+                       &request);
+    } else {
+        MPI_Iallgatherv_c(in, n, byte, out, p_sizes, p_disp, byte, comm,
+                          &request);
+    }
+#else
+    if(!fits_(sizes, disp)) {
+        gatherv_(in, n, out, sizes, disp, root, comm);
+        return request;
+    }
+
+    // The int versions of the arrays must outlive the request
+    using arrays_type = std::pair<std::vector<int>, std::vector<int>>;
+    auto arrays       = std::make_shared<arrays_type>();
+    arrays->first     = to_int_(sizes);
+    arrays->second    = to_int_(disp);
+
+    const auto* p_sizes = arrays->first.data();
+    const auto* p_disp  = arrays->second.data();
+    if(root.has_value()) {
+        MPI_Igatherv(in, n, byte, out, p_sizes, p_disp, byte, *root, comm,
+                     &request);
+    } else {
+        MPI_Iallgatherv(in, n, byte, out, p_sizes, p_disp, byte, comm,
+                        &request);
+    }
+    keep_alive = std::move(arrays);
+#endif
+    return request;
+}
+
+void scatter_bytes(const void* in, void* out, count_type n, int root,
+                   MPI_Comm comm) {
+#if MPI_VERSION >= 4
+    MPI_Scatter_c(in, n, MPI_BYTE, out, n, MPI_BYTE, root, comm);
+#else
+    ByteType t(n);
+    MPI_Scatter(in, t.count(), t.type(), out, t.count(), t.type(), root, comm);
+#endif
+}
+
+void scatterv_bytes(const void* in, const count_vector& sizes,
+                    const offset_vector& disp, void* out, count_type n,
+                    int root, MPI_Comm comm) {
+    const auto byte = MPI_BYTE;
+#if MPI_VERSION >= 4
+    MPI_Scatterv_c(in, sizes.data(), disp.data(), byte, out, n, byte, root,
+                   comm);
+#else
+    int me, n_ranks;
+    MPI_Comm_rank(comm, &me);
+    MPI_Comm_size(comm, &n_ranks);
+    if(fits_(sizes, disp)) {
+        auto int_sizes = to_int_(sizes);
+        auto int_disp  = to_int_(disp);
+        MPI_Scatterv(in, int_sizes.data(), int_disp.data(), byte, out, n, byte,
+                     root, comm);
+        return;
+    }
+
+    // Point-to-point fallback
+    DupComm dup(comm);
+    if(me != root) {
+        ByteType t(n);
+        if(n > 0) MPI_Recv(out, t.count(), t.type(), root, 0, dup, nullptr);
+        return;
+    }
+    std::vector<MPI_Request> requests;
+    for(int r = 0; r < n_ranks; ++r) {
+        if(r == root || sizes[r] == 0) continue;
+        ByteType t(sizes[r]);
+        requests.emplace_back();
+        MPI_Isend(offset_(in, disp[r]), t.count(), t.type(), r, 0, dup,
+                  &requests.back());
+    }
+    if(sizes[root] > 0)
+        std::memcpy(out, offset_(in, disp[root]), sizes[root]);
+    wait_all_(requests);
+#endif
+}
+
+void alltoall_bytes(const void* in, void* out, count_type n, MPI_Comm comm) {
+#if MPI_VERSION >= 4
+    MPI_Alltoall_c(in, n, MPI_BYTE, out, n, MPI_BYTE, comm);
+#else
+    ByteType t(n);
+    MPI_Alltoall(in, t.count(), t.type(), out, t.count(), t.type(), comm);
+#endif
+}
+
+void alltoallv_bytes(const void* in, const count_vector& sizes,
+                     const offset_vector& disp, void* out,
+                     const count_vector& out_sizes,
+                     const offset_vector& out_disp, MPI_Comm comm) {
+#if MPI_VERSION >= 4
+    MPI_Alltoallv_c(in, sizes.data(), disp.data(), MPI_BYTE, out,
+                    out_sizes.data(), out_disp.data(), MPI_BYTE, comm);
+#else
+    Pieces send(sizes, disp);
+    Pieces recv(out_sizes, out_disp);
+    MPI_Alltoallw(in, send.counts(), send.disp(), send.types(), out,
+                  recv.counts(), recv.disp(), recv.types(), comm);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+// -- Point-to-Point
+// -----------------------------------------------------------------------------
+
+void send_bytes(const void* data, count_type n, int dest, int tag,
+                MPI_Comm comm) {
+#if MPI_VERSION >= 4
+    MPI_Send_c(data, n, MPI_BYTE, dest, tag, comm);
+#else
+    ByteType t(n);
+    MPI_Send(data, t.count(), t.type(), dest, tag, comm);
+#endif
+}
+
+MPI_Request isend_bytes(const void* data, count_type n, int dest, int tag,
+                        MPI_Comm comm) {
+    MPI_Request request;
+#if MPI_VERSION >= 4
+    MPI_Isend_c(data, n, MPI_BYTE, dest, tag, comm, &request);
+#else
+    ByteType t(n);
+    MPI_Isend(data, t.count(), t.type(), dest, tag, comm, &request);
+#endif
+    return request;
+}
+
+void mrecv_bytes(void* data, count_type n, MPI_Message& message) {
+#if MPI_VERSION >= 4
+    MPI_Mrecv_c(data, n, MPI_BYTE, &message, MPI_STATUS_IGNORE);
+#else
+    ByteType t(n);
+    MPI_Mrecv(data, t.count(), t.type(), &message, MPI_STATUS_IGNORE);
+#endif
+}
+
+MPI_Request imrecv_bytes(void* data, count_type n, MPI_Message& message) {
+    MPI_Request request;
+#if MPI_VERSION >= 4
+    MPI_Imrecv_c(data, n, MPI_BYTE, &message, &request);
+#else
+    ByteType t(n);
+    MPI_Imrecv(data, t.count(), t.type(), &message, &request);
+#endif
+    return request;
+}
+
+void sendrecv_bytes(const void* send, count_type n_send, int dest, void* recv,
+                    count_type n_recv, int source, int tag, MPI_Comm comm) {
+#if MPI_VERSION >= 4
+    MPI_Sendrecv_c(send, n_send, MPI_BYTE, dest, tag, recv, n_recv, MPI_BYTE,
+                   source, tag, comm, MPI_STATUS_IGNORE);
+#else
+    ByteType t_send(n_send);
+    ByteType t_recv(n_recv);
+    MPI_Sendrecv(send, t_send.count(), t_send.type(), dest, tag, recv,
+                 t_recv.count(), t_recv.type(), source, tag, comm,
+                 MPI_STATUS_IGNORE);
+#endif
+}
+
+void put_bytes(const void* data, count_type n, int rank, offset_type disp,
+               MPI_Win win) {
+#if MPI_VERSION >= 4
+    MPI_Put_c(data, n, MPI_BYTE, rank, disp, n, MPI_BYTE, win);
+#else
+    ByteType t(n);
+    MPI_Put(data, t.count(), t.type(), rank, disp, t.count(), t.type(), win);
+#endif
+}
+
+void get_bytes(void* data, count_type n, int rank, offset_type disp,
+               MPI_Win win) {
+#if MPI_VERSION >= 4
+    MPI_Get_c(data, n, MPI_BYTE, rank, disp, n, MPI_BYTE, win);
+#else
+    ByteType t(n);
+    MPI_Get(data, t.count(), t.type(), rank, disp, t.count(), t.type(), win);
+#endif
+}
+
+} // namespace parallelzone::mpi_helpers::detail_
@@ -0,0 +1,192 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <memory>
+#include <mpi.h>
+#include <optional>
+#include <vector>
+
+/** @file large_count.hpp
+ *
+ *  Wrappers around the MPI routines CommPPPIMPL uses which work for any
+ *  number of bytes. The classic MPI routines take counts and displacements
+ *  as int, which limits them to 2 GiB. If the MPI library supports MPI-4 the
+ *  wrappers call the large-count ("_c") versions of the routines. Otherwise:
+ *
+ *  - counts which do not fit in an int are sent as one element of a derived
+ *    datatype spanning all of the bytes (see ByteType), and
+ *  - gathervs and scattervs whose counts or displacements do not fit in an
+ *    int are done with point-to-point messages (on a duplicate
+ *    communicator, so they can not be confused with the user's messages).
+ *    Every process is given every count and displacement (even for the
+ *    rooted versions), so they agree on which path to take without
+ *    communicating.
+ *  - alltoallv is done with MPI_Alltoallw, which takes a datatype per
+ *    process. Each process describes the pieces of its buffers which do
+ *    not fit in an int with derived datatypes, so no agreement is needed.
+ *
+ *  All counts and displacements are in bytes.
+ */
+
+namespace parallelzone::mpi_helpers::detail_ {
+
+/// Type of a number of bytes (same as CommPP::byte_count_type)
+using count_type = MPI_Count;
+
+/// Type of an offset in bytes (same as CommPP::byte_offset_type)
+using offset_type = MPI_Aint;
+
+/// Type of the number of bytes per process
+using count_vector = std::vector<count_type>;
+
+/// Type of the offset of each process's bytes
+using offset_vector = std::vector<offset_type>;
+
+/// Type of an optional root, not set means every process is a root
+using opt_root_t = std::optional<int>;
+
+/// The largest count passed to routines taking an int (INT_MAX by default)
+count_type max_int_count() noexcept;
+
+/** @brief Lowers the largest count passed to routines taking an int.
+ *
+ *  This exists so the fallback paths can be tested without multi-GiB
+ *  buffers. It only affects MPI libraries without large-count routines, and
+ *  must be set to the same value on every process.
+ *
+ *  @param[in] n The new limit. Values outside [1, INT_MAX] are clamped.
+ */
+void set_max_int_count(count_type n) noexcept;
+
+/** @brief Describes a number of bytes as an int count of some datatype.
+ *
+ *  If the number of bytes fits in an int the datatype is MPI_BYTE. Otherwise
+ *  it is a committed derived datatype spanning all of the bytes (blocks of
+ *  max_int_count() bytes followed by the remainder) and the count is 1. The
+ *  datatype's extent is the number of bytes, so consecutive elements are
+ *  laid out back-to-back. Since the type map is just bytes, a message sent
+ *  with one ByteType can be received with another of the same size (or
+ *  with MPI_BYTE).
+ */
+class ByteType {
+public:
+    /// Describes @p n bytes
+    explicit ByteType(count_type n);
+
+    /// Deleted because *this may own an MPI datatype
+    ByteType(const ByteType&) = delete;
+
+    /// Deleted because *this may own an MPI datatype
+    ByteType& operator=(const ByteType&) = delete;
+
+    /// Frees the datatype if *this owns one (pending operations still finish)
+    ~ByteType() noexcept;
+
+    /// The count to pass with type()
+    int count() const noexcept { return m_count_; }
+
+    /// The datatype to pass with count()
+    MPI_Datatype type() const noexcept { return m_type_; }
+
+private:
+    /// The number of elements of m_type_
+    int m_count_ = 0;
+
+    /// MPI_BYTE or a derived datatype owned by *this
+    MPI_Datatype m_type_ = MPI_BYTE;
+};
+
+/// Number of bytes in the message @p status describes
+count_type byte_count(const MPI_Status& status);
+
+/// MPI_Bcast of @p n bytes
+void bcast_bytes(void* data, count_type n, int root, MPI_Comm comm);
+
+/// MPI_Gather (or MPI_Allgather if @p root isn't set) of @p n bytes per rank
+void gather_bytes(const void* in, count_type n, void* out, opt_root_t root,
+                  MPI_Comm comm);
+
+/// MPI_Igather (or MPI_Iallgather if @p root isn't set)
+MPI_Request igather_bytes(const void* in, count_type n, void* out,
+                          opt_root_t root, MPI_Comm comm);
+
+/** @brief MPI_Gatherv (or MPI_Allgatherv if @p root isn't set).
+ *
+ *  @p sizes and @p disp must be set on every process. @p in may be
+ *  MPI_IN_PLACE on the root(s).
+ */
+void gatherv_bytes(const void* in, count_type n, void* out,
+                   const count_vector& sizes, const offset_vector& disp,
+                   opt_root_t root, MPI_Comm comm);
+
+/** @brief MPI_Igatherv (or MPI_Iallgatherv if @p root isn't set).
+ *
+ *  @p sizes and @p disp must be set on every process and must outlive the
+ *  returned request, as must @p keep_alive, which is set to any other
+ *  arrays the request uses. If the fallback path is needed, the gather is
+ *  done before returning and the returned request is MPI_REQUEST_NULL.
+ */
+MPI_Request igatherv_bytes(const void* in, count_type n, void* out,
+                           const count_vector& sizes, const offset_vector& disp,
+                           opt_root_t root, MPI_Comm comm,
+                           std::shared_ptr<const void>& keep_alive);
+
+/// MPI_Scatter of @p n bytes per rank
+void scatter_bytes(const void* in, void* out, count_type n, int root,
+                   MPI_Comm comm);
+
+/// MPI_Scatterv, @p sizes and @p disp must be set on every process
+void scatterv_bytes(const void* in, const count_vector& sizes,
+                    const offset_vector& disp, void* out, count_type n,
+                    int root, MPI_Comm comm);
+
+/// MPI_Alltoall of @p n bytes per pair of ranks
+void alltoall_bytes(const void* in, void* out, count_type n, MPI_Comm comm);
+
+/// MPI_Alltoallv
+void alltoallv_bytes(const void* in, const count_vector& sizes,
+                     const offset_vector& disp, void* out,
+                     const count_vector& out_sizes,
+                     const offset_vector& out_disp, MPI_Comm comm);
+
+/// MPI_Send of @p n bytes
+void send_bytes(const void* data, count_type n, int dest, int tag,
+                MPI_Comm comm);
+
+/// MPI_Isend of @p n bytes
+MPI_Request isend_bytes(const void* data, count_type n, int dest, int tag,
+                        MPI_Comm comm);
+
+/// MPI_Mrecv of (at most) @p n bytes
+void mrecv_bytes(void* data, count_type n, MPI_Message& message);
+
+/// MPI_Imrecv of (at most) @p n bytes
+MPI_Request imrecv_bytes(void* data, count_type n, MPI_Message& message);
+
+/// MPI_Sendrecv of @p n_send bytes to @p dest and @p n_recv from @p source
+void sendrecv_bytes(const void* send, count_type n_send, int dest, void* recv,
+                    count_type n_recv, int source, int tag, MPI_Comm comm);
+
+/// MPI_Put of @p n bytes to byte @p disp of @p rank's region of @p win
+void put_bytes(const void* data, count_type n, int rank, offset_type disp,
+               MPI_Win win);
+
+/// MPI_Get of @p n bytes from byte @p disp of @p rank's region of @p win
+void get_bytes(void* data, count_type n, int rank, offset_type disp,
+               MPI_Win win);
+
+} // namespace parallelzone::mpi_helpers::detail_
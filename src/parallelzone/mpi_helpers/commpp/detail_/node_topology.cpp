@@ -0,0 +1,70 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "node_topology.hpp"
+
+namespace parallelzone::mpi_helpers::detail_ {
+
+NodeTopology::NodeTopology(mpi_comm_type comm,
+                           std::optional<size_type> color) {
+    int me = 0, n_ranks = 0;
+    MPI_Comm_rank(comm, &me);
+    MPI_Comm_size(comm, &n_ranks);
+
+    // Step 0: Split into nodes, keeping the original order within a node
+    if(color.has_value()) {
+        MPI_Comm_split(comm, *color, me, &m_node_comm_);
+    } else {
+        MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, me, MPI_INFO_NULL,
+                            &m_node_comm_);
+    }
+    int node_rank = 0;
+    MPI_Comm_rank(m_node_comm_, &node_rank);
+
+    // Step 1: The lowest rank on each node is its leader
+    const int leader_color = node_rank == 0 ? 0 : MPI_UNDEFINED;
+    MPI_Comm_split(comm, leader_color, me, &m_leader_comm_);
+
+    // Step 2: Number the nodes by their leader, and tell everyone
+    int my_node = 0;
+    if(is_leader()) MPI_Comm_rank(m_leader_comm_, &my_node);
+    MPI_Bcast(&my_node, 1, MPI_INT, 0, m_node_comm_);
+    m_node_of_.resize(n_ranks);
+    MPI_Allgather(&my_node, 1, MPI_INT, m_node_of_.data(), 1, MPI_INT, comm);
+
+    // Step 3: Work out which ranks are on each node
+    for(size_type r = 0; r < n_ranks; ++r) {
+        const auto node = m_node_of_[r];
+        if(std::size_t(node) >= m_members_.size()) m_members_.resize(node + 1);
+        m_members_[node].push_back(r);
+    }
+    for(const auto& members : m_members_) {
+        for(const auto r : members) {
+            if(r != size_type(m_order_.size())) m_in_order_ = false;
+            m_order_.push_back(r);
+        }
+    }
+}
+
+NodeTopology::~NodeTopology() noexcept {
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if(finalized) return;
+    if(m_leader_comm_ != MPI_COMM_NULL) MPI_Comm_free(&m_leader_comm_);
+    if(m_node_comm_ != MPI_COMM_NULL) MPI_Comm_free(&m_node_comm_);
+}
+
+} // namespace parallelzone::mpi_helpers::detail_
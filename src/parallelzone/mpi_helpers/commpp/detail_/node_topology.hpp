@@ -0,0 +1,118 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <mpi.h>
+#include <optional>
+#include <vector>
+
+namespace parallelzone::mpi_helpers::detail_ {
+
+/** @brief Describes how the processes of a communicator are spread over nodes.
+ *
+ *  Hierarchical collectives work in two levels: first among the processes on
+ *  the same node (which communicate through shared memory), then among one
+ *  "leader" process per node. This class builds and owns the communicators
+ *  for the two levels, and records which node each process is on.
+ *
+ *  By default nodes are found with
+ *  MPI_Comm_split_type(MPI_COMM_TYPE_SHARED), i.e., processes which can share
+ *  memory are on the same node. For testing (and for grouping processes
+ *  differently) a color may be provided instead; processes with the same
+ *  color are then treated as being on the same node.
+ *
+ *  Nodes are numbered by the rank of their leader in the leader
+ *  communicator. The leader of a node is the process with the lowest rank
+ *  (in the original communicator) on that node.
+ */
+class NodeTopology {
+public:
+    /// Type of an MPI communicator
+    using mpi_comm_type = MPI_Comm;
+
+    /// Type used for ranks and counts (same as CommPP::size_type)
+    using size_type = int;
+
+    /// Type of a list of ranks
+    using rank_container = std::vector<size_type>;
+
+    /** @brief Determines the node layout of @p comm.
+     *
+     *  This is a collective operation over @p comm.
+     *
+     *  @param[in] comm  The communicator to split into nodes.
+     *  @param[in] color If set, the processes are grouped by this value
+     *                   instead of by shared-memory domain. Must be
+     *                   non-negative and set on all processes or none.
+     */
+    NodeTopology(mpi_comm_type comm, std::optional<size_type> color);
+
+    /// Deleted because *this owns MPI communicators
+    NodeTopology(const NodeTopology&) = delete;
+
+    /// Deleted because *this owns MPI communicators
+    NodeTopology& operator=(const NodeTopology&) = delete;
+
+    /// Frees the communicators, unless MPI has already been finalized
+    ~NodeTopology() noexcept;
+
+    /// Communicator containing the processes on this process's node
+    mpi_comm_type node_comm() const noexcept { return m_node_comm_; }
+
+    /// Communicator containing the node leaders, MPI_COMM_NULL if not a leader
+    mpi_comm_type leader_comm() const noexcept { return m_leader_comm_; }
+
+    /// Is this process the leader of its node?
+    bool is_leader() const noexcept { return m_leader_comm_ != MPI_COMM_NULL; }
+
+    /// The number of nodes
+    size_type n_nodes() const noexcept { return m_members_.size(); }
+
+    /// The node the process with rank @p rank is on
+    size_type node_of(size_type rank) const { return m_node_of_.at(rank); }
+
+    /// The ranks on node @p node, in increasing order
+    const rank_container& members(size_type node) const {
+        return m_members_.at(node);
+    }
+
+    /// All ranks, grouped by node (nodes in order, ranks in increasing order)
+    const rank_container& order() const noexcept { return m_order_; }
+
+    /// True if order() is 0, 1, 2, ..., i.e., each node is a block of ranks
+    bool in_order() const noexcept { return m_in_order_; }
+
+private:
+    /// The processes on the same node as this process
+    mpi_comm_type m_node_comm_ = MPI_COMM_NULL;
+
+    /// The node leaders (MPI_COMM_NULL if this process is not one)
+    mpi_comm_type m_leader_comm_ = MPI_COMM_NULL;
+
+    /// m_node_of_[r] is the node rank r is on
+    rank_container m_node_of_;
+
+    /// m_members_[n] are the ranks on node n
+    std::vector<rank_container> m_members_;
+
+    /// The concatenation of m_members_
+    rank_container m_order_;
+
+    /// Is m_order_ the identity permutation?
+    bool m_in_order_ = true;
+};
+
+} // namespace parallelzone::mpi_helpers::detail_
@@ -0,0 +1,153 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "large_count.hpp"
+#include "rma_window_pimpl.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace parallelzone::mpi_helpers::detail_ {
+
+RMAWindowPIMPL::pimpl_pointer RMAWindowPIMPL::allocate(std::size_t n_bytes,
+                                                       MPI_Comm comm) {
+    void* base = nullptr;
+    mpi_window_type win;
+    MPI_Win_allocate(n_bytes, 1, MPI_INFO_NULL, comm, &base, &win);
+    if(n_bytes > 0) std::memset(base, 0, n_bytes);
+    auto* p = static_cast<std::byte*>(base);
+    return pimpl_pointer(new RMAWindowPIMPL(win, p, n_bytes, comm));
+}
+
+RMAWindowPIMPL::pimpl_pointer RMAWindowPIMPL::expose(binary_reference region,
+                                                     MPI_Comm comm) {
+    mpi_window_type win;
+    MPI_Win_create(region.data(), region.size(), 1, MPI_INFO_NULL, comm, &win);
+    return pimpl_pointer(
+      new RMAWindowPIMPL(win, region.data(), region.size(), comm));
+}
+
+RMAWindowPIMPL::RMAWindowPIMPL(mpi_window_type win, std::byte* base,
+                               std::size_t n_bytes, MPI_Comm comm) :
+  m_win_(win), m_base_(base) {
+    int n_ranks = 0;
+    MPI_Comm_rank(comm, &m_rank_);
+    MPI_Comm_size(comm, &n_ranks);
+    m_sizes_.resize(n_ranks);
+    gather_bytes(&n_bytes, sizeof(n_bytes), m_sizes_.data(), std::nullopt,
+                 comm);
+}
+
+RMAWindowPIMPL::~RMAWindowPIMPL() noexcept {
+    int finalized = 0;
+    MPI_Finalized(&finalized);
+    if(!finalized) MPI_Win_free(&m_win_);
+}
+
+std::size_t RMAWindowPIMPL::region_size(size_type rank) const {
+    if(rank < 0 || rank >= size())
+        throw std::out_of_range("Rank " + std::to_string(rank) +
+                                " is not part of the window");
+    return m_sizes_[rank];
+}
+
+// -----------------------------------------------------------------------------
+// -- Synchronization
+// -----------------------------------------------------------------------------
+
+void RMAWindowPIMPL::lock(size_type rank, lock_type type) const {
+    region_size(rank); // Bounds checks rank
+    const bool shared = type == lock_type::shared;
+    MPI_Win_lock(shared ? MPI_LOCK_SHARED : MPI_LOCK_EXCLUSIVE, rank, 0,
+                 m_win_);
+}
+
+void RMAWindowPIMPL::unlock(size_type rank) const {
+    region_size(rank);
+    MPI_Win_unlock(rank, m_win_);
+}
+
+void RMAWindowPIMPL::lock_all() const { MPI_Win_lock_all(0, m_win_); }
+
+void RMAWindowPIMPL::unlock_all() const { MPI_Win_unlock_all(m_win_); }
+
+void RMAWindowPIMPL::flush(size_type rank) const {
+    region_size(rank);
+    MPI_Win_flush(rank, m_win_);
+}
+
+void RMAWindowPIMPL::flush_all() const { MPI_Win_flush_all(m_win_); }
+
+void RMAWindowPIMPL::fence() const { MPI_Win_fence(0, m_win_); }
+
+// -----------------------------------------------------------------------------
+// -- One-sided Operations
+// -----------------------------------------------------------------------------
+
+void RMAWindowPIMPL::put(const_binary_reference data, size_type rank,
+                         std::size_t disp) const {
+    check_range_(rank, disp, data.size());
+    if(data.size() == 0) return;
+    put_bytes(data.data(), data.size(), rank, disp, m_win_);
+}
+
+void RMAWindowPIMPL::get(binary_reference out, size_type rank,
+                         std::size_t disp) const {
+    check_range_(rank, disp, out.size());
+    if(out.size() == 0) return;
+    get_bytes(out.data(), out.size(), rank, disp, m_win_);
+}
+
+void RMAWindowPIMPL::accumulate(const void* data, std::size_t n,
+                                MPI_Datatype type, MPI_Op op, size_type rank,
+                                std::size_t disp) const {
+    int type_size = 0;
+    MPI_Type_size(type, &type_size);
+    check_range_(rank, disp, n * type_size);
+
+    // Each chunk is element-wise atomic, which is all MPI promises anyway
+    const auto* p = static_cast<const std::byte*>(data);
+    while(n > 0) {
+        const auto n_chunk = std::min<std::size_t>(n, max_int_count());
+        MPI_Accumulate(p, n_chunk, type, rank, disp, n_chunk, type, op,
+                       m_win_);
+        p += n_chunk * type_size;
+        disp += n_chunk * type_size;
+        n -= n_chunk;
+    }
+}
+
+void RMAWindowPIMPL::fetch_and_op(const void* value, void* old,
+                                  MPI_Datatype type, MPI_Op op, size_type rank,
+                                  std::size_t disp) const {
+    int type_size = 0;
+    MPI_Type_size(type, &type_size);
+    check_range_(rank, disp, type_size);
+    MPI_Fetch_and_op(value, old, type, rank, disp, op, m_win_);
+    MPI_Win_flush(rank, m_win_);
+}
+
+void RMAWindowPIMPL::check_range_(size_type rank, std::size_t disp,
+                                  std::size_t n) const {
+    const auto n_region = region_size(rank);
+    if(disp > n_region || n > n_region - disp)
+        throw std::out_of_range("RMA operation does not fit in the region of "
+                                "rank " +
+                                std::to_string(rank));
+}
+
+} // namespace parallelzone::mpi_helpers::detail_
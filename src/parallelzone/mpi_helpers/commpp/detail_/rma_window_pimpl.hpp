@@ -0,0 +1,183 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <memory>
+#include <mpi.h>
+#include <parallelzone/mpi_helpers/commpp/rma_window.hpp>
+#include <vector>
+
+namespace parallelzone::mpi_helpers::detail_ {
+
+/** @brief Owns an MPI window and implements the RMAWindow class.
+ *
+ *  The window's displacement unit is one byte, so every displacement given
+ *  to the MPI calls is a byte offset. When the window is created, the sizes
+ *  of every process's region are gathered, so one-sided operations can be
+ *  bounds checked at the origin (MPI itself does not check them).
+ */
+class RMAWindowPIMPL {
+public:
+    /// Type of the class *this implements
+    using parent_type = RMAWindow;
+
+    /// Ultimately a typedef of RMAWindow::pimpl_pointer
+    using pimpl_pointer = parent_type::pimpl_pointer;
+
+    /// Ultimately a typedef of RMAWindow::size_type
+    using size_type = parent_type::size_type;
+
+    /// Ultimately a typedef of RMAWindow::binary_reference
+    using binary_reference = parent_type::binary_reference;
+
+    /// Ultimately a typedef of RMAWindow::const_binary_reference
+    using const_binary_reference = parent_type::const_binary_reference;
+
+    /// Ultimately a typedef of RMAWindow::mpi_window_type
+    using mpi_window_type = parent_type::mpi_window_type;
+
+    /// Ultimately a typedef of RMAWindow::lock_type
+    using lock_type = parent_type::lock_type;
+
+    /// Type of the sizes of each process's region
+    using region_sizes = std::vector<std::size_t>;
+
+    /** @brief Collectively allocates @p n_bytes on each process of @p comm
+     *         (MPI_Win_allocate).
+     *
+     *  The memory is zero-initialized and freed along with the window.
+     *
+     *  @param[in] n_bytes The size of this process's region.
+     *  @param[in] comm    The communicator the window is created on.
+     *
+     *  @return The PIMPL of the new window.
+     */
+    static pimpl_pointer allocate(std::size_t n_bytes, MPI_Comm comm);
+
+    /** @brief Collectively exposes existing memory (MPI_Win_create).
+     *
+     *  @param[in] region This process's region. Must outlive the window.
+     *  @param[in] comm   The communicator the window is created on.
+     *
+     *  @return The PIMPL of the new window.
+     */
+    static pimpl_pointer expose(binary_reference region, MPI_Comm comm);
+
+    /// Deleted because MPI windows can not be copied
+    RMAWindowPIMPL(const RMAWindowPIMPL&) = delete;
+
+    /// Deleted because MPI windows can not be copied
+    RMAWindowPIMPL& operator=(const RMAWindowPIMPL&) = delete;
+
+    /// Frees the window (collectively), unless MPI has been finalized
+    ~RMAWindowPIMPL() noexcept;
+
+    /// The MPI window
+    mpi_window_type window() const noexcept { return m_win_; }
+
+    /// The number of processes sharing the window
+    size_type size() const noexcept { return size_type(m_sizes_.size()); }
+
+    /// The size of @p rank's region, throws std::out_of_range if invalid
+    std::size_t region_size(size_type rank) const;
+
+    /// This process's region
+    binary_reference local() const noexcept {
+        return binary_reference(m_base_, m_sizes_[m_rank_]);
+    }
+
+    /// Wraps MPI_Win_lock
+    void lock(size_type rank, lock_type type) const;
+
+    /// Wraps MPI_Win_unlock
+    void unlock(size_type rank) const;
+
+    /// Wraps MPI_Win_lock_all
+    void lock_all() const;
+
+    /// Wraps MPI_Win_unlock_all
+    void unlock_all() const;
+
+    /// Wraps MPI_Win_flush
+    void flush(size_type rank) const;
+
+    /// Wraps MPI_Win_flush_all
+    void flush_all() const;
+
+    /// Wraps MPI_Win_fence
+    void fence() const;
+
+    /** @brief Writes @p data to byte @p disp of @p rank's region.
+     *
+     *  @throw std::out_of_range if the bytes do not fit. Strong throw
+     *                           guarantee.
+     */
+    void put(const_binary_reference data, size_type rank,
+             std::size_t disp) const;
+
+    /** @brief Reads byte @p disp onwards of @p rank's region into @p out.
+     *
+     *  @throw std::out_of_range if the bytes are not in the region. Strong
+     *                           throw guarantee.
+     */
+    void get(binary_reference out, size_type rank, std::size_t disp) const;
+
+    /** @brief Accumulates @p n elements of type @p type into @p rank's region
+     *         starting at byte @p disp.
+     *
+     *  Counts which do not fit in an int are split into several calls, each
+     *  of which is still element-wise atomic.
+     *
+     *  @throw std::out_of_range if the elements are not in the region. Strong
+     *                           throw guarantee.
+     */
+    void accumulate(const void* data, std::size_t n, MPI_Datatype type,
+                    MPI_Op op, size_type rank, std::size_t disp) const;
+
+    /** @brief Atomically applies @p op to @p value and the element of type
+     *         @p type at byte @p disp of @p rank's region, putting the old
+     *         element in @p old.
+     *
+     *  Flushes @p rank, so @p old is valid on return.
+     *
+     *  @throw std::out_of_range if the element is not in the region. Strong
+     *                           throw guarantee.
+     */
+    void fetch_and_op(const void* value, void* old, MPI_Datatype type,
+                      MPI_Op op, size_type rank, std::size_t disp) const;
+
+private:
+    /// Takes ownership of @p win, whose local region starts at @p base
+    RMAWindowPIMPL(mpi_window_type win, std::byte* base, std::size_t n_bytes,
+                   MPI_Comm comm);
+
+    /// Throws std::out_of_range unless [disp, disp + n) is in @p rank's region
+    void check_range_(size_type rank, std::size_t disp, std::size_t n) const;
+
+    /// The MPI window
+    mpi_window_type m_win_;
+
+    /// The start of this process's region
+    std::byte* m_base_;
+
+    /// The rank of this process
+    size_type m_rank_ = 0;
+
+    /// The size, in bytes, of each process's region
+    region_sizes m_sizes_;
+};
+
+} // namespace parallelzone::mpi_helpers::detail_
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "tag_registry.hpp"
+#include <cstdint>
+#include <stdexcept>
+
+namespace parallelzone::mpi_helpers::detail_ {
+namespace {
+
+// 64-bit FNV-1a, chosen because the result is platform independent
+std::uint64_t fnv1a(const std::string& s) noexcept {
+    std::uint64_t hash = 14695981039346656037ull;
+    for(unsigned char c : s) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+} // namespace
+
+TagRegistry::tag_type TagRegistry::tag(const std::string& name) {
+    std::lock_guard<std::mutex> lock(m_mutex_);
+
+    auto itr = m_tags_.find(name);
+    if(itr != m_tags_.end()) return itr->second;
+
+    const std::uint64_t n_tags = std::uint64_t(m_max_tag_) + 1;
+    const auto rv              = tag_type(fnv1a(name) % n_tags);
+
+    auto other = m_names_.find(rv);
+    if(other != m_names_.end())
+        throw std::runtime_error("Tag \"" + name + "\" collides with tag \"" +
+                                 other->second + "\"");
+
+    m_names_.emplace(rv, name);
+    m_tags_.emplace(name, rv);
+    return rv;
+}
+
+TagRegistry::size_type TagRegistry::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex_);
+    return m_tags_.size();
+}
+
+} // namespace parallelzone::mpi_helpers::detail_
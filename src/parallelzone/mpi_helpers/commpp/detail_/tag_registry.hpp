@@ -0,0 +1,84 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace parallelzone::mpi_helpers::detail_ {
+
+/** @brief Maps string tags to MPI's integer tags.
+ *
+ *  MPI tags are integers, but strings are much more descriptive. Since only
+ *  the sender and receiver of a message have to agree on its tag, the mapping
+ *  from string to integer needs to be the same on every process without any
+ *  communication. TagRegistry achieves this by hashing the string (with the
+ *  FNV-1a hash, which, unlike std::hash, is the same everywhere) into the
+ *  range of valid tags. Each tag handed out is remembered so that two strings
+ *  mapping to the same integer are detected, rather than silently matching
+ *  each other's messages.
+ *
+ *  TagRegistry is thread-safe.
+ */
+class TagRegistry {
+public:
+    /// Type of an MPI tag
+    using tag_type = int;
+
+    /// Type used for counting
+    using size_type = std::size_t;
+
+    /** @brief Creates a registry which hands out tags in [0, @p max_tag].
+     *
+     *  @param[in] max_tag The largest tag which may be handed out. Usually
+     *                     this is the MPI_TAG_UB attribute of a communicator.
+     *
+     *  @throw None No throw guarantee.
+     */
+    explicit TagRegistry(tag_type max_tag) noexcept : m_max_tag_(max_tag) {}
+
+    /** @brief Returns the integer tag for @p name.
+     *
+     *  @param[in] name The string tag.
+     *
+     *  @return The integer tag @p name maps to. The same @p name always maps
+     *          to the same integer on every process.
+     *
+     *  @throw std::runtime_error if @p name collides with a previously
+     *                            registered name. Strong throw guarantee.
+     */
+    tag_type tag(const std::string& name);
+
+    /// The number of distinct names registered so far
+    size_type size() const;
+
+private:
+    /// The largest tag which can be handed out
+    tag_type m_max_tag_;
+
+    /// Guards m_tags_ and m_names_
+    mutable std::mutex m_mutex_;
+
+    /// The tag each registered name maps to
+    std::map<std::string, tag_type> m_tags_;
+
+    /// The name each handed out tag belongs to (used to detect collisions)
+    std::map<tag_type, std::string> m_names_;
+};
+
+} // namespace parallelzone::mpi_helpers::detail_
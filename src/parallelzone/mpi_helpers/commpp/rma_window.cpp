@@ -0,0 +1,121 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "detail_/rma_window_pimpl.hpp"
+#include <parallelzone/mpi_helpers/commpp/rma_window.hpp>
+#include <stdexcept>
+
+namespace parallelzone::mpi_helpers {
+
+// -----------------------------------------------------------------------------
+// -- CTors, Assignment, and Dtor
+// -----------------------------------------------------------------------------
+
+RMAWindow::RMAWindow() noexcept = default;
+
+RMAWindow::RMAWindow(pimpl_pointer pimpl) noexcept :
+  m_pimpl_(std::move(pimpl)) {}
+
+RMAWindow::RMAWindow(RMAWindow&& other) noexcept = default;
+
+RMAWindow& RMAWindow::operator=(RMAWindow&& rhs) noexcept = default;
+
+RMAWindow::~RMAWindow() noexcept = default;
+
+// -----------------------------------------------------------------------------
+// -- Getters
+// -----------------------------------------------------------------------------
+
+RMAWindow::mpi_window_type RMAWindow::window() const noexcept {
+    return has_pimpl_() ? m_pimpl_->window() : MPI_WIN_NULL;
+}
+
+RMAWindow::size_type RMAWindow::size() const noexcept {
+    return has_pimpl_() ? m_pimpl_->size() : 0;
+}
+
+std::size_t RMAWindow::region_size(size_type rank) const {
+    return pimpl_().region_size(rank);
+}
+
+RMAWindow::binary_reference RMAWindow::local() const {
+    return pimpl_().local();
+}
+
+// -----------------------------------------------------------------------------
+// -- Synchronization
+// -----------------------------------------------------------------------------
+
+void RMAWindow::lock(size_type rank, lock_type type) const {
+    pimpl_().lock(rank, type);
+}
+
+void RMAWindow::unlock(size_type rank) const { pimpl_().unlock(rank); }
+
+void RMAWindow::lock_all() const { pimpl_().lock_all(); }
+
+void RMAWindow::unlock_all() const { pimpl_().unlock_all(); }
+
+void RMAWindow::flush(size_type rank) const { pimpl_().flush(rank); }
+
+void RMAWindow::flush_all() const { pimpl_().flush_all(); }
+
+void RMAWindow::fence() const { pimpl_().fence(); }
+
+// -----------------------------------------------------------------------------
+// -- Utility
+// -----------------------------------------------------------------------------
+
+void RMAWindow::swap(RMAWindow& other) noexcept {
+    m_pimpl_.swap(other.m_pimpl_);
+}
+
+// -----------------------------------------------------------------------------
+// -- Private Methods
+// -----------------------------------------------------------------------------
+
+bool RMAWindow::has_pimpl_() const noexcept {
+    return static_cast<bool>(m_pimpl_);
+}
+
+const RMAWindow::pimpl_type& RMAWindow::pimpl_() const {
+    if(has_pimpl_()) return *m_pimpl_;
+    throw std::runtime_error("RMAWindow does not have a window");
+}
+
+void RMAWindow::put_(const_binary_reference data, size_type rank,
+                     std::size_t disp) const {
+    pimpl_().put(data, rank, disp);
+}
+
+void RMAWindow::get_(binary_reference out, size_type rank,
+                     std::size_t disp) const {
+    pimpl_().get(out, rank, disp);
+}
+
+void RMAWindow::accumulate_(const void* data, std::size_t n, MPI_Datatype type,
+                            MPI_Op op, size_type rank,
+                            std::size_t disp) const {
+    pimpl_().accumulate(data, n, type, op, rank, disp);
+}
+
+void RMAWindow::fetch_and_op_(const void* value, void* old, MPI_Datatype type,
+                              MPI_Op op, size_type rank,
+                              std::size_t disp) const {
+    pimpl_().fetch_and_op(value, old, type, op, rank, disp);
+}
+
+} // namespace parallelzone::mpi_helpers
@@ -65,6 +65,25 @@ struct ResourceSetPIMPL {
      */
     ResourceSetPIMPL(size_type rank, mpi_comm_type my_mpi, logger_type logger);
 
+    /** @brief Initializes *this with the resources owned by process @p rank on
+     *         MPI communicator @p my_mpi, but routes RAM traffic over
+     *         @p ram_mpi.
+     *
+     *  RuntimeView uses this ctor so that the hardware in its ResourceSets
+     *  communicates over ParallelZone's private duplicate of the user's
+     *  communicator. @p ram_mpi must contain the same processes, with the same
+     *  ranks, as @p my_mpi.
+     *
+     *  @param[in] rank The current process's rank on @p my_mpi
+     *  @param[in] my_mpi The MPI communicator the resource set belongs to.
+     *  @param[in] ram_mpi The MPI communicator the RAM uses for communication.
+     *  @param[in] logger The process-local logger for MPI rank @p rank, as
+     *                    seen by the current process (N.B. the current process
+     *                    may not be rank @p rank).
+     */
+    ResourceSetPIMPL(size_type rank, mpi_comm_type my_mpi,
+                     mpi_comm_type ram_mpi, logger_type logger);
+
     /** @brief Makes a deep copy of *this.
      *
      * This method behaves identical to the copy ctor except that resulting
@@ -161,8 +180,13 @@ inline auto make_resource_set(ResourceSetPIMPL::size_type rank,
 
 inline ResourceSetPIMPL::ResourceSetPIMPL(size_type rank, mpi_comm_type my_mpi,
                                           logger_type logger) :
+  ResourceSetPIMPL(rank, my_mpi, my_mpi, std::move(logger)) {}
+
+inline ResourceSetPIMPL::ResourceSetPIMPL(size_type rank, mpi_comm_type my_mpi,
+                                          mpi_comm_type ram_mpi,
+                                          logger_type logger) :
   m_rank(rank),
-  m_ram(hardware::detail_::make_ram(get_ram_size(), rank, my_mpi)),
+  m_ram(hardware::detail_::make_ram(get_ram_size(), rank, std::move(ram_mpi))),
   m_my_mpi(my_mpi),
   m_plogger(std::make_unique<logger_type>(std::move(logger))) {}
 
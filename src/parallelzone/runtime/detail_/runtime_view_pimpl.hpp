@@ -75,7 +75,8 @@ struct RuntimeViewPIMPL {
      *                             the lifetime of MPI  and false
      *                             otherwise.
      *  @param[in] comm The MPI communicator associated with the instance of the
-     * class.
+     * class. This ctor duplicates @p comm (see m_library_comm) and is thus
+     * collective over @p comm.
      *
      *  @param[in] logger The program-wide logger as seen by the current
      *                    process.
@@ -137,6 +138,15 @@ struct RuntimeViewPIMPL {
     /// The MPI communicator we're built around
     comm_type m_comm;
 
+    /** @brief ParallelZone's private duplicate of m_comm.
+     *
+     *  All communication ParallelZone does on the user's behalf goes through
+     *  this communicator. Since it is a duplicate of m_comm, messages sent on
+     *  it can never match messages the user sends on m_comm. It is also
+     *  persistent, so collectives do not need to re-query the rank and size.
+     */
+    comm_type m_library_comm;
+
     /// Pointer to the logger (pointer to allow logging with const ResourceSets)
     logger_pointer m_plogger;
 
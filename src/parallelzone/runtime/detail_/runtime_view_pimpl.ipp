@@ -35,6 +35,7 @@ inline RuntimeViewPIMPL::RuntimeViewPIMPL(bool did_i_start_mpi, comm_type comm,
                                           logger_type logger) :
   m_did_i_start_mpi(did_i_start_mpi),
   m_comm(comm),
+  m_library_comm(m_comm.duplicate()),
   m_plogger(std::make_shared<logger_type>(std::move(logger))),
   m_resource_sets_() {
     // Pre-populate the current rank's resource set.
@@ -68,14 +69,15 @@ inline bool RuntimeViewPIMPL::operator==(
     return *m_plogger == *rhs.m_plogger;
 }
 
-void RuntimeViewPIMPL::instantiate_resource_set_(size_type rank) const {
+inline void RuntimeViewPIMPL::instantiate_resource_set_(size_type rank) const {
     using rs_pimpl = detail_::ResourceSetPIMPL;
     if(m_resource_sets_.count(rank)) return;
 
     // Null loggers for now
     logger_type logger;
 
-    auto p = std::make_unique<rs_pimpl>(rank, m_comm, std::move(logger));
+    auto p = std::make_unique<rs_pimpl>(rank, m_comm, m_library_comm,
+                                        std::move(logger));
     m_resource_sets_.emplace(rank, ResourceSet(std::move(p)));
 }
 
@@ -0,0 +1,155 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "task_scheduler_pimpl.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace parallelzone::runtime::detail_ {
+namespace {
+
+using size_type  = TaskSchedulerPIMPL::size_type;
+using byte_array = std::vector<std::byte>;
+
+// Outcomes are sent back as records of: the task's index in its owner's
+// queue, a success flag, the number of bytes, and then the bytes themselves
+void append_outcome(byte_array& out, size_type index, bool ok,
+                    const std::byte* p, size_type n) {
+    const std::array<size_type, 3> header{index, size_type(ok), n};
+    const auto* h = reinterpret_cast<const std::byte*>(header.data());
+    out.insert(out.end(), h, h + sizeof(header));
+    out.insert(out.end(), p, p + n);
+}
+
+// Runs handler on args, appending the outcome of task index to out
+void run_task(const TaskSchedulerPIMPL::handler_type& handler,
+              mpi_helpers::ConstBinaryView args, size_type index,
+              byte_array& out) {
+    std::string error;
+    try {
+        auto result = handler(args);
+        append_outcome(out, index, true, result.data(), result.size());
+        return;
+    } catch(const std::exception& e) {
+        error = e.what();
+    } catch(...) { error = "Task threw an exception of unknown type"; }
+    const auto* p = reinterpret_cast<const std::byte*>(error.data());
+    append_outcome(out, index, false, p, error.size());
+}
+
+} // namespace
+
+void TaskSchedulerPIMPL::submit(id_type id, buffer_type args,
+                                completion_type done) {
+    if(id >= m_handlers_.size())
+        throw std::out_of_range("Function " + std::to_string(id) +
+                                " is not registered");
+    m_tasks_.push_back(task_type{id, std::move(args), std::move(done)});
+}
+
+TaskSchedulerPIMPL::run_stats_type TaskSchedulerPIMPL::run() {
+    const auto n_registered = m_rv_.gather(m_handlers_.size());
+    const auto n_handlers   = m_handlers_.size();
+    if(std::any_of(n_registered.begin(), n_registered.end(),
+                   [=](size_type n) { return n != n_handlers; }))
+        throw std::runtime_error("Processes registered different numbers of "
+                                 "functions");
+
+    // Tasks submitted from here on belong to the next call
+    auto tasks = std::move(m_tasks_);
+    m_tasks_.clear();
+
+    const auto me       = m_rv_.my_resource_set().mpi_rank();
+    const auto n_procs  = m_rv_.size();
+    const auto n_queued = m_rv_.gather(tasks.size());
+
+    // Table entry i is the id, first byte, and end byte of task i's arguments
+    std::vector<size_type> table;
+    byte_array args;
+    table.reserve(3 * tasks.size());
+    for(const auto& task : tasks) {
+        table.push_back(task.id);
+        table.push_back(args.size());
+        args.insert(args.end(), task.args.begin(), task.args.end());
+        table.push_back(args.size());
+    }
+
+    auto counter   = m_rv_.allocate_window(sizeof(size_type));
+    auto table_win = m_rv_.expose_window(
+      mpi_helpers::BinaryView(table.data(), table.size()));
+    auto args_win = m_rv_.expose_window(
+      mpi_helpers::BinaryView(args.data(), args.size()));
+    counter.lock_all();
+    table_win.lock_all();
+    args_win.lock_all();
+
+    // Start with our own queue, then steal from the next process, and so on.
+    // Nothing is queued while running, so an empty queue stays empty.
+    run_stats_type stats;
+    std::vector<byte_array> outcomes(n_procs);
+    std::array<size_type, 3> entry;
+    byte_array stolen_args;
+    for(size_type step = 0; step < n_procs; ++step) {
+        const auto owner = (me + step) % n_procs;
+        const int rank   = owner;
+        auto claim       = [&]() {
+            return counter.fetch_and_op(size_type{1}, rank, 0);
+        };
+        for(auto i = claim(); i < n_queued[owner]; i = claim()) {
+            mpi_helpers::ConstBinaryView task_args;
+            if(owner == me) {
+                std::copy_n(table.begin() + 3 * i, 3, entry.begin());
+                task_args = mpi_helpers::ConstBinaryView(
+                  args.data() + entry[1], entry[2] - entry[1]);
+            } else {
+                table_win.get(std::span(entry), rank, 3 * i);
+                table_win.flush(rank);
+                stolen_args.resize(entry[2] - entry[1]);
+                args_win.get(stolen_args, rank, entry[1]);
+                args_win.flush(rank);
+                task_args = mpi_helpers::ConstBinaryView(stolen_args.data(),
+                                                         stolen_args.size());
+                ++stats.n_stolen;
+            }
+            run_task(m_handlers_[entry[0]], task_args, i, outcomes[owner]);
+            ++stats.n_run;
+        }
+    }
+    args_win.unlock_all();
+    table_win.unlock_all();
+    counter.unlock_all();
+
+    // Send the outcomes back to the processes which submitted the tasks
+    auto received = m_rv_.alltoall(outcomes);
+    for(const auto& records : received) {
+        const auto* p   = records.data();
+        const auto* end = p + records.size();
+        while(p < end) {
+            std::array<size_type, 3> header;
+            std::memcpy(header.data(), p, sizeof(header));
+            p += sizeof(header);
+            tasks[header[0]].done(header[1] != 0,
+                                  mpi_helpers::ConstBinaryView(p, header[2]));
+            p += header[2];
+        }
+    }
+    return stats;
+}
+
+} // namespace parallelzone::runtime::detail_
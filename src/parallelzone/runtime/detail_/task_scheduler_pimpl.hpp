@@ -0,0 +1,95 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <parallelzone/runtime/task_scheduler.hpp>
+#include <vector>
+
+namespace parallelzone::runtime::detail_ {
+
+/** @brief Implements the TaskScheduler class.
+ *
+ *  During run() each process exposes three RMA windows: a counter holding
+ *  the index of its next unclaimed task, a table with the function id and
+ *  the extent of the arguments of each task, and the arguments themselves,
+ *  packed back-to-back. Claiming a task is a fetch-and-add on the owner's
+ *  counter, after which the claiming process reads the table entry and the
+ *  arguments (directly if it is the owner, with MPI_Get otherwise).
+ */
+class TaskSchedulerPIMPL {
+public:
+    /// Type of the class *this implements
+    using parent_type = TaskScheduler;
+
+    /// Ultimately a typedef of TaskScheduler::size_type
+    using size_type = parent_type::size_type;
+
+    /// Ultimately a typedef of TaskScheduler::id_type
+    using id_type = parent_type::id_type;
+
+    /// Ultimately a typedef of TaskScheduler::runtime_type
+    using runtime_type = parent_type::runtime_type;
+
+    /// Ultimately a typedef of TaskScheduler::buffer_type
+    using buffer_type = parent_type::buffer_type;
+
+    /// Ultimately a typedef of TaskScheduler::handler_type
+    using handler_type = parent_type::handler_type;
+
+    /// Ultimately a typedef of TaskScheduler::completion_type
+    using completion_type = parent_type::completion_type;
+
+    /// Ultimately a typedef of TaskScheduler::run_stats_type
+    using run_stats_type = parent_type::run_stats_type;
+
+    /// A task queued on this process
+    struct task_type {
+        /// The function to call
+        id_type id;
+
+        /// The serialized arguments
+        buffer_type args;
+
+        /// Receives the outcome
+        completion_type done;
+    };
+
+    /// Creates a scheduler with no functions or tasks, running on @p rv
+    explicit TaskSchedulerPIMPL(runtime_type rv) : m_rv_(std::move(rv)) {}
+
+    /// Registers @p handler, returning its id
+    id_type add_handler(handler_type handler) {
+        m_handlers_.push_back(std::move(handler));
+        return m_handlers_.size() - 1;
+    }
+
+    /// Queues a task, throws std::out_of_range if @p id is not registered
+    void submit(id_type id, buffer_type args, completion_type done);
+
+    /// Runs every queued task, see TaskScheduler::run
+    run_stats_type run();
+
+    /// The registered functions
+    std::vector<handler_type> m_handlers_;
+
+    /// The tasks queued on this process, in submission order
+    std::vector<task_type> m_tasks_;
+
+    /// The processes tasks run on
+    runtime_type m_rv_;
+};
+
+} // namespace parallelzone::runtime::detail_
@@ -16,8 +16,10 @@
 
 #include "detail_/resource_set_pimpl.hpp"
 #include "detail_/runtime_view_pimpl.hpp"
+#include <algorithm>
 #include <mpi.h>
 #include <parallelzone/logging/logger_factory.hpp>
+#include <vector>
 
 // N.B. AFAIK the only way a RuntimeView can have no PIMPL is if an exception is
 //      thrown in the ctor, the user catches the exception, and uses the
@@ -28,6 +30,32 @@ namespace parallelzone::runtime {
 
 namespace {
 
+// The first task of each chunk of a guided schedule, followed by n_tasks. Each
+// chunk gets 1/(2 * n_procs) of the remaining tasks, but at least min_size.
+std::vector<std::size_t> guided_offsets(std::size_t n_tasks,
+                                        std::size_t n_procs,
+                                        std::size_t min_size) {
+    std::vector<std::size_t> offsets{0};
+    const auto n_parts = 2 * n_procs;
+    for(std::size_t begin = 0; begin < n_tasks;) {
+        const auto n_left = n_tasks - begin;
+        const auto n_part = (n_left + n_parts - 1) / n_parts;
+        const auto n      = std::max(min_size, n_part);
+        begin += std::min(n, n_left);
+        offsets.push_back(begin);
+    }
+    return offsets;
+}
+
+// Sums the statistics each process recorded on comm, on every process
+mpi_helpers::CommStats combined_stats(const mpi_helpers::CommPP& comm) {
+    // Take a snapshot first, so the gatherv isn't part of the result
+    auto stats = comm.comm_stats();
+    mpi_helpers::CommStats rv;
+    for(const auto& x : comm.gatherv(std::move(stats))) rv += x;
+    return rv;
+}
+
 // Basically a ternary statement dispatching on whether we need to initialize
 // MPI or not
 auto start_mpi(int argc, char** argv, const MPI_Comm& comm) {
@@ -116,6 +144,94 @@ RuntimeView::logger_reference RuntimeView::logger() const {
     return *pimpl_().m_plogger;
 }
 
+// -----------------------------------------------------------------------------
+// -- One-sided operations
+// -----------------------------------------------------------------------------
+
+mpi_helpers::RMAWindow RuntimeView::allocate_window(std::size_t n_bytes) const {
+    return comm_().allocate_window(n_bytes);
+}
+
+mpi_helpers::RMAWindow RuntimeView::expose_window(
+  mpi_helpers::BinaryView region) const {
+    return comm_().expose_window(region);
+}
+
+// -----------------------------------------------------------------------------
+// -- Dynamic load balancing
+// -----------------------------------------------------------------------------
+
+void RuntimeView::for_each_dynamic(size_type n_tasks, task_function_type fxn,
+                                   schedule_type schedule) const {
+    const auto& comm      = comm_();
+    const auto chunk_size = schedule.chunk_size();
+
+    // Fixed chunks are computed on the fly, guided ones are tabulated
+    std::vector<size_type> offsets;
+    if(schedule.kind() == schedule_type::kind_type::guided)
+        offsets = guided_offsets(n_tasks, size(), chunk_size);
+    const auto n_chunks = offsets.empty() ?
+                            (n_tasks + chunk_size - 1) / chunk_size :
+                            offsets.size() - 1;
+
+    auto run_chunk = [&](size_type i) {
+        const auto begin = offsets.empty() ? i * chunk_size : offsets[i];
+        const auto end   = offsets.empty() ?
+                             std::min(begin + chunk_size, n_tasks) :
+                             offsets[i + 1];
+        for(auto task = begin; task < end; ++task) fxn(task);
+    };
+
+    if(size() == 1) { // Nothing to balance, skip the counter
+        for(size_type i = 0; i < n_chunks; ++i) run_chunk(i);
+        return;
+    }
+
+    // Rank 0 holds the index of the next unclaimed chunk
+    auto counter = comm.allocate_window(comm.me() == 0 ? sizeof(size_type) : 0);
+    counter.lock_all();
+    try {
+        for(auto i = counter.fetch_and_op(size_type{1}, 0, 0); i < n_chunks;
+            i  = counter.fetch_and_op(size_type{1}, 0, 0))
+            run_chunk(i);
+    } catch(...) {
+        counter.unlock_all();
+        throw;
+    }
+    counter.unlock_all();
+}
+
+// -----------------------------------------------------------------------------
+// -- Instrumentation
+// -----------------------------------------------------------------------------
+
+void RuntimeView::set_instrumentation(bool on) {
+    pimpl_().m_library_comm.set_instrumentation(on);
+}
+
+RuntimeView::comm_stats_type RuntimeView::comm_stats() const {
+    return combined_stats(comm_());
+}
+
+void RuntimeView::log_comm_stats_at_finalize() {
+    // N.B. Capturing *this would keep the PIMPL (which runs the callback)
+    //      alive, so capture the pieces instead
+    auto report = [comm = comm_(), plogger = pimpl_().m_plogger]() {
+        const auto stats = combined_stats(comm);
+        plogger->info("Communication statistics:\n" + stats.to_string());
+    };
+    stack_callback(std::move(report));
+}
+
+// -----------------------------------------------------------------------------
+// -- Tuning
+// -----------------------------------------------------------------------------
+
+RuntimeView::tuning_type RuntimeView::tune_collectives(
+  const std::string& path) {
+    return pimpl_().m_library_comm.tune(path);
+}
+
 // -----------------------------------------------------------------------------
 // -- Utility methods
 // -----------------------------------------------------------------------------
@@ -138,8 +254,8 @@ bool RuntimeView::operator==(const RuntimeView& rhs) const {
 // -- Private methods
 // -----------------------------------------------------------------------------
 
-mpi_helpers::CommPP RuntimeView::comm_() const {
-    return mpi_helpers::CommPP(mpi_comm());
+const mpi_helpers::CommPP& RuntimeView::comm_() const {
+    return pimpl_().m_library_comm;
 }
 
 void RuntimeView::not_null_() const {
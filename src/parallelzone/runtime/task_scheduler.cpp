@@ -0,0 +1,72 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "detail_/task_scheduler_pimpl.hpp"
+#include <parallelzone/runtime/task_scheduler.hpp>
+
+namespace parallelzone::runtime {
+
+// -----------------------------------------------------------------------------
+// -- CTors, Assignment, and Dtor
+// -----------------------------------------------------------------------------
+
+TaskScheduler::TaskScheduler(runtime_type rv) :
+  m_pimpl_(std::make_unique<pimpl_type>(std::move(rv))) {}
+
+TaskScheduler::TaskScheduler(TaskScheduler&& other) noexcept = default;
+
+TaskScheduler& TaskScheduler::operator=(TaskScheduler&& rhs) noexcept =
+  default;
+
+TaskScheduler::~TaskScheduler() noexcept = default;
+
+// -----------------------------------------------------------------------------
+// -- Getters
+// -----------------------------------------------------------------------------
+
+TaskScheduler::size_type TaskScheduler::n_registered() const noexcept {
+    return m_pimpl_ ? m_pimpl_->m_handlers_.size() : 0;
+}
+
+TaskScheduler::size_type TaskScheduler::n_pending() const noexcept {
+    return m_pimpl_ ? m_pimpl_->m_tasks_.size() : 0;
+}
+
+// -----------------------------------------------------------------------------
+// -- Running Tasks
+// -----------------------------------------------------------------------------
+
+TaskScheduler::run_stats_type TaskScheduler::run() { return pimpl_().run(); }
+
+// -----------------------------------------------------------------------------
+// -- Private Methods
+// -----------------------------------------------------------------------------
+
+TaskScheduler::id_type TaskScheduler::add_handler_(handler_type handler) {
+    return pimpl_().add_handler(std::move(handler));
+}
+
+void TaskScheduler::submit_(id_type id, buffer_type args,
+                            completion_type done) {
+    pimpl_().submit(id, std::move(args), std::move(done));
+}
+
+TaskScheduler::pimpl_type& TaskScheduler::pimpl_() {
+    if(m_pimpl_) return *m_pimpl_;
+    throw std::runtime_error("TaskScheduler has been moved from");
+}
+
+} // namespace parallelzone::runtime
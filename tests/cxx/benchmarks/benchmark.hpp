@@ -0,0 +1,73 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <string>
+
+/** @file benchmark.hpp
+ *
+ *  Minimal timing utilities shared by the benchmark executables. Each
+ *  executable in this directory is standalone and prints its own report.
+ */
+
+namespace testing {
+
+/// Floating-point type used for reporting times (in seconds)
+using seconds_type = double;
+
+/** @brief Times @p fxn, returning the fastest of @p n_reps runs.
+ *
+ *  @tparam Fxn The type of a nullary callable.
+ *
+ *  @param[in] fxn    The callable to time.
+ *  @param[in] n_reps How many times to run @p fxn.
+ *
+ *  @return The wall time, in seconds, of the fastest run.
+ */
+template<typename Fxn>
+seconds_type time_it(Fxn&& fxn, std::size_t n_reps) {
+    using clock_type = std::chrono::steady_clock;
+    auto best        = std::numeric_limits<seconds_type>::max();
+    for(std::size_t i = 0; i < n_reps; ++i) {
+        auto start = clock_type::now();
+        fxn();
+        std::chrono::duration<seconds_type> dt = clock_type::now() - start;
+        best = std::min(best, dt.count());
+    }
+    return best;
+}
+
+/// Converts @p n_bytes moved in @p t seconds to GB/s
+inline double gb_per_s(std::size_t n_bytes, seconds_type t) {
+    return t > 0 ? double(n_bytes) / t / 1.0e9 : 0.0;
+}
+
+/// Pretty-prints @p n_bytes using binary prefixes
+inline std::string format_bytes(std::size_t n_bytes) {
+    const char* units[] = {"B", "KiB", "MiB", "GiB"};
+    std::size_t i       = 0;
+    while(n_bytes >= 1024 && n_bytes % 1024 == 0 && i < 3) {
+        n_bytes /= 1024;
+        ++i;
+    }
+    return std::to_string(n_bytes) + " " + units[i];
+}
+
+} // namespace testing
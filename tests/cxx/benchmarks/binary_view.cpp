@@ -0,0 +1,73 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark.hpp"
+#include <cstdio>
+#include <parallelzone/mpi_helpers/binary_buffer/binary_buffer.hpp>
+#include <sstream>
+#include <vector>
+
+/* Measures the throughput of deserializing an object out of a ConstBinaryView.
+ *
+ * The object is a std::vector<std::vector<double>> with 1 KiB inner vectors,
+ * so the archive has to make many (moderately sized) reads. For reference, the
+ * "copy" column deserializes the same bytes after first copying them into a
+ * std::stringstream, which is what from_binary_view used to do.
+ */
+
+using namespace parallelzone::mpi_helpers;
+
+namespace {
+
+using object_type = std::vector<std::vector<double>>;
+
+object_type make_object(std::size_t n_bytes) {
+    const std::size_t inner = 1024 / sizeof(double);
+    return object_type(std::max<std::size_t>(n_bytes / 1024, 1),
+                       std::vector<double>(inner, 3.14));
+}
+
+object_type copy_then_deserialize(const ConstBinaryView& view) {
+    std::stringstream ss;
+    ss.write(reinterpret_cast<const char*>(view.data()), view.size());
+    object_type rv;
+    cereal::BinaryInputArchive ar(ss);
+    ar >> rv;
+    return rv;
+}
+
+} // namespace
+
+int main() {
+    std::printf("%12s %14s %14s\n", "size", "view (GB/s)", "copy (GB/s)");
+    for(std::size_t n_bytes = 1024; n_bytes <= (std::size_t(1) << 28);
+        n_bytes *= 4) {
+        auto buffer = make_binary_buffer(make_object(n_bytes));
+        ConstBinaryView view(buffer);
+        const std::size_t n_reps = n_bytes < (1 << 20) ? 100 : 5;
+
+        auto t_view = testing::time_it(
+          [&]() { auto rv = from_binary_view<object_type>(view); }, n_reps);
+        auto t_copy = testing::time_it(
+          [&]() { auto rv = copy_then_deserialize(view); }, n_reps);
+
+        std::printf("%12s %14.3f %14.3f\n",
+                    testing::format_bytes(n_bytes).c_str(),
+                    testing::gb_per_s(view.size(), t_view),
+                    testing::gb_per_s(view.size(), t_copy));
+    }
+    return 0;
+}
@@ -0,0 +1,300 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark.hpp"
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <parallelzone/runtime/runtime_view.hpp>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+/* OSU-style latency and bandwidth sweep of CommPP's collectives.
+ *
+ * For each message size (a power of two from --min-bytes to --max-bytes,
+ * by default 1 B to 1 GiB) each process contributes a message of that many
+ * bytes to gather (to rank 0), gatherv (to rank 0), reduce (to rank 0), and
+ * their all- counterparts. Each is run on three kinds of payloads:
+ *
+ * - "vector": a std::vector<double>, which is sent as-is,
+ * - "string": a std::string, which is also sent as-is, and
+ * - "serialized": a std::vector<std::vector<double>> made of 1 KiB rows,
+ *   which has to go through cereal (and is reduced row by row).
+ *
+ * Payloads which can not be exactly the message size (i.e., doubles for
+ * fewer than 8 bytes) and reductions of strings are skipped. The "MPI"
+ * column times the equivalent raw MPI call on the same number of bytes
+ * (with the counts known up front, so gatherv skips exchanging sizes) and
+ * the overhead is how much slower CommPP is than that. Latencies are the
+ * average time per call on the slowest process (best of three batches).
+ * Bandwidth is the number of bytes the root (gathers) or each process
+ * (reductions) receives per second.
+ *
+ * Sizes whose buffers would not fit in half of this machine's memory (with
+ * every process on the same machine) are skipped, so this can be run with
+ * `mpiexec -n k ./benchmark_commpp` on a workstation. The results are also
+ * written as JSON to --json (default benchmark_commpp.json) by rank 0.
+ */
+
+using namespace parallelzone::mpi_helpers;
+
+namespace {
+
+using size_type   = std::size_t;
+using vector_type = std::vector<double>;
+using object_type = std::vector<vector_type>;
+
+/// The number of doubles in a full row of an object_type
+constexpr size_type row_size = 1024 / sizeof(double);
+
+object_type make_object(size_type n_bytes) {
+    object_type rv;
+    for(auto n = n_bytes / sizeof(double); n > 0;) {
+        const auto m = std::min(n, row_size);
+        rv.emplace_back(m, 1.0);
+        n -= m;
+    }
+    return rv;
+}
+
+vector_type add(const vector_type& lhs, const vector_type& rhs) {
+    auto rv = lhs;
+    for(size_type i = 0; i < rv.size(); ++i) rv[i] += rhs[i];
+    return rv;
+}
+
+/// One row of the report
+struct Result {
+    std::string op;
+    std::string type;
+    size_type n_bytes;
+    double latency;     // seconds per call through CommPP
+    double mpi_latency; // seconds per call through raw MPI
+    size_type n_moved;  // bytes received by the root (or each process)
+};
+
+/// Average time per call of @p fxn, on the slowest process
+template<typename Fxn>
+double time_per_call(MPI_Comm comm, Fxn&& fxn, size_type n_iters) {
+    using clock_type = std::chrono::steady_clock;
+    fxn(); // Warm up
+    double best = std::numeric_limits<double>::max();
+    for(int batch = 0; batch < 3; ++batch) {
+        MPI_Barrier(comm);
+        const auto start = clock_type::now();
+        for(size_type i = 0; i < n_iters; ++i) fxn();
+        std::chrono::duration<double> dt = clock_type::now() - start;
+        best = std::min(best, dt.count() / double(n_iters));
+    }
+    double slowest = 0.0;
+    MPI_Allreduce(&best, &slowest, 1, MPI_DOUBLE, MPI_MAX, comm);
+    return slowest;
+}
+
+/// Parses @p str as a byte count, returning false if it is not a number
+bool parse_bytes(const char* str, size_type& n_bytes) {
+    if(*str < '0' || *str > '9') return false; // strtoull accepts "-1"
+    char* end        = nullptr;
+    errno            = 0;
+    const auto value = std::strtoull(str, &end, 10);
+    if(errno == ERANGE || *end != '\0') return false;
+    n_bytes = value;
+    return true;
+}
+
+/// Bytes of physical memory on this machine
+size_type physical_memory() {
+    return size_type(sysconf(_SC_PHYS_PAGES)) * sysconf(_SC_PAGE_SIZE);
+}
+
+void write_json(const char* path, int n_procs,
+                const std::vector<Result>& results) {
+    auto* file = std::fopen(path, "w");
+    if(!file) {
+        std::fprintf(stderr, "Could not open %s\n", path);
+        return;
+    }
+    std::fprintf(file, "{\n  \"benchmark\": \"commpp\",\n");
+    std::fprintf(file, "  \"n_procs\": %d,\n  \"results\": [", n_procs);
+    for(size_type i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        std::fprintf(file,
+                     "%s\n    {\"op\": \"%s\", \"type\": \"%s\", "
+                     "\"bytes\": %zu, \"latency_us\": %.3f, "
+                     "\"mpi_latency_us\": %.3f, \"bandwidth_gb_s\": %.6f, "
+                     "\"overhead_pct\": %.2f}",
+                     i ? "," : "", r.op.c_str(), r.type.c_str(), r.n_bytes,
+                     r.latency * 1.0e6, r.mpi_latency * 1.0e6,
+                     testing::gb_per_s(r.n_moved, r.latency),
+                     100.0 * (r.latency / r.mpi_latency - 1.0));
+    }
+    std::fprintf(file, "\n  ]\n}\n");
+    std::fclose(file);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    parallelzone::runtime::RuntimeView rv(argc, argv);
+    const auto mpi_comm = rv.mpi_comm();
+    CommPP comm(mpi_comm);
+    const auto me      = comm.me();
+    const auto n_procs = size_type(comm.size());
+
+    size_type min_bytes = 1;
+    size_type max_bytes = size_type(1) << 30;
+    const char* json    = "benchmark_commpp.json";
+    bool valid_args     = true;
+    for(int i = 1; i + 1 < argc; i += 2) {
+        if(!std::strcmp(argv[i], "--min-bytes")) {
+            valid_args = valid_args && parse_bytes(argv[i + 1], min_bytes);
+        } else if(!std::strcmp(argv[i], "--max-bytes")) {
+            valid_args = valid_args && parse_bytes(argv[i + 1], max_bytes);
+        } else if(!std::strcmp(argv[i], "--json")) {
+            json = argv[i + 1];
+        }
+    }
+    // Every process parses the same arguments, so they all bail out together
+    if(!valid_args || min_bytes == 0) {
+        if(me == 0)
+            std::fprintf(stderr,
+                         "Usage: %s [--min-bytes n] [--max-bytes n] "
+                         "[--json path]\n  n must be a positive integer\n",
+                         argv[0]);
+        return 1;
+    }
+
+    // Large raw messages are sent in 1 KiB blocks, so counts fit in an int
+    MPI_Datatype kib;
+    MPI_Type_contiguous(1024, MPI_BYTE, &kib);
+    MPI_Type_commit(&kib);
+
+    // Input, raw result, CommPP result, and serialization copies per process
+    const auto budget = physical_memory() / 2 / n_procs;
+
+    std::vector<Result> results;
+    if(me == 0)
+        std::printf("%d processes\n%-11s %-10s %10s %14s %14s %12s %10s\n",
+                    int(n_procs), "operation", "type", "size", "latency (us)",
+                    "MPI (us)", "bw (GB/s)", "overhead");
+    for(auto n = min_bytes; n <= max_bytes; n *= 2) {
+        if((3 * n_procs + 2) * n > budget) {
+            if(me == 0)
+                std::printf("Skipping %s and up, not enough memory\n",
+                            testing::format_bytes(n).c_str());
+            break;
+        }
+        const auto n_iters = std::clamp<size_type>((1 << 24) / n, 1, 1000);
+        const bool use_kib = n >= 1024;
+        const auto type    = use_kib ? kib : MPI_BYTE;
+        const int count    = use_kib ? n / 1024 : n;
+        const int n_elems  = n / sizeof(double);
+
+        std::vector<std::byte> raw_in(n), raw_out(n * n_procs);
+        std::vector<int> counts(n_procs, count), disp(n_procs);
+        for(size_type r = 0; r < n_procs; ++r) disp[r] = r * count;
+        const auto* in = raw_in.data();
+        auto* out      = raw_out.data();
+        auto* d_in     = reinterpret_cast<const double*>(in);
+        auto* d_out    = reinterpret_cast<double*>(out);
+
+        // The raw MPI equivalent of each operation
+        std::vector<std::pair<std::string, std::function<void()>>> raw{
+          {"gather",
+           [&]() {
+               MPI_Gather(in, count, type, out, count, type, 0, mpi_comm);
+           }},
+          {"allgather",
+           [&]() {
+               MPI_Allgather(in, count, type, out, count, type, mpi_comm);
+           }},
+          {"gatherv",
+           [&]() {
+               MPI_Gatherv(in, count, type, out, counts.data(), disp.data(),
+                           type, 0, mpi_comm);
+           }},
+          {"allgatherv",
+           [&]() {
+               MPI_Allgatherv(in, count, type, out, counts.data(),
+                              disp.data(), type, mpi_comm);
+           }},
+          {"reduce",
+           [&]() {
+               MPI_Reduce(d_in, d_out, n_elems, MPI_DOUBLE, MPI_SUM, 0,
+                          mpi_comm);
+           }},
+          {"allreduce", [&]() {
+               MPI_Allreduce(d_in, d_out, n_elems, MPI_DOUBLE, MPI_SUM,
+                             mpi_comm);
+           }}};
+
+        const bool whole_doubles = n % sizeof(double) == 0;
+        const auto vector        = vector_type(n_elems, 1.0);
+        const auto string        = std::string(n, 'x');
+        const auto object        = make_object(n);
+        const auto plus          = std::plus<double>();
+
+        // The CommPP version of each operation, for each type of payload
+        auto pz_ops = [&](const auto& data) {
+            return std::vector<std::function<void()>>{
+              [&]() { comm.gather(data, 0); }, [&]() { comm.gather(data); },
+              [&]() { comm.gatherv(data, 0); },
+              [&]() { comm.gatherv(data); }};
+        };
+        struct Payload {
+            std::string name;
+            bool valid;
+            std::vector<std::function<void()>> ops;
+        };
+        std::vector<Payload> payloads{{"vector", whole_doubles, pz_ops(vector)},
+                                      {"string", true, pz_ops(string)},
+                                      {"serialized", whole_doubles,
+                                       pz_ops(object)}};
+        payloads[0].ops.push_back([&]() { comm.reduce(vector, plus, 0); });
+        payloads[0].ops.push_back([&]() { comm.reduce(vector, plus); });
+        payloads[2].ops.push_back([&]() { comm.reduce(object, add, 0); });
+        payloads[2].ops.push_back([&]() { comm.reduce(object, add); });
+
+        for(size_type i = 0; i < raw.size(); ++i) {
+            const auto& [op, raw_op] = raw[i];
+            const bool is_reduce     = i >= 4;
+            if(is_reduce && !whole_doubles) continue;
+            const auto t_mpi   = time_per_call(mpi_comm, raw_op, n_iters);
+            const auto n_moved = is_reduce ? n : n * n_procs;
+
+            for(const auto& payload : payloads) {
+                if(!payload.valid || i >= payload.ops.size()) continue;
+                const auto t = time_per_call(mpi_comm, payload.ops[i], n_iters);
+                results.push_back({op, payload.name, n, t, t_mpi, n_moved});
+                if(me != 0) continue;
+                std::printf("%-11s %-10s %10s %14.3f %14.3f %12.4f %9.1f%%\n",
+                            op.c_str(), payload.name.c_str(),
+                            testing::format_bytes(n).c_str(), t * 1.0e6,
+                            t_mpi * 1.0e6, testing::gb_per_s(n_moved, t),
+                            100.0 * (t / t_mpi - 1.0));
+            }
+        }
+        // Doubling n would pass max_bytes (and may overflow), so stop here
+        if(n > max_bytes / 2) break;
+    }
+
+    if(me == 0) write_json(json, int(n_procs), results);
+    MPI_Type_free(&kib);
+    return 0;
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark.hpp"
+#include <cstdio>
+#include <functional>
+#include <parallelzone/runtime/runtime_view.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+/* Compares RuntimeView::for_each_dynamic with static partitioning on a
+ * synthetic, imbalanced workload.
+ *
+ * Task i spins for cost[i] microseconds. The costs ramp up linearly with i
+ * (as they would for, e.g., the rows of a triangular matrix) and are scaled
+ * by a random factor (as they would be for, e.g., integral screening), so
+ * neither contiguous blocks nor round-robin assignment balance the work.
+ * Each row reports the wall time of the slowest process and the efficiency,
+ * i.e., the total work divided by (number of processes * wall time).
+ *
+ * Run with mpirun; with one process there is nothing to balance.
+ */
+
+using namespace parallelzone::runtime;
+
+namespace {
+
+using size_type = RuntimeView::size_type;
+
+std::vector<double> make_costs(size_type n_tasks) {
+    std::mt19937 gen(42);
+    std::exponential_distribution<double> noise(1.0);
+    std::vector<double> costs(n_tasks);
+    for(size_type i = 0; i < n_tasks; ++i)
+        costs[i] = 40.0 * double(i + 1) / double(n_tasks) * noise(gen);
+    return costs;
+}
+
+void spin(double us) {
+    using clock_type = std::chrono::steady_clock;
+    const auto end   = clock_type::now() +
+                     std::chrono::duration<double, std::micro>(us);
+    while(clock_type::now() < end) {}
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    RuntimeView rv(argc, argv);
+    const auto me            = rv.my_resource_set().mpi_rank();
+    const auto n_procs       = rv.size();
+    const size_type n_tasks  = 4000;
+    const std::size_t n_reps = 3;
+
+    const auto costs = make_costs(n_tasks);
+    double total_us  = 0.0;
+    for(auto c : costs) total_us += c;
+    auto run_task = [&](size_type i) { spin(costs[i]); };
+
+    using loop_type = std::function<void()>;
+    std::vector<std::pair<std::string, loop_type>> loops{
+      {"static block",
+       [&]() {
+           const auto begin = me * n_tasks / n_procs;
+           const auto end   = (me + 1) * n_tasks / n_procs;
+           for(auto i = begin; i < end; ++i) run_task(i);
+       }},
+      {"static cyclic",
+       [&]() {
+           for(auto i = me; i < n_tasks; i += n_procs) run_task(i);
+       }},
+      {"dynamic fixed(1)",
+       [&]() { rv.for_each_dynamic(n_tasks, run_task); }},
+      {"dynamic fixed(16)",
+       [&]() {
+           rv.for_each_dynamic(n_tasks, run_task, DynamicSchedule::fixed(16));
+       }},
+      {"dynamic guided(1)",
+       [&]() {
+           rv.for_each_dynamic(n_tasks, run_task, DynamicSchedule::guided());
+       }}};
+
+    if(me == 0)
+        std::printf("%d processes, %zu tasks, %.1f ms of work\n",
+                    int(n_procs), n_tasks, total_us / 1000.0);
+    if(me == 0)
+        std::printf("%20s %12s %12s\n", "schedule", "time (ms)", "efficiency");
+    for(auto& [name, loop] : loops) {
+        auto t = testing::time_it(
+          [&]() {
+              MPI_Barrier(rv.mpi_comm());
+              loop();
+          },
+          n_reps);
+        // The loop is as slow as its slowest process
+        double t_max = 0.0;
+        MPI_Reduce(&t, &t_max, 1, MPI_DOUBLE, MPI_MAX, 0, rv.mpi_comm());
+        if(me == 0)
+            std::printf("%20s %12.3f %12.3f\n", name.c_str(), t_max * 1000.0,
+                        total_us / 1.0e6 / (double(n_procs) * t_max));
+    }
+    return 0;
+}
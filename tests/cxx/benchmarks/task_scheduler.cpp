@@ -0,0 +1,121 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark.hpp"
+#include <cmath>
+#include <cstdio>
+#include <parallelzone/runtime/task_scheduler.hpp>
+#include <random>
+#include <vector>
+
+/* Compares TaskScheduler with static round-robin assignment on tasks whose
+ * costs are skewed.
+ *
+ * Task i is submitted by (and, statically, run on) process i % P. It spins
+ * for a heavy-tailed (Pareto) random number of microseconds, and tasks
+ * submitted by rank 0 are additionally 8x more expensive, so round-robin
+ * leaves rank 0 with most of the work. The tasks return their cost, so the
+ * results have to be shipped back. Each row reports the wall time of the
+ * slowest process, the efficiency (total work / (P * wall time)), and how
+ * many tasks were stolen.
+ *
+ * Run with mpirun; with one process there is nothing to balance.
+ */
+
+using namespace parallelzone::runtime;
+
+namespace {
+
+using size_type = TaskScheduler::size_type;
+
+std::vector<double> make_costs(size_type n_tasks, size_type n_procs) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> u(0.0, 1.0);
+    std::vector<double> costs(n_tasks);
+    for(size_type i = 0; i < n_tasks; ++i) {
+        const double pareto = 1.0 / std::pow(1.0 - u(gen), 1.0 / 1.5);
+        costs[i] = 10.0 * pareto * (i % n_procs == 0 ? 8.0 : 1.0);
+    }
+    return costs;
+}
+
+double spin(double us) {
+    using clock_type = std::chrono::steady_clock;
+    const auto end   = clock_type::now() +
+                     std::chrono::duration<double, std::micro>(us);
+    while(clock_type::now() < end) {}
+    return us;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    RuntimeView rv(argc, argv);
+    const auto me            = rv.my_resource_set().mpi_rank();
+    const auto n_procs       = rv.size();
+    const size_type n_tasks  = 2000;
+    const std::size_t n_reps = 3;
+
+    const auto costs = make_costs(n_tasks, n_procs);
+    double total_us  = 0.0;
+    for(auto c : costs) total_us += c;
+
+    TaskScheduler scheduler(rv);
+    auto task = scheduler.register_task([](double us) { return spin(us); });
+
+    auto round_robin = [&]() {
+        double sum = 0.0;
+        for(auto i = me; i < n_tasks; i += n_procs) sum += spin(costs[i]);
+        return sum;
+    };
+
+    size_type n_stolen = 0;
+    auto scheduled = [&]() {
+        std::vector<std::future<double>> results;
+        for(auto i = me; i < n_tasks; i += n_procs)
+            results.push_back(scheduler.submit(task, costs[i]));
+        n_stolen = scheduler.run().n_stolen;
+        double sum = 0.0;
+        for(auto& r : results) sum += r.get();
+        return sum;
+    };
+
+    if(me == 0) {
+        std::printf("%d processes, %zu tasks, %.1f ms of work\n",
+                    int(n_procs), n_tasks, total_us / 1000.0);
+        std::printf("%20s %12s %12s %10s\n", "schedule", "time (ms)",
+                    "efficiency", "stolen");
+    }
+    auto report = [&](const char* name, auto&& loop, const size_type& stolen) {
+        auto t = testing::time_it(
+          [&]() {
+              MPI_Barrier(rv.mpi_comm());
+              loop();
+          },
+          n_reps);
+        // The loop is as slow as its slowest process
+        double t_max = 0.0;
+        MPI_Reduce(&t, &t_max, 1, MPI_DOUBLE, MPI_MAX, 0, rv.mpi_comm());
+        const auto n = rv.reduce(stolen, std::plus<size_type>());
+        if(me == 0)
+            std::printf("%20s %12.3f %12.3f %10zu\n", name, t_max * 1000.0,
+                        total_us / 1.0e6 / (double(n_procs) * t_max), n);
+    };
+    const size_type none = 0;
+    report("static round-robin", round_robin, none);
+    report("TaskScheduler", scheduled, n_stolen);
+    return 0;
+}
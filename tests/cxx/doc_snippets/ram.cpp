@@ -59,4 +59,16 @@ TEST_CASE("ram") {
     }
     REQUIRE(rank_0_total >= 0);
     REQUIRE(my_total_ram >= 0);
+
+    // Every process exposes room for one counter
+    auto window = rv.allocate_window(sizeof(std::size_t));
+
+    // Add one to rank 0's counter, rank 0 does not have to do anything
+    rank_0_ram.accumulate(window, std::vector<std::size_t>{1}, 0);
+
+    MPI_Barrier(rv.mpi_comm()); // Wait for everyone to add one
+    std::vector<std::size_t> count(1);
+    rank_0_ram.get(window, count, 0);
+
+    REQUIRE(count[0] == rv.size());
 }
@@ -48,6 +48,24 @@ TEST_CASE("runtime_view") {
     auto debug_s = parallelzone::Logger::severity::debug;
     for(const auto& x : results) rv.logger().log(debug_s, std::to_string(x));
 
+    // Square 100 numbers, with processes claiming 4 at a time as they go
+    std::vector<std::size_t> squares(100, 0);
+    auto square = [&](std::size_t i) { squares[i] = i * i; };
+    using parallelzone::runtime::DynamicSchedule;
+    rv.for_each_dynamic(100, square, DynamicSchedule::fixed(4));
+
+    // Each square was computed on exactly one process, so add them up
+    squares = rv.reduce(squares, std::plus<std::size_t>());
+
+    // Record statistics about the communication done while gathering again
+    rv.set_instrumentation(true);
+    auto gathered_again = rv.gather(local_data);
+    rv.set_instrumentation(false);
+
+    // Combine the statistics of every process and log them as a table
+    auto stats = rv.comm_stats();
+    rv.logger() << stats.to_string();
+
     // -------------------------------------------------------------------------
     // Examples stop here and correctness test start
     // -------------------------------------------------------------------------
@@ -59,4 +77,12 @@ TEST_CASE("runtime_view") {
     for(std::size_t i = 0; i < rv.size(); ++i)
         for(std::size_t j = 0; j < 3; ++j) corr.push_back(i + j);
     REQUIRE(results == corr);
+
+    // This checks that every square was computed
+    for(std::size_t i = 0; i < squares.size(); ++i)
+        REQUIRE(squares[i] == i * i);
+
+    // This checks that each process's gather was recorded
+    REQUIRE(gathered_again == results);
+    REQUIRE(stats.ops.at("allgather").n_calls == rv.size());
 }
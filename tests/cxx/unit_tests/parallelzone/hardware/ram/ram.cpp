@@ -125,6 +125,100 @@ TEST_CASE("RAM") {
         }
     }
 
+    SECTION("igather") {
+        using data_type = std::vector<std::string>;
+        data_type local_data(3, "Hello");
+        auto rv = run.at(0).ram().igather(local_data).get();
+        if(run.at(0).is_mine()) {
+            std::vector<data_type> corr(run.size(), local_data);
+            REQUIRE(rv.has_value());
+            REQUIRE(*rv == corr);
+        } else {
+            REQUIRE_FALSE(rv.has_value());
+        }
+    }
+
+    SECTION("ireduce") {
+        using data_type = std::vector<double>;
+        data_type local_data(3, 1.0);
+        auto op = std::plus<double>();
+        auto rv = run.at(0).ram().ireduce(local_data, op).get();
+
+        if(run.at(0).is_mine()) {
+            data_type corr(3, run.size());
+            REQUIRE(rv.has_value());
+            REQUIRE(*rv == corr);
+        } else {
+            REQUIRE_FALSE(rv.has_value());
+        }
+    }
+
+    SECTION("broadcast") {
+        using data_type = std::vector<std::string>;
+        data_type corr(3, "Hello");
+        data_type local_data;
+        if(run.at(0).is_mine()) local_data = corr;
+        REQUIRE(run.at(0).ram().broadcast(local_data) == corr);
+    }
+
+    SECTION("scatter") {
+        std::vector<std::string> local_data;
+        if(run.at(0).is_mine()) local_data.resize(run.size(), "Hello");
+        REQUIRE(run.at(0).ram().scatter(local_data) == "Hello");
+    }
+
+    SECTION("scatterv") {
+        std::vector<double> local_data;
+        if(run.at(0).is_mine()) local_data.resize(run.size(), 1.0);
+        auto rv = run.at(0).ram().scatterv(local_data);
+        REQUIRE(rv == std::vector<double>{1.0});
+    }
+
+    SECTION("send/recv") {
+        // Each resource set sends its rank to the next one
+        using data_type = std::vector<std::string>;
+        const auto me   = run.my_resource_set().mpi_rank();
+        const auto next = (me + 1) % run.size();
+        const auto prev = (me + run.size() - 1) % run.size();
+        data_type corr(prev + 1, std::to_string(prev));
+
+        auto f = run.at(next).ram().isend(data_type(me + 1, std::to_string(me)),
+                                          "ring");
+        REQUIRE(run.at(prev).ram().recv<data_type>("ring") == corr);
+        f.get();
+
+        auto r = run.at(prev).ram().irecv<std::vector<double>>("ring");
+        auto s = run.at(next).ram().isend(std::vector<double>(me + 1, me),
+                                          "ring");
+        REQUIRE(r.get() == std::vector<double>(prev + 1, prev));
+        s.get();
+    }
+
+    SECTION("put/get/accumulate") {
+        // Each resource set writes to, then reads from, the next one
+        const auto me   = run.my_resource_set().mpi_rank();
+        const auto next = (me + 1) % run.size();
+        const auto prev = (me + run.size() - 1) % run.size();
+        const auto& next_ram = run.at(next).ram();
+
+        auto window = run.allocate_window(3 * sizeof(int));
+        next_ram.put(window, std::vector<int>{int(me), int(me)}, 1);
+        next_ram.accumulate(window, std::vector<int>{1}, 0);
+        run.at(0).ram().accumulate(window, std::vector<int>{1}, 0);
+        MPI_Barrier(run.mpi_comm());
+
+        std::vector<int> out(3);
+        next_ram.get(window, out, 0);
+        const int n_adds = next == 0 ? run.size() + 1 : 1;
+        REQUIRE(out == std::vector<int>{n_adds, int(me), int(me)});
+
+        auto local = window.local_as<int>();
+        REQUIRE(local[1] == int(prev));
+        REQUIRE_THROWS_AS(next_ram.put(window, out, 1), std::out_of_range);
+        REQUIRE_THROWS_AS(defaulted.put(window, out, 0), std::runtime_error);
+        MPI_Barrier(run.mpi_comm());
+    }
+
     SECTION("empty") {
         REQUIRE(defaulted.empty());
         REQUIRE_FALSE(has_value.empty());
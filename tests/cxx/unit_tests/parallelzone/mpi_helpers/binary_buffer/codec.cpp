@@ -0,0 +1,129 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../catch.hpp"
+#include <parallelzone/mpi_helpers/binary_buffer/codec.hpp>
+#include <stdexcept>
+#include <vector>
+
+/* Testing Strategy:
+ *
+ * Codec is an interface, so we test it through ZeroRunCodec. For each input
+ * we make sure the compressed form decompresses to the input, and, for
+ * inputs with long zero runs, that the compressed form is smaller. We also
+ * make sure malformed input is detected rather than overflowing the output.
+ */
+
+using namespace parallelzone::mpi_helpers;
+
+namespace {
+
+using buffer_type = Codec::buffer_type;
+
+// Compresses, then decompresses, @p data with @p codec
+buffer_type round_trip(const Codec& codec, const buffer_type& data,
+                       buffer_type& compressed) {
+    codec.compress(ConstBinaryView(data.data(), data.size()), compressed);
+    buffer_type rv(data.size());
+    codec.decompress(ConstBinaryView(compressed.data(), compressed.size()),
+                     BinaryView(rv.data(), rv.size()));
+    return rv;
+}
+
+} // namespace
+
+TEST_CASE("ZeroRunCodec") {
+    ZeroRunCodec codec;
+    const Codec& base = codec;
+    buffer_type compressed;
+
+    SECTION("CTor") {
+        REQUIRE(codec.min_run() == 8);
+        REQUIRE(ZeroRunCodec(3).min_run() == 3);
+        REQUIRE(ZeroRunCodec(0).min_run() == 1);
+    }
+
+    SECTION("name") { REQUIRE(base.name() == "zero-run"); }
+
+    SECTION("empty") {
+        buffer_type data;
+        REQUIRE(round_trip(base, data, compressed) == data);
+        REQUIRE(compressed.empty());
+    }
+
+    SECTION("no zeros") {
+        buffer_type data(100, std::byte{42});
+        REQUIRE(round_trip(base, data, compressed) == data);
+        REQUIRE(compressed.size() == data.size() + 2);
+    }
+
+    SECTION("all zeros") {
+        buffer_type data(1000, std::byte{0});
+        REQUIRE(round_trip(base, data, compressed) == data);
+        REQUIRE(compressed.size() == 3);
+    }
+
+    SECTION("sparse") {
+        buffer_type data(10000, std::byte{0});
+        for(std::size_t i = 0; i < data.size(); i += 97) data[i] = std::byte(i);
+        REQUIRE(round_trip(base, data, compressed) == data);
+        REQUIRE(compressed.size() < data.size() / 10);
+    }
+
+    SECTION("short runs stay literal") {
+        buffer_type data{std::byte{1}, std::byte{0}, std::byte{0},
+                         std::byte{2}, std::byte{0}};
+        REQUIRE(round_trip(base, data, compressed) == data);
+        // One record: literal length, 4 literal bytes, run length of 1
+        REQUIRE(compressed.size() == 6);
+    }
+
+    SECTION("appends") {
+        buffer_type data(64, std::byte{0});
+        compressed.assign(3, std::byte{7});
+        base.compress(ConstBinaryView(data.data(), data.size()), compressed);
+        REQUIRE(compressed.size() == 5);
+        REQUIRE(compressed[0] == std::byte{7});
+    }
+
+    SECTION("malformed") {
+        buffer_type data(64, std::byte{0});
+        base.compress(ConstBinaryView(data.data(), data.size()), compressed);
+        ConstBinaryView view(compressed.data(), compressed.size());
+
+        buffer_type too_small(10), too_big(100);
+        REQUIRE_THROWS_AS(
+          base.decompress(view, BinaryView(too_small.data(), 10)),
+          std::runtime_error);
+        REQUIRE_THROWS_AS(
+          base.decompress(view, BinaryView(too_big.data(), 100)),
+          std::runtime_error);
+
+        buffer_type truncated{std::byte{0x80}};
+        REQUIRE_THROWS_AS(
+          base.decompress(ConstBinaryView(truncated.data(), 1),
+                          BinaryView(too_small.data(), 10)),
+          std::runtime_error);
+    }
+}
+
+TEST_CASE("CompressionStats") {
+    CompressionStats stats;
+    REQUIRE(stats.ratio() == 1.0);
+    stats.bytes_in  = 100;
+    stats.bytes_out = 25;
+    REQUIRE(stats.ratio() == 4.0);
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../catch.hpp"
+#include <istream>
+#include <ostream>
+#include <parallelzone/mpi_helpers/binary_buffer/detail_/binary_streambuf.hpp>
+#include <string>
+
+/* Testing Strategy:
+ *
+ * The stream buffers are only ever used through a std::istream/std::ostream,
+ * so we test them by wrapping them in one. For InputBinaryStreambuf we make
+ * sure reads, bulk reads, and seeks see the aliased bytes. For the output
+ * buffers we make sure that what was written (or counted) is what we get back.
+ */
+
+using namespace parallelzone::mpi_helpers::detail_;
+
+TEST_CASE("InputBinaryStreambuf") {
+    std::string data("Hello World");
+    auto p = reinterpret_cast<const std::byte*>(data.data());
+
+    SECTION("Empty") {
+        InputBinaryStreambuf buffer(nullptr, 0);
+        std::istream is(&buffer);
+        char c;
+        REQUIRE_FALSE(is.read(&c, 1));
+        REQUIRE(is.gcount() == 0);
+    }
+
+    SECTION("Aliases the bytes") {
+        InputBinaryStreambuf buffer(p, data.size());
+        std::istream is(&buffer);
+        REQUIRE(is.rdbuf()->sgetc() == 'H');
+        REQUIRE(is.rdbuf()->in_avail() == std::streamsize(data.size()));
+    }
+
+    SECTION("Bulk read") {
+        InputBinaryStreambuf buffer(p, data.size());
+        std::istream is(&buffer);
+        std::string out(5, ' ');
+        REQUIRE(is.rdbuf()->sgetn(out.data(), 5) == 5);
+        REQUIRE(out == "Hello");
+        REQUIRE(is.rdbuf()->in_avail() == std::streamsize(data.size() - 5));
+    }
+
+    SECTION("Read past the end") {
+        InputBinaryStreambuf buffer(p, data.size());
+        std::istream is(&buffer);
+        std::string out(20, ' ');
+        REQUIRE(is.rdbuf()->sgetn(out.data(), 20) == 11);
+        REQUIRE(out.substr(0, 11) == data);
+        REQUIRE(is.rdbuf()->sgetn(out.data(), 1) == 0);
+    }
+
+    SECTION("Seeking") {
+        InputBinaryStreambuf buffer(p, data.size());
+        std::istream is(&buffer);
+        is.seekg(6);
+        std::string out(5, ' ');
+        is.read(out.data(), 5);
+        REQUIRE(out == "World");
+
+        is.seekg(-5, std::ios_base::end);
+        REQUIRE(is.tellg() == 6);
+        is.seekg(-6, std::ios_base::cur);
+        REQUIRE(is.tellg() == 0);
+
+        is.seekg(100);
+        REQUIRE(is.fail());
+    }
+}
+
+TEST_CASE("OutputBinaryStreambuf") {
+    using buffer_type = OutputBinaryStreambuf::buffer_type;
+    std::string data("Hello World");
+
+    SECTION("Empty") {
+        OutputBinaryStreambuf buffer;
+        REQUIRE(buffer.size() == 0);
+        REQUIRE(buffer.release() == buffer_type{});
+    }
+
+    SECTION("Pre-sized") {
+        OutputBinaryStreambuf buffer(data.size());
+        std::ostream os(&buffer);
+        REQUIRE(os.rdbuf()->sputn(data.data(), 5) == 5);
+        REQUIRE(os.rdbuf()->sputn(data.data() + 5, 6) == 6);
+        REQUIRE(buffer.size() == data.size());
+        auto rv = buffer.release();
+        REQUIRE(rv.size() == data.size());
+        REQUIRE(std::string(reinterpret_cast<const char*>(rv.data()),
+                            rv.size()) == data);
+        REQUIRE(buffer.size() == 0);
+    }
+
+    SECTION("Grows") {
+        OutputBinaryStreambuf buffer(1);
+        std::ostream os(&buffer);
+        for(std::size_t i = 0; i < 100; ++i) os << data;
+        os.put('!');
+        REQUIRE(buffer.size() == 100 * data.size() + 1);
+        auto rv = buffer.release();
+        REQUIRE(rv.size() == 100 * data.size() + 1);
+        REQUIRE(rv.back() == std::byte{'!'});
+    }
+}
+
+TEST_CASE("CountingBinaryStreambuf") {
+    CountingBinaryStreambuf buffer;
+    REQUIRE(buffer.size() == 0);
+
+    std::ostream os(&buffer);
+    std::string data("Hello World");
+    os.rdbuf()->sputn(data.data(), data.size());
+    os.put('!');
+    REQUIRE(buffer.size() == data.size() + 1);
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../test_parallelzone.hpp"
+#include <parallelzone/mpi_helpers/commpp/commpp.hpp>
+#include <string>
+#include <vector>
+
+/* Testing Strategy:
+ *
+ * Messages are sent around a ring (each process to the next one) so that,
+ * with more than one process, they go to another process. fence() is what
+ * guarantees delivery, so the effects of the handlers are checked after it.
+ */
+
+using namespace parallelzone::mpi_helpers;
+
+TEST_CASE("ActiveMessenger") {
+    using size_type = ActiveMessenger::size_type;
+
+    auto& world = testing::PZEnvironment::comm_world();
+    CommPP comm(world.mpi_comm());
+    const size_type me      = comm.me();
+    const size_type n_ranks = comm.size();
+    const size_type next    = (me + 1) % n_ranks;
+    const size_type prev    = (me + n_ranks - 1) % n_ranks;
+
+    ActiveMessenger am(comm);
+
+    std::vector<size_type> senders;
+    auto record = am.register_handler(
+      [&](size_type from) { senders.push_back(from); });
+
+    std::string text;
+    auto append = am.register_handler([&](const std::string& s, int n) {
+        for(int i = 0; i < n; ++i) text += s;
+    });
+
+    // Bounces back to the sender until hops runs out
+    std::size_t n_pings = 0;
+    AMHandle<size_type> ping(0);
+    ping = am.register_handler([&](size_type hops) {
+        ++n_pings;
+        if(hops > 0) am.send(ping, am.source(), hops - 1);
+    });
+
+    std::vector<size_type> sources;
+    auto who = am.register_handler(
+      [&](int) { sources.push_back(am.source()); });
+
+    SECTION("CTor") {
+        REQUIRE(am.batch_size() == ActiveMessenger::default_batch_size);
+        REQUIRE(am.source() == MPI_PROC_NULL);
+        REQUIRE(am.stats().n_sent == 0);
+        REQUIRE_THROWS_AS(ActiveMessenger(CommPP{}), std::runtime_error);
+    }
+
+    SECTION("register_handler") {
+        REQUIRE(record.id() == 0);
+        REQUIRE(append.id() == 1);
+        REQUIRE(ping.id() == 2);
+        REQUIRE(who.id() == 3);
+    }
+
+    SECTION("send") {
+        am.send(record, next, me);
+        am.send(append, next, "ab", 2);
+        am.send(append, next, "c", 1);
+        am.fence();
+        REQUIRE(senders == std::vector<size_type>{prev});
+        REQUIRE(text == "ababc"); // Same order as sent
+
+        am.send(who, next, 0);
+        am.fence();
+        REQUIRE(sources == std::vector<size_type>{prev});
+
+        REQUIRE_THROWS_AS(am.send(record, n_ranks, me), std::out_of_range);
+        REQUIRE_THROWS_AS(am.send(AMHandle<size_type>(42), next, me),
+                          std::out_of_range);
+    }
+
+    SECTION("Batching") {
+        for(size_type i = 0; i < 10; ++i) am.send(record, next, me);
+        am.fence();
+        REQUIRE(senders == std::vector<size_type>(10, prev));
+        REQUIRE(am.stats().n_sent == 10);
+        REQUIRE(am.stats().n_batches == 1);
+        REQUIRE(am.stats().n_handled == 10);
+
+        ActiveMessenger unbatched(comm, 0);
+        auto h = unbatched.register_handler([](size_type) {});
+        for(size_type i = 0; i < 10; ++i) unbatched.send(h, next, me);
+        unbatched.fence();
+        REQUIRE(unbatched.stats().n_batches == 10);
+    }
+
+    SECTION("Handlers which send") {
+        am.send(ping, next, size_type{3});
+        am.fence();
+        // Each process handles hops 3 and 1 of the previous process's ping,
+        // and hops 2 and 0 of its own
+        REQUIRE(n_pings == 4);
+    }
+
+    SECTION("poll") {
+        ActiveMessenger unbatched(comm, 0);
+        std::size_t n = 0;
+        auto h = unbatched.register_handler([&](size_type) { ++n; });
+        unbatched.send(h, me, me);
+        std::size_t n_polled = 0;
+        while(n_polled == 0) n_polled = unbatched.poll();
+        REQUIRE(n_polled == 1);
+        REQUIRE(n == 1);
+        unbatched.fence();
+    }
+
+    SECTION("fence with no messages") {
+        am.fence();
+        REQUIRE(am.stats().n_handled == 0);
+    }
+
+    SECTION("move") {
+        ActiveMessenger moved(std::move(am));
+        moved.send(record, next, me);
+        moved.fence();
+        REQUIRE(senders == std::vector<size_type>{prev});
+        REQUIRE_THROWS_AS(am.poll(), std::runtime_error);
+    }
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../catch.hpp"
+#include <filesystem>
+#include <mpi.h>
+#include <parallelzone/mpi_helpers/commpp/collective_tuning.hpp>
+
+/* Testing Strategy:
+ *
+ * CollectiveTuning is an aggregate of thresholds plus a text format, so we
+ * check the defaults, when automatic all gathervs go eager, that the text
+ * format round trips (including thresholds which are never reached), that
+ * it tolerates comments, blank lines, and unknown keys, that malformed
+ * values are rejected, and that it can be saved and loaded. Each process
+ * uses its own file.
+ */
+
+using namespace parallelzone::mpi_helpers;
+
+TEST_CASE("CollectiveTuning") {
+    using tuning_type = CollectiveTuning;
+    tuning_type defaulted;
+
+    tuning_type tuning;
+    tuning.eager_threshold        = 512;
+    tuning.ring_threshold         = 1048576;
+    tuning.hierarchical_threshold = tuning_type::never;
+    tuning.compress               = false;
+    tuning.n_procs                = 4;
+    tuning.n_nodes                = 2;
+
+    SECTION("Defaults") {
+        REQUIRE(defaulted.eager_threshold == 0);
+        REQUIRE(defaulted.ring_threshold == tuning_type::never);
+        REQUIRE(defaulted.hierarchical_threshold == tuning_type::never);
+        REQUIRE(defaulted.compress);
+        REQUIRE(defaulted.n_procs == 0);
+        REQUIRE(defaulted.n_nodes == 0);
+    }
+
+    SECTION("matches") {
+        REQUIRE(tuning.matches(4, 2));
+        REQUIRE_FALSE(tuning.matches(4, 1));
+        REQUIRE_FALSE(tuning.matches(3, 2));
+    }
+
+    SECTION("goes_eager") {
+        REQUIRE_FALSE(defaulted.goes_eager(1));
+        REQUIRE(tuning.goes_eager(4));
+
+        // 128 processes' slots take 128 * (8 + 512) bytes, more than 64 KiB
+        REQUIRE(tuning.goes_eager(120));
+        REQUIRE_FALSE(tuning.goes_eager(128));
+
+        tuning.eager_threshold = tuning_type::never;
+        REQUIRE_FALSE(tuning.goes_eager(1));
+    }
+
+    SECTION("operator==") {
+        REQUIRE(defaulted == tuning_type{});
+        REQUIRE_FALSE(defaulted == tuning);
+    }
+
+    SECTION("to_string/from_string") {
+        const auto text = tuning.to_string();
+        REQUIRE(text.find("hierarchical_threshold never") != text.npos);
+        REQUIRE(tuning_type::from_string(text) == tuning);
+        REQUIRE(tuning_type::from_string(defaulted.to_string()) == defaulted);
+        REQUIRE(tuning_type::from_string("") == defaulted);
+    }
+
+    SECTION("from_string is lenient") {
+        auto rv = tuning_type::from_string("# comment\n\n"
+                                           "ring_threshold 64 # trailing\n"
+                                           "some_new_key 1\n");
+        REQUIRE(rv.ring_threshold == 64);
+        rv.ring_threshold = tuning_type::never;
+        REQUIRE(rv == defaulted);
+    }
+
+    SECTION("from_string rejects bad values") {
+        using error_t = std::runtime_error;
+        REQUIRE_THROWS_AS(tuning_type::from_string("ring_threshold"), error_t);
+        REQUIRE_THROWS_AS(tuning_type::from_string("ring_threshold x"),
+                          error_t);
+        REQUIRE_THROWS_AS(tuning_type::from_string("ring_threshold 12x"),
+                          error_t);
+        REQUIRE_THROWS_AS(tuning_type::from_string("ring_threshold -1"),
+                          error_t);
+        REQUIRE_THROWS_AS(tuning_type::from_string("compress 2"), error_t);
+    }
+
+    SECTION("save/load") {
+        int me = 0;
+        MPI_Comm_rank(MPI_COMM_WORLD, &me);
+        const auto name = "pz_tuning_test_" + std::to_string(me) + ".txt";
+        const auto path = std::filesystem::temp_directory_path() / name;
+        std::filesystem::remove(path);
+        REQUIRE_THROWS_AS(tuning_type::load(path), std::runtime_error);
+
+        tuning.save(path);
+        REQUIRE(tuning_type::load(path) == tuning);
+        std::filesystem::remove(path);
+
+        const auto bad_path = (path / "not_a_directory").string();
+        REQUIRE_THROWS_AS(tuning.save(bad_path), std::runtime_error);
+    }
+}
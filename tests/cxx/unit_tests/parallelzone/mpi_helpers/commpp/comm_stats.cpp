@@ -0,0 +1,123 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../catch.hpp"
+#include <parallelzone/mpi_helpers/commpp/comm_stats.hpp>
+#include <parallelzone/serialization.hpp>
+#include <sstream>
+
+/* Testing Strategy:
+ *
+ * OpStats and CommStats are aggregates of counters, so we check the binning,
+ * that sums are taken member by member (and operation by operation), that
+ * the report mentions each operation, and that they survive serialization
+ * (which is how they are combined across processes).
+ */
+
+using namespace parallelzone::mpi_helpers;
+using namespace std::chrono_literals;
+
+TEST_CASE("OpStats") {
+    OpStats stats;
+    REQUIRE(stats.n_calls == 0);
+
+    SECTION("bin") {
+        REQUIRE(OpStats::bin(0us) == 0);
+        REQUIRE(OpStats::bin(500ns) == 0);
+        REQUIRE(OpStats::bin(1us) == 1);
+        REQUIRE(OpStats::bin(3us) == 2);
+        REQUIRE(OpStats::bin(4us) == 3);
+        REQUIRE(OpStats::bin(1000h) == OpStats::n_bins - 1);
+    }
+
+    SECTION("add_call") {
+        stats.add_call(1, 2, 3us);
+        REQUIRE(stats.n_calls == 1);
+        REQUIRE(stats.bytes_sent == 1);
+        REQUIRE(stats.bytes_received == 2);
+        REQUIRE(stats.mpi_time == 3us);
+        REQUIRE(stats.latency[2] == 1);
+
+        // Nonblocking calls are counted, but are not in the histogram
+        stats.add_call(1, 2, 3us, false);
+        REQUIRE(stats.n_calls == 2);
+        REQUIRE(stats.mpi_time == 6us);
+        REQUIRE(stats.latency[2] == 1);
+    }
+
+    SECTION("operator+=") {
+        stats.add_call(1, 2, 3us);
+        OpStats other;
+        other.add_call(4, 5, 6us);
+        other.serialization_time = 7us;
+        stats += other;
+        REQUIRE(stats.n_calls == 2);
+        REQUIRE(stats.bytes_sent == 5);
+        REQUIRE(stats.bytes_received == 7);
+        REQUIRE(stats.mpi_time == 9us);
+        REQUIRE(stats.serialization_time == 7us);
+        REQUIRE(stats.latency[2] == 1);
+        REQUIRE(stats.latency[3] == 1);
+    }
+}
+
+TEST_CASE("CommStats") {
+    CommStats stats;
+    stats.ops["gather"].add_call(1, 2, 3us);
+    stats.ops["send"].add_call(4, 0, 5us);
+
+    SECTION("total") {
+        const auto total = stats.total();
+        REQUIRE(total.n_calls == 2);
+        REQUIRE(total.bytes_sent == 5);
+        REQUIRE(total.mpi_time == 8us);
+    }
+
+    SECTION("operator+=") {
+        CommStats other;
+        other.ops["gather"].add_call(1, 2, 3us);
+        other.ops["recv"].add_call(0, 4, 5us);
+        stats += other;
+        REQUIRE(stats.ops.size() == 3);
+        REQUIRE(stats.ops.at("gather").n_calls == 2);
+        REQUIRE(stats.ops.at("recv").bytes_received == 4);
+    }
+
+    SECTION("to_string") {
+        const auto report = stats.to_string();
+        REQUIRE(report.find("gather") != std::string::npos);
+        REQUIRE(report.find("send") != std::string::npos);
+        REQUIRE(report.find("[2, 4): 1") != std::string::npos);
+    }
+
+    SECTION("serialization") {
+        std::stringstream ss;
+        {
+            cereal::BinaryOutputArchive ar(ss);
+            ar(stats);
+        }
+        CommStats copy;
+        {
+            cereal::BinaryInputArchive ar(ss);
+            ar(copy);
+        }
+        REQUIRE(copy.ops.size() == 2);
+        REQUIRE(copy.ops.at("send").bytes_sent == 4);
+        REQUIRE(copy.ops.at("send").mpi_time == 5us);
+        const auto& gather = stats.ops.at("gather");
+        REQUIRE(copy.ops.at("gather").latency == gather.latency);
+    }
+}
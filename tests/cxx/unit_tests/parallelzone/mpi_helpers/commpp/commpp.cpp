@@ -15,9 +15,28 @@
  */
 
 #include "../../test_parallelzone.hpp"
+#include "../traits/test_traits.hpp"
+#include <limits>
+#include <map>
 #include <numeric>
 #include <parallelzone/mpi_helpers/commpp/commpp.hpp>
 
+namespace {
+// A user struct with an MPI data type
+struct IdxVal {
+    int idx;
+    double val;
+    bool operator==(const IdxVal& rhs) const {
+        return idx == rhs.idx && val == rhs.val;
+    }
+    IdxVal operator+(const IdxVal& rhs) const {
+        return {idx + rhs.idx, val + rhs.val};
+    }
+};
+} // namespace
+
+PZ_REGISTER_MPI_STRUCT(IdxVal, &IdxVal::idx, &IdxVal::val);
+
 using namespace parallelzone::mpi_helpers;
 using size_type     = std::size_t;
 using opt_root_type = std::optional<size_type>;
@@ -114,6 +133,407 @@ TEST_CASE("CommPP") {
         }
     }
 
+    SECTION("duplicate") {
+        REQUIRE(defaulted.duplicate() == defaulted);
+        REQUIRE(null.duplicate() == defaulted);
+
+        auto dup = comm.duplicate();
+        REQUIRE(dup.size() == comm.size());
+        REQUIRE(dup.me() == comm.me());
+        REQUIRE_FALSE(dup == comm);
+
+        int result;
+        MPI_Comm_compare(dup.comm(), comm.comm(), &result);
+        REQUIRE(result == MPI_CONGRUENT);
+
+        // Copies share the duplicate
+        CommPP copy_dup(dup);
+        REQUIRE(copy_dup == dup);
+    }
+
+    SECTION("hierarchical collectives") {
+        using limits    = std::numeric_limits<std::size_t>;
+        using algorithm = CommPP::algorithm;
+        REQUIRE_THROWS_AS(defaulted.hierarchical_threshold(),
+                          std::runtime_error);
+        REQUIRE_THROWS_AS(defaulted.set_node_color(0), std::runtime_error);
+        REQUIRE(comm.hierarchical_threshold() == limits::max());
+
+        // Fake two ranks per node, with and without blocks of ranks
+        for(auto color : {me / 2, me % 2}) {
+            comm.set_node_color(color);
+
+            std::vector<std::string> ser(2, std::to_string(me));
+            std::vector<double> unser(me + 1, me);
+            auto ser_corr   = comm.gather(ser, algorithm::flat);
+            auto unser_corr = comm.gatherv(unser, algorithm::flat);
+            REQUIRE(comm.gather(ser, algorithm::hierarchical) == ser_corr);
+            REQUIRE(comm.gatherv(unser, algorithm::hierarchical) == unser_corr);
+
+            comm.set_hierarchical_threshold(0);
+            REQUIRE(comm.hierarchical_threshold() == 0);
+            REQUIRE(comm.gather(ser) == ser_corr);
+            REQUIRE(comm.gatherv(unser) == unser_corr);
+            comm.set_hierarchical_threshold(limits::max());
+        }
+    }
+
+    SECTION("tuning") {
+        using algorithm   = CommPP::algorithm;
+        using tuning_type = CommPP::tuning_type;
+        REQUIRE_THROWS_AS(defaulted.tuning(), std::runtime_error);
+        REQUIRE_THROWS_AS(defaulted.set_tuning({}), std::runtime_error);
+        REQUIRE_THROWS_AS(defaulted.tune(), std::runtime_error);
+        REQUIRE(comm.tuning() == tuning_type{});
+
+        std::vector<std::string> ser(2, std::to_string(me));
+        std::vector<std::string> vser(me + 1, std::to_string(me));
+        std::vector<double> unser(me + 1, me);
+        auto ser_corr   = comm.gather(ser, algorithm::flat);
+        auto vser_corr  = comm.gatherv(vser, algorithm::flat);
+        auto unser_corr = comm.gatherv(unser, algorithm::flat);
+
+        SECTION("explicit algorithms") {
+            for(auto alg : {algorithm::ring, algorithm::eager}) {
+                REQUIRE(comm.gather(ser, alg) == ser_corr);
+                REQUIRE(comm.gatherv(vser, alg) == vser_corr);
+                REQUIRE(comm.gatherv(unser, alg) == unser_corr);
+            }
+        }
+
+        SECTION("automatic") {
+            tuning_type tuning;
+            tuning.eager_threshold = 16;
+            tuning.ring_threshold  = 0;
+            comm.set_tuning(tuning);
+            REQUIRE(comm.tuning() == tuning);
+            REQUIRE(CommPP(comm).tuning() == tuning);
+            REQUIRE(comm.gather(ser) == ser_corr);
+            REQUIRE(comm.gatherv(vser) == vser_corr);
+            REQUIRE(comm.gatherv(unser) == unser_corr);
+        }
+
+        SECTION("tune") {
+            const auto tuning = comm.tune();
+            REQUIRE(comm.tuning() == tuning);
+            REQUIRE(tuning.n_procs == std::size_t(n_ranks));
+            REQUIRE(comm.gatherv(vser) == vser_corr);
+        }
+    }
+
+    SECTION("compression") {
+        REQUIRE_THROWS_AS(defaulted.compression_stats(), std::runtime_error);
+        auto codec = std::make_shared<ZeroRunCodec>();
+        comm.set_compression(codec, 64);
+
+        // A mostly-zero map, plus one too small to compress
+        std::map<size_type, std::vector<double>> sparse;
+        sparse[me] = std::vector<double>(1000, 0.0);
+        sparse[me][me] = 1.0;
+        std::vector<std::string> small{std::to_string(me)};
+
+        auto gathered = comm.gather(sparse);
+        REQUIRE(gathered.size() == n_ranks);
+        for(size_type r = 0; r < n_ranks; ++r)
+            REQUIRE(gathered[r].at(r)[r] == 1.0);
+
+        auto gatherv_rv = comm.gatherv(small, 0);
+        if(me == 0) {
+            REQUIRE(gatherv_rv->size() == n_ranks);
+            REQUIRE(gatherv_rv->back()[0] == std::to_string(n_ranks - 1));
+        }
+
+        auto bcast = comm.broadcast(sparse, 0);
+        REQUIRE(bcast.at(0)[0] == 1.0);
+
+        const auto stats = comm.compression_stats();
+        // Only the root of the broadcast compresses
+        REQUIRE(stats.n_compressed == (me == 0 ? 2 : 1));
+        REQUIRE(stats.n_skipped == 1);
+        REQUIRE(stats.ratio() > 10.0);
+
+        // Turning it back off leaves the results unchanged
+        comm.set_compression(nullptr);
+        REQUIRE(comm.gather(sparse) == gathered);
+        REQUIRE(comm.compression_stats().bytes_in == 0);
+    }
+
+    SECTION("instrumentation") {
+        REQUIRE_THROWS_AS(defaulted.comm_stats(), std::runtime_error);
+        REQUIRE_FALSE(comm.instrumenting());
+
+        // Nothing is recorded while instrumentation is off
+        comm.gather(std::vector<int>{1});
+        REQUIRE(comm.comm_stats().ops.empty());
+
+        comm.set_instrumentation(true);
+        REQUIRE(comm.instrumenting());
+
+        std::vector<double> data(4, double(me));
+        comm.gather(data);
+        comm.gather(data, 0);
+        comm.reduce(data, std::plus<double>());
+        auto strings = comm.gather(std::vector<std::string>{"Hello"});
+        REQUIRE(strings.size() == n_ranks);
+
+        // Copies share the statistics, duplicates do not
+        CommPP copy(comm);
+        auto dup = comm.duplicate();
+        REQUIRE(dup.instrumenting());
+        dup.broadcast(std::string("World"), 0);
+        REQUIRE(dup.comm_stats().ops.count("broadcast"));
+
+        const auto stats = copy.comm_stats();
+        REQUIRE_FALSE(stats.ops.count("broadcast"));
+
+        const auto& allgather = stats.ops.at("allgather");
+        REQUIRE(allgather.n_calls == 2);
+        REQUIRE(allgather.bytes_received >= data.size() * sizeof(double));
+        REQUIRE(allgather.serialization_time.count() > 0);
+
+        const auto& gather = stats.ops.at("gather");
+        REQUIRE(gather.n_calls == 1);
+        REQUIRE(gather.bytes_sent == data.size() * sizeof(double));
+        const auto n_received = me == 0 ? n_ranks * gather.bytes_sent : 0;
+        REQUIRE(gather.bytes_received == n_received);
+        REQUIRE(gather.serialization_time.count() == 0);
+
+        const auto& allreduce = stats.ops.at("allreduce");
+        REQUIRE(allreduce.n_calls == 1);
+        REQUIRE(allreduce.bytes_sent == data.size() * sizeof(double));
+        REQUIRE(allreduce.bytes_received == allreduce.bytes_sent);
+
+        // Every call lands in exactly one latency bin
+        for(const auto& [name, op] : stats.ops) {
+            size_type n_binned = 0;
+            for(auto n : op.latency) n_binned += n;
+            REQUIRE(n_binned == op.n_calls);
+        }
+
+        comm.reset_comm_stats();
+        REQUIRE(copy.comm_stats().ops.empty());
+        comm.set_instrumentation(false);
+        REQUIRE_FALSE(copy.instrumenting());
+    }
+
+    SECTION("reduction operations") {
+        const int n = n_ranks;
+        const int r = me;
+
+        SECTION("minimum/maximum") {
+            std::vector<int> local_data{r, -r};
+            auto min = comm.reduce(local_data, minimum<int>());
+            auto max = comm.reduce(local_data, maximum<int>());
+            REQUIRE(min == std::vector<int>{0, 1 - n});
+            REQUIRE(max == std::vector<int>{n - 1, 0});
+        }
+
+        SECTION("min_loc/max_loc") {
+            using pair_type = ValueLoc<double>;
+            // Every rank has the same extreme value, the lowest rank wins
+            std::vector<pair_type> local_data{{double(r % 2), r}, {1.0, r}};
+            auto min = comm.reduce(local_data, min_loc<pair_type>());
+            auto max = comm.reduce(local_data, max_loc<pair_type>(), 0);
+            REQUIRE(min == std::vector<pair_type>{{0.0, 0}, {1.0, 0}});
+            if(me == 0) {
+                pair_type corr0{n > 1 ? 1.0 : 0.0, n > 1 ? 1 : 0};
+                REQUIRE(*max == std::vector<pair_type>{corr0, {1.0, 0}});
+            }
+        }
+
+        SECTION("lambda") {
+            // Not commutative, so the result must be from the last rank
+            auto last = [](int, int rhs) { return rhs; };
+            std::vector<int> local_data{r, r + 1};
+            auto rv = comm.reduce(local_data, last);
+            REQUIRE(rv == std::vector<int>{n - 1, n});
+
+            auto frv = comm.ireduce(local_data, last, 0);
+            auto prv = comm.persistent_reduce<int>(2, last);
+            REQUIRE(prv(local_data) == std::vector<int>{n - 1, n});
+            if(me == 0) REQUIRE(*frv.get() == std::vector<int>{n - 1, n});
+        }
+
+        SECTION("registered struct") {
+            // Keeps the largest value and, on ties, the smallest index
+            auto max_idx = [](const IdxVal& lhs, const IdxVal& rhs) {
+                if(lhs.val != rhs.val) return lhs.val > rhs.val ? lhs : rhs;
+                return lhs.idx < rhs.idx ? lhs : rhs;
+            };
+            std::vector<IdxVal> local_data{{r, double(r)}, {r, 1.0}};
+            std::vector<IdxVal> corr{{n - 1, double(n - 1)}, {0, 1.0}};
+            REQUIRE(comm.reduce(local_data, max_idx) == corr);
+            auto rv = comm.reduce(local_data, max_idx, 0);
+            if(me == 0) REQUIRE(*rv == corr);
+
+            // MPI_SUM isn't defined for derived data types, so std::plus has
+            // to become a UserOp
+            const int sum = n * (n - 1) / 2;
+            std::vector<IdxVal> sum_corr{{sum, double(sum)}, {sum, n * 1.0}};
+            REQUIRE(comm.reduce(local_data, std::plus<IdxVal>()) == sum_corr);
+            auto frv = comm.ireduce(local_data, std::plus<IdxVal>(), 0);
+            if(me == 0) REQUIRE(*frv.get() == sum_corr);
+        }
+
+        SECTION("scalar") {
+            REQUIRE(comm.reduce(r, std::plus<int>()) == n * (n - 1) / 2);
+            REQUIRE(comm.reduce(double(r), maximum<double>()) == n - 1);
+            auto last = [](const auto&, const auto& rhs) { return rhs; };
+            REQUIRE(comm.reduce(r, last) == n - 1);
+            REQUIRE(comm.reduce(IdxVal{r, 1.0}, last) == IdxVal{n - 1, 1.0});
+            auto rv = comm.reduce(r, std::plus<int>(), n - 1);
+            REQUIRE(rv.has_value() == (r == n - 1));
+            if(r == n - 1) REQUIRE(*rv == n * (n - 1) / 2);
+        }
+
+        SECTION("serialized") {
+            // Concatenation is not commutative, so this checks the order
+            std::string corr;
+            for(int i = 0; i < n; ++i) corr += std::to_string(i);
+            using vector_type = std::vector<std::string>;
+            vector_type local_data{std::to_string(r), "x"};
+            auto cat = std::plus<std::string>();
+
+            SECTION("element-wise") {
+                vector_type all_corr{corr, std::string(n, 'x')};
+                REQUIRE(comm.reduce(local_data, cat) == all_corr);
+                const int root = n - 1;
+                auto rv        = comm.reduce(local_data, cat, root);
+                REQUIRE(rv.has_value() == (r == root));
+                if(r == root) REQUIRE(*rv == all_corr);
+            }
+
+            SECTION("whole objects") {
+                using map_type = std::map<int, std::string>;
+                auto merge     = [](map_type lhs, const map_type& rhs) {
+                    for(const auto& [k, v] : rhs) lhs[k] += v;
+                    return lhs;
+                };
+                map_type local_map{{r, "a"}, {-1, std::to_string(r)}};
+                map_type map_corr{{-1, corr}};
+                for(int i = 0; i < n; ++i) map_corr[i] = "a";
+                REQUIRE(comm.reduce(local_map, merge) == map_corr);
+                auto rv = comm.reduce(std::move(local_map), merge, 0);
+                if(r == 0) REQUIRE(*rv == map_corr);
+            }
+
+            SECTION("no MPI datatype") {
+                using pair_type = std::pair<int, int>;
+                auto sum        = [](pair_type lhs, pair_type rhs) {
+                    return pair_type{lhs.first + rhs.first,
+                                     lhs.second + rhs.second};
+                };
+                std::vector<pair_type> local_pairs{{r, 1}};
+                auto rv = comm.reduce(local_pairs, sum);
+                REQUIRE(rv == std::vector<pair_type>{{n * (n - 1) / 2, n}});
+            }
+        }
+
+        SECTION("UserOp") {
+            int n_calls = 0;
+            auto sum    = [&n_calls](int lhs, int rhs) {
+                ++n_calls;
+                return lhs + rhs;
+            };
+            CommPP::user_op_type<int> op(sum, true);
+            std::vector<int> local_data{r, 1};
+            auto rv = comm.reduce(local_data, op);
+            REQUIRE(rv == std::vector<int>{n * (n - 1) / 2, n});
+            // MPI did (at least) the n - 1 combinations per element
+            auto calls = comm.reduce(std::vector<int>{n_calls}, op);
+            REQUIRE(calls[0] >= 2 * (n - 1));
+        }
+    }
+
+    SECTION("contiguous ranges") {
+        const double r    = me;
+        const double n    = n_ranks;
+        using vector_type = std::vector<double>;
+        std::array<double, 2> arr{r, 1.0};
+        vector_type data{r, 1.0};
+        std::span<const double> view(data);
+        std::valarray<double> va{r, 1.0};
+        testing::Block block(2);
+        block.data()[0] = r;
+
+        vector_type gathered;
+        for(size_type i = 0; i < n_ranks; ++i) {
+            gathered.push_back(i);
+            gathered.push_back(1.0);
+        }
+
+        SECTION("gather") {
+            REQUIRE(comm.gather(arr) == gathered);
+            REQUIRE(comm.gather(view) == gathered);
+            REQUIRE(comm.gather(va) == gathered);
+            REQUIRE(comm.gatherv(view) == gathered);
+            auto rv = comm.gather(block);
+            STATIC_REQUIRE(std::is_same_v<decltype(rv), testing::Block>);
+            REQUIRE(rv.size() == gathered.size());
+            REQUIRE(rv.data()[2 * (n_ranks - 1)] == n - 1);
+
+            vector_type out(gathered.size());
+            comm.gather(arr, std::span(out));
+            REQUIRE(out == gathered);
+        }
+
+        SECTION("broadcast") {
+            auto rv = comm.broadcast(arr, 0);
+            STATIC_REQUIRE(std::is_same_v<decltype(rv), decltype(arr)>);
+            REQUIRE(rv == std::array<double, 2>{0.0, 1.0});
+            REQUIRE(comm.broadcast(view, 0) == vector_type{0.0, 1.0});
+        }
+
+        SECTION("reduce") {
+            auto op   = std::plus<double>();
+            auto sum  = n * (n - 1) / 2;
+            auto corr = vector_type{sum, n};
+            auto rv   = comm.reduce(arr, op);
+            REQUIRE(vector_type(rv.begin(), rv.end()) == corr);
+            REQUIRE(comm.reduce(view, op) == corr);
+            auto rv_va = comm.reduce(va, op);
+            REQUIRE(rv_va[0] == sum);
+            REQUIRE(comm.reduce(block, op).data()[0] == sum);
+        }
+
+        SECTION("alltoall") {
+            // Rank i gets element i of every process, i.e., r from rank r
+            vector_type send(n_ranks, r);
+            vector_type corr(n_ranks);
+            std::iota(corr.begin(), corr.end(), 0.0);
+            REQUIRE(comm.alltoall(std::span<const double>(send)) == corr);
+        }
+
+        SECTION("point-to-point") {
+            auto f   = comm.isend(arr, me);
+            auto got = comm.recv<std::array<double, 2>>(me);
+            f.wait();
+            REQUIRE(got == arr);
+        }
+
+        SECTION("nonblocking views own their data") {
+            auto copy = std::make_unique<vector_type>(data);
+            auto f    = comm.igather(std::span<const double>(*copy));
+            copy.reset();
+            REQUIRE(f.get() == gathered);
+        }
+    }
+
+    SECTION("tag") {
+        REQUIRE_THROWS_AS(defaulted.tag("hello"), std::runtime_error);
+
+        auto hello = comm.tag("hello");
+        REQUIRE(hello >= 0);
+        REQUIRE(comm.tag("hello") == hello);
+        REQUIRE(comm.tag("world") != hello);
+
+        // Copies share the registry, so the tags are the same on every rank
+        CommPP copy_comm(comm);
+        REQUIRE(copy_comm.tag("hello") == hello);
+        auto tags = comm.gather(std::vector<int>{hello});
+        REQUIRE(tags == std::vector<int>(n_ranks, hello));
+    }
+
     SECTION("comm") {
         REQUIRE(defaulted.comm() == MPI_COMM_NULL);
         REQUIRE(null.comm() == MPI_COMM_NULL);
@@ -194,6 +614,40 @@ TEST_CASE("CommPP") {
                 std::iota(corr.begin(), corr.end(), 0.0);
                 REQUIRE(rv == corr);
             }
+
+            SECTION("into a span") {
+                using data_type = std::vector<no_serialization>;
+                data_type local_data(chunk_size);
+                std::iota(local_data.begin(), local_data.end(), begin);
+                data_type rv(n_ranks * chunk_size);
+                comm.gather(local_data, std::span(rv));
+                data_type corr(n_ranks * chunk_size);
+                std::iota(corr.begin(), corr.end(), 0.0);
+                REQUIRE(rv == corr);
+
+                data_type too_small(rv.size() - 1);
+                auto out = std::span(too_small);
+                REQUIRE_THROWS_AS(comm.gather(local_data, out),
+                                  std::runtime_error);
+            }
+
+            SECTION("in place") {
+                using data_type = std::vector<no_serialization>;
+                data_type rv(n_ranks * chunk_size);
+                auto my_block = rv.begin() + begin;
+                std::iota(my_block, my_block + chunk_size, begin);
+                comm.gather_in_place(std::span(rv));
+                data_type corr(n_ranks * chunk_size);
+                std::iota(corr.begin(), corr.end(), 0.0);
+                REQUIRE(rv == corr);
+
+                if(n_ranks > 1) {
+                    data_type uneven(n_ranks * chunk_size + 1);
+                    auto out = std::span(uneven);
+                    REQUIRE_THROWS_AS(comm.gather_in_place(out),
+                                      std::runtime_error);
+                }
+            }
         }
 
         SECTION("all gatherv" + chunk_str) {
@@ -221,13 +675,39 @@ TEST_CASE("CommPP") {
                 }
                 REQUIRE(rv == corr);
             }
+
+            SECTION("with counts") {
+                // Rank r sends r * chunk_size copies of r
+                using data_type = std::vector<no_serialization>;
+                data_type local_data(chunk_size * me, me);
+                auto rv_counts = comm.gatherv_with_counts(local_data);
+                auto& [rv, counts, offsets] = rv_counts;
+                REQUIRE(rv == comm.gatherv(local_data));
+                REQUIRE(counts.size() == n_ranks);
+                REQUIRE(offsets.size() == n_ranks);
+                for(size_type r = 0; r < n_ranks; ++r) {
+                    REQUIRE(counts[r] == chunk_size * r);
+                    REQUIRE(offsets[r] == chunk_size * r * (r - 1) / 2);
+                    auto begin = rv.begin() + offsets[r];
+                    auto end   = begin + counts[r];
+                    REQUIRE(std::all_of(begin, end, [=](auto x) {
+                        return x == no_serialization(r);
+                    }));
+                }
+
+                // Each char is one element
+                auto str = comm.gatherv_with_counts(std::string(me, 'a'));
+                REQUIRE(std::get<0>(str).size() == n_ranks * (n_ranks - 1) / 2);
+                REQUIRE(std::get<1>(str).back() == n_ranks - 1);
+            }
         }
 
         SECTION("all reduce" + chunk_str) {
             using data_type = std::vector<no_serialization>;
             data_type local_data(chunk_size);
             std::iota(local_data.begin(), local_data.end(), begin);
-            auto rv = comm.reduce(local_data, std::plus<no_serialization>());
+            auto op = std::plus<no_serialization>();
+            auto rv = comm.reduce(local_data, op);
 
             data_type corr(chunk_size);
             for(size_type i = 0; i < n_ranks; ++i) {
@@ -235,11 +715,391 @@ TEST_CASE("CommPP") {
                 for(size_type j = 0; j < chunk_size; ++j) corr[j] += begin + j;
             }
             REQUIRE(rv == corr);
+
+            SECTION("into a span") {
+                data_type out(chunk_size);
+                comm.reduce(local_data, std::span(out), op);
+                REQUIRE(out == corr);
+
+                data_type too_small(chunk_size - 1);
+                auto small = std::span(too_small);
+                REQUIRE_THROWS_AS(comm.reduce(local_data, small, op),
+                                  std::runtime_error);
+            }
+
+            SECTION("in place") {
+                comm.reduce_in_place(std::span(local_data), op);
+                REQUIRE(local_data == corr);
+            }
+        }
+
+        SECTION("nonblocking all" + chunk_str) {
+            using ser_type   = std::vector<needs_serialized>;
+            using unser_type = std::vector<no_serialization>;
+            ser_type ser_data(chunk_size, "Hello");
+            ser_type serv_data(chunk_size * me, "Hello");
+            unser_type unser_data(chunk_size * (me + 1));
+            std::iota(unser_data.begin(), unser_data.end(), begin);
+            auto op = std::plus<no_serialization>();
+
+            SECTION("igather") {
+                auto f0 = comm.igather(ser_data);
+                auto f1 = comm.igather(unser_type(chunk_size, 1.0));
+                REQUIRE(f0.get() == comm.gather(ser_data));
+                REQUIRE(f1.get() == comm.gather(unser_type(chunk_size, 1.0)));
+            }
+
+            SECTION("igatherv") {
+                auto f0 = comm.igatherv(serv_data);
+                auto f1 = comm.igatherv(unser_data);
+                REQUIRE(f0.get() == comm.gatherv(serv_data));
+                REQUIRE(f1.get() == comm.gatherv(unser_data));
+            }
+
+            SECTION("ireduce") {
+                unser_type local_data(chunk_size);
+                std::iota(local_data.begin(), local_data.end(), begin);
+                auto corr = comm.reduce(local_data, op);
+                auto f    = comm.ireduce(local_data, op);
+                local_data.clear(); // The future owns its own copy
+                REQUIRE(f.get() == corr);
+            }
+
+            SECTION("persistent_reduce") {
+                unser_type local_data(chunk_size);
+                auto r0 = comm.persistent_reduce<no_serialization>(chunk_size,
+                                                                   op);
+                auto r1 = comm.persistent_reduce<no_serialization>(chunk_size,
+                                                                   op, 0);
+                for(int i = 0; i < 3; ++i) {
+                    std::iota(local_data.begin(), local_data.end(), begin + i);
+                    auto corr = comm.reduce(local_data, op);
+                    REQUIRE(r0(local_data) == corr);
+                    if(me == 0) {
+                        REQUIRE(r1(local_data) == corr);
+                    } else {
+                        REQUIRE(r1(local_data).empty());
+                    }
+                }
+            }
+        }
+
+        SECTION("alltoall" + chunk_str) {
+            SECTION("needs serialized") {
+                // Rank r sends (r + d) * chunk_size copies of r to rank d
+                using data_type = std::vector<std::vector<needs_serialized>>;
+                data_type local_data, corr;
+                for(size_type d = 0; d < n_ranks; ++d) {
+                    auto n = (me + d) * chunk_size;
+                    local_data.emplace_back(n, std::to_string(me));
+                    corr.emplace_back((d + me) * chunk_size, std::to_string(d));
+                }
+                REQUIRE(comm.alltoall(local_data) == corr);
+            }
+
+            SECTION("contiguous pieces") {
+                // Rank r sends d + 1 copies of r to rank d
+                using data_type = std::vector<std::vector<no_serialization>>;
+                data_type local_data, corr;
+                for(size_type d = 0; d < n_ranks; ++d) {
+                    local_data.emplace_back(d + 1, me);
+                    corr.emplace_back(me + 1, d);
+                }
+                REQUIRE(comm.alltoall(std::move(local_data)) == corr);
+            }
+
+            SECTION("doesn't need serialized") {
+                // Element i of rank r's piece for rank d is r * 100 + d + i
+                using data_type = std::vector<no_serialization>;
+                data_type local_data, corr;
+                for(size_type d = 0; d < n_ranks; ++d) {
+                    for(size_type i = 0; i < chunk_size; ++i) {
+                        local_data.push_back(me * 100 + d + i);
+                        corr.push_back(d * 100 + me + i);
+                    }
+                }
+                REQUIRE(comm.alltoall(local_data) == corr);
+            }
+
+            SECTION("Wrong number of objects") {
+                using data_type = std::vector<needs_serialized>;
+                data_type local_data(n_ranks);
+                if(me == 0) local_data.push_back("Hello");
+                REQUIRE_THROWS_AS(comm.alltoall(local_data),
+                                  std::runtime_error);
+            }
+
+            SECTION("Can't be split evenly") {
+                std::vector<no_serialization> local_data(n_ranks + 1);
+                if(n_ranks > 1) {
+                    REQUIRE_THROWS_AS(comm.alltoall(local_data),
+                                      std::runtime_error);
+                }
+            }
+
+            SECTION("Different sizes") {
+                // Only rank 0 can't be split evenly, but everybody throws
+                std::vector<no_serialization> local_data(n_ranks + 1);
+                if(me != 0) local_data.pop_back();
+                if(n_ranks > 1) {
+                    REQUIRE_THROWS_AS(comm.alltoall(local_data),
+                                      std::runtime_error);
+                }
+
+                // Every process can be split evenly, but the sizes differ
+                local_data.assign(n_ranks * (me == 0 ? 2 : 1), {});
+                if(n_ranks > 1) {
+                    REQUIRE_THROWS_AS(comm.alltoall(local_data),
+                                      std::runtime_error);
+                }
+            }
+        }
+
+        SECTION("alltoallv" + chunk_str) {
+            // Rank r sends (r + d) * chunk_size elements to rank d
+            using data_type = std::vector<no_serialization>;
+            CommPP::count_container counts, corr_counts;
+            data_type local_data, corr;
+            for(size_type d = 0; d < n_ranks; ++d) {
+                counts.push_back((me + d) * chunk_size);
+                corr_counts.push_back((d + me) * chunk_size);
+                for(int i = 0; i < counts.back(); ++i) {
+                    local_data.push_back(me * 100 + i);
+                    corr.push_back(d * 100 + i);
+                }
+            }
+
+            SECTION("good counts") {
+                auto [rv, rv_counts] = comm.alltoallv(local_data, counts);
+                REQUIRE(rv == corr);
+                REQUIRE(rv_counts == corr_counts);
+            }
+
+            SECTION("bad counts") {
+                if(me == 0) counts.push_back(1);
+                REQUIRE_THROWS_AS(comm.alltoallv(local_data, counts),
+                                  std::runtime_error);
+            }
+        }
+
+        SECTION("point-to-point" + chunk_str) {
+            // Each rank sends to the next rank and receives from the previous
+            // one. Messages are different sizes on different ranks to make
+            // sure the receiver figures out the size.
+            using ser_type   = std::vector<needs_serialized>;
+            using unser_type = std::vector<no_serialization>;
+            const auto next  = (me + 1) % n_ranks;
+            const auto prev  = (me + n_ranks - 1) % n_ranks;
+            const auto tag   = comm.tag("point-to-point");
+
+            ser_type ser_data(chunk_size * (me + 1), "Hello");
+            ser_type ser_corr(chunk_size * (prev + 1), "Hello");
+            unser_type unser_data(chunk_size * (me + 1));
+            std::iota(unser_data.begin(), unser_data.end(), begin);
+            unser_type unser_corr(chunk_size * (prev + 1));
+            std::iota(unser_corr.begin(), unser_corr.end(), prev * chunk_size);
+            needs_serialized str_data(chunk_size * (me + 1), 'a');
+            needs_serialized str_corr(chunk_size * (prev + 1), 'a');
+
+            SECTION("send/recv") {
+                // Even ranks send first, odd ranks receive first
+                auto send = [&]() {
+                    comm.send(ser_data, next, tag);
+                    comm.send(unser_data, next, tag);
+                    comm.send(str_data, next);
+                };
+                if(me % 2 == 0) send();
+                REQUIRE(comm.recv<ser_type>(prev, tag) == ser_corr);
+                REQUIRE(comm.recv<unser_type>(prev, tag) == unser_corr);
+                REQUIRE(comm.recv<needs_serialized>(prev) == str_corr);
+                if(me % 2 == 1) send();
+            }
+
+            SECTION("isend/irecv") {
+                auto r0 = comm.irecv<ser_type>(prev, tag);
+                auto r1 = comm.irecv<unser_type>(prev, tag);
+                auto s0 = comm.isend(ser_data, next, tag);
+                auto s1 = comm.isend(std::move(unser_data), next, tag);
+                unser_data.clear(); // The future owns the buffer
+                REQUIRE(r0.get() == ser_corr);
+                REQUIRE(r1.get() == unser_corr);
+                s0.get();
+                s1.get();
+            }
+
+            SECTION("irecv polled with ready") {
+                auto r = comm.irecv<unser_type>(prev, tag);
+                auto s = comm.isend(unser_data, next, tag);
+                while(!r.ready()) {}
+                REQUIRE(r.get() == unser_corr);
+                s.wait();
+            }
         }
 
         for(size_type root = 0; root < std::min(n_ranks, max_ranks); ++root) {
             auto root_str = " root = " + std::to_string(root);
 
+            SECTION("broadcast" + root_str + chunk_str) {
+                SECTION("needs serialized") {
+                    using data_type = std::vector<needs_serialized>;
+                    data_type corr(chunk_size, "Hello");
+                    data_type local_data;
+                    if(me == root) local_data = corr;
+                    REQUIRE(comm.broadcast(local_data, root) == corr);
+                }
+
+                SECTION("doesn't need serialized") {
+                    using data_type = std::vector<no_serialization>;
+                    data_type corr(chunk_size);
+                    std::iota(corr.begin(), corr.end(), 0.0);
+                    data_type local_data;
+                    if(me == root) local_data = corr;
+                    REQUIRE(comm.broadcast(std::move(local_data), root) ==
+                            corr);
+                }
+
+                SECTION("std::string") {
+                    std::string corr(chunk_size, 'a');
+                    std::string local_data = me == root ? corr : "";
+                    REQUIRE(comm.broadcast(local_data, root) == corr);
+                }
+
+                SECTION("BinaryBuffer") {
+                    auto corr = make_binary_buffer(std::string("Hello"));
+                    BinaryBuffer local_data;
+                    if(me == root) local_data = corr;
+                    REQUIRE(comm.broadcast(local_data, root) == corr);
+                }
+            }
+
+            SECTION("scatter" + root_str + chunk_str) {
+                SECTION("needs serialized") {
+                    using data_type = std::vector<needs_serialized>;
+                    data_type local_data;
+                    if(me == root) {
+                        for(size_type i = 0; i < n_ranks; ++i)
+                            local_data.emplace_back(chunk_size + i, 'a');
+                    }
+                    auto rv = comm.scatter(local_data, root);
+                    REQUIRE(rv == needs_serialized(chunk_size + me, 'a'));
+                }
+
+                SECTION("doesn't need serialized") {
+                    using data_type = std::vector<no_serialization>;
+                    data_type local_data;
+                    if(me == root) {
+                        local_data.resize(n_ranks * chunk_size);
+                        std::iota(local_data.begin(), local_data.end(), 0.0);
+                    }
+                    auto rv = comm.scatter(local_data, root);
+                    data_type corr(chunk_size);
+                    std::iota(corr.begin(), corr.end(), begin);
+                    REQUIRE(rv == corr);
+                }
+
+                SECTION("std::string") {
+                    std::string local_data;
+                    if(me == root) {
+                        for(size_type i = 0; i < n_ranks; ++i)
+                            local_data += std::string(chunk_size, 'a' + i);
+                    }
+                    auto rv = comm.scatter(local_data, root);
+                    REQUIRE(rv == std::string(chunk_size, 'a' + me));
+                }
+
+                SECTION("Can't be split evenly") {
+                    // Everything can be split evenly over one rank
+                    std::vector<no_serialization> local_data;
+                    if(me == root) local_data.resize(n_ranks * chunk_size + 1);
+                    using except_t = std::runtime_error;
+                    if(n_ranks > 1)
+                        REQUIRE_THROWS_AS(comm.scatter(local_data, root),
+                                          except_t);
+                }
+
+                SECTION("Wrong number of objects") {
+                    std::vector<needs_serialized> local_data;
+                    if(me == root) local_data.resize(n_ranks + 1);
+                    using except_t = std::runtime_error;
+                    REQUIRE_THROWS_AS(comm.scatter(local_data, root), except_t);
+                }
+            }
+
+            SECTION("scatterv" + root_str + chunk_str) {
+                using data_type = std::vector<no_serialization>;
+                // The first `extra` ranks get an extra element
+                const size_type extra = n_ranks > 1 ? n_ranks - 1 : 0;
+                const size_type n     = n_ranks * chunk_size + extra;
+                data_type local_data;
+                if(me == root) {
+                    local_data.resize(n);
+                    std::iota(local_data.begin(), local_data.end(), 0.0);
+                }
+
+                SECTION("even split") {
+                    auto rv             = comm.scatterv(local_data, root);
+                    const auto my_begin = me * chunk_size + std::min(me, extra);
+                    data_type corr(chunk_size + (me < extra ? 1 : 0));
+                    std::iota(corr.begin(), corr.end(), my_begin);
+                    REQUIRE(rv == corr);
+                }
+
+                SECTION("provided counts") {
+                    // Rank i gets i elements (starting at i * (i - 1) / 2)
+                    CommPP::count_container counts;
+                    for(size_type i = 0; i < n_ranks; ++i)
+                        counts.push_back(i);
+                    data_type temp(n_ranks * n_ranks);
+                    std::iota(temp.begin(), temp.end(), 0.0);
+                    auto rv = comm.scatterv(temp, counts, root);
+                    data_type corr(me);
+                    std::iota(corr.begin(), corr.end(), me * (me - 1) / 2);
+                    REQUIRE(rv == corr);
+                }
+
+                SECTION("bad counts") {
+                    CommPP::count_container counts(n_ranks, 1);
+                    data_type temp(n_ranks - 1);
+                    using except_t = std::runtime_error;
+                    REQUIRE_THROWS_AS(comm.scatterv(temp, counts, root),
+                                      except_t);
+                }
+
+                SECTION("needs serialized") {
+                    std::vector<needs_serialized> objs;
+                    if(me == root) {
+                        for(size_type i = 0; i < n_ranks; ++i)
+                            objs.emplace_back(i * chunk_size, 'a');
+                    }
+                    auto rv = comm.scatterv(objs, root);
+                    REQUIRE(rv == needs_serialized(me * chunk_size, 'a'));
+                }
+            }
+
+            SECTION("nonblocking" + root_str + chunk_str) {
+                using ser_type   = std::vector<needs_serialized>;
+                using unser_type = std::vector<no_serialization>;
+                ser_type ser_data(chunk_size, "Hello");
+                ser_type serv_data(chunk_size * me, "Hello");
+                unser_type unser_data(chunk_size * (me + 1));
+                std::iota(unser_data.begin(), unser_data.end(), begin);
+                auto op = std::plus<no_serialization>();
+
+                auto f0 = comm.igather(ser_data, root);
+                auto f1 = comm.igather(unser_type(chunk_size, 1.0), root);
+                auto f2 = comm.igatherv(serv_data, root);
+                auto f3 = comm.igatherv(unser_data, root);
+                auto f4 = comm.ireduce(unser_type(chunk_size, 1.0), op, root);
+
+                REQUIRE(f0.get() == comm.gather(ser_data, root));
+                REQUIRE(f1.get() ==
+                        comm.gather(unser_type(chunk_size, 1.0), root));
+                REQUIRE(f2.get() == comm.gatherv(serv_data, root));
+                REQUIRE(f3.get() == comm.gatherv(unser_data, root));
+                REQUIRE(f4.get() ==
+                        comm.reduce(unser_type(chunk_size, 1.0), op, root));
+            }
+
             SECTION("gather " + root_str + chunk_str) {
                 SECTION("needs serialized") {
                     using data_type = std::vector<needs_serialized>;
@@ -268,6 +1128,21 @@ TEST_CASE("CommPP") {
                         REQUIRE_FALSE(rv.has_value());
                     }
                 }
+
+                SECTION("into a span") {
+                    using data_type = std::vector<no_serialization>;
+                    data_type local_data(chunk_size);
+                    std::iota(local_data.begin(), local_data.end(), begin);
+
+                    // Only root's output buffer is used
+                    data_type rv(me == root ? n_ranks * chunk_size : 0);
+                    comm.gather(local_data, std::span(rv), root);
+                    if(me == root) {
+                        data_type corr(n_ranks * chunk_size);
+                        std::iota(corr.begin(), corr.end(), 0.0);
+                        REQUIRE(rv == corr);
+                    }
+                }
             }
 
             SECTION("gatherv " + root_str + chunk_str) {
@@ -306,6 +1181,20 @@ TEST_CASE("CommPP") {
                         REQUIRE_FALSE(rv.has_value());
                     }
                 }
+                SECTION("with counts") {
+                    using data_type = std::vector<no_serialization>;
+                    data_type local_data(chunk_size * me, me);
+                    auto rv = comm.gatherv_with_counts(local_data, root);
+                    REQUIRE(rv.has_value() == (me == root));
+                    if(me == root) {
+                        const auto& [data, counts, offsets] = *rv;
+                        REQUIRE(data == *comm.gatherv(local_data, root));
+                        REQUIRE(counts.back() == chunk_size * (n_ranks - 1));
+                        REQUIRE(offsets.front() == 0);
+                    } else {
+                        comm.gatherv(local_data, root);
+                    }
+                }
             }
             SECTION("reduce" + root_str + chunk_str) {
                 using data_type = std::vector<no_serialization>;
@@ -323,8 +1212,16 @@ TEST_CASE("CommPP") {
                     }
                     REQUIRE(rv.has_value());
                     REQUIRE(*rv == corr);
+
+                    data_type out(chunk_size);
+                    comm.reduce(local_data, std::span(out), op, root);
+                    REQUIRE(out == corr);
                 } else {
                     REQUIRE_FALSE(rv.has_value());
+
+                    // Only root's output buffer is used
+                    data_type out;
+                    comm.reduce(local_data, std::span(out), op, root);
                 }
             }
         }
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../test_parallelzone.hpp"
+#include <parallelzone/mpi_helpers/commpp/commpp_future.hpp>
+
+/* Testing Strategy:
+ *
+ * CommPPFuture only interacts with MPI through the request it holds. To test
+ * it in isolation we use MPI_REQUEST_NULL (an already completed request) and
+ * a request from a barrier. The actual collectives are tested with CommPP.
+ */
+
+using namespace parallelzone::mpi_helpers;
+
+TEST_CASE("CommPPFuture") {
+    using future_type = CommPPFuture<int>;
+
+    future_type defaulted;
+    future_type done(MPI_REQUEST_NULL, []() { return 42; });
+
+    SECTION("CTors") {
+        SECTION("Default") { REQUIRE_FALSE(defaulted.valid()); }
+
+        SECTION("value") { REQUIRE(done.valid()); }
+
+        SECTION("move") {
+            future_type moved(std::move(done));
+            REQUIRE(moved.valid());
+            REQUIRE_FALSE(done.valid());
+            REQUIRE(moved.get() == 42);
+        }
+
+        SECTION("move assignment") {
+            auto pdefaulted = &(defaulted = std::move(done));
+            REQUIRE(pdefaulted == &defaulted);
+            REQUIRE(defaulted.valid());
+            REQUIRE_FALSE(done.valid());
+            REQUIRE(defaulted.get() == 42);
+        }
+    }
+
+    SECTION("ready") {
+        REQUIRE(defaulted.ready());
+        REQUIRE(done.ready());
+
+        auto& world = testing::PZEnvironment::comm_world();
+        MPI_Request request;
+        MPI_Ibarrier(world.mpi_comm(), &request);
+        future_type barrier(request, []() { return 1; });
+        while(!barrier.ready()) {}
+        REQUIRE(barrier.get() == 1);
+    }
+
+    SECTION("wait") {
+        auto& world = testing::PZEnvironment::comm_world();
+        MPI_Request request;
+        MPI_Ibarrier(world.mpi_comm(), &request);
+        future_type barrier(request, []() { return 1; });
+        barrier.wait();
+        REQUIRE(barrier.ready());
+        REQUIRE(barrier.valid());
+    }
+
+    SECTION("get") {
+        REQUIRE_THROWS_AS(defaulted.get(), std::runtime_error);
+        REQUIRE(done.get() == 42);
+        REQUIRE_FALSE(done.valid());
+        REQUIRE_THROWS_AS(done.get(), std::runtime_error);
+    }
+
+    SECTION("post") {
+        // Posts a barrier on the third try, if allowed to block posts it
+        // right away
+        int n_tries = 0;
+        auto post   = [&n_tries](MPI_Request& request, bool block) {
+            if(!block && ++n_tries < 3) return false;
+            auto& world = testing::PZEnvironment::comm_world();
+            MPI_Ibarrier(world.mpi_comm(), &request);
+            return true;
+        };
+        auto unwrap = []() { return 3; };
+
+        SECTION("ready") {
+            future_type f(post, unwrap);
+            REQUIRE(f.valid());
+            REQUIRE_FALSE(f.ready());
+            REQUIRE_FALSE(f.ready());
+            while(!f.ready()) {}
+            REQUIRE(n_tries == 3);
+            REQUIRE(f.get() == 3);
+        }
+
+        SECTION("get") {
+            future_type f(post, unwrap);
+            REQUIRE(f.get() == 3);
+            REQUIRE(n_tries == 0);
+        }
+
+        SECTION("then") {
+            auto twice = [](int x) { return 2 * x; };
+            auto f     = future_type(post, unwrap).then(twice);
+            REQUIRE(f.get() == 6);
+        }
+
+        SECTION("never posted") {
+            { future_type f(post, unwrap); }
+            REQUIRE(n_tries == 0);
+        }
+    }
+
+    SECTION("then") {
+        auto to_string = [](int x) { return std::to_string(x); };
+        auto str       = std::move(done).then(to_string);
+        REQUIRE_FALSE(done.valid());
+        REQUIRE(str.valid());
+        REQUIRE(str.get() == "42");
+    }
+}
@@ -0,0 +1,108 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_parallelzone.hpp"
+#include <parallelzone/mpi_helpers/commpp/detail_/collective_tuner.hpp>
+#include <parallelzone/mpi_helpers/commpp/detail_/commpp_pimpl.hpp>
+
+/* Testing Strategy:
+ *
+ * The timings depend on the machine, so for measure() we only check what
+ * does not: that the result is the same on every process, describes the
+ * communicator, and keeps the current values of thresholds which can not be
+ * measured. The rules turning timings into thresholds are static and are
+ * tested with made up timings.
+ */
+
+using namespace parallelzone::mpi_helpers;
+
+using tuner_type = detail_::CollectiveTuner;
+using pimpl_type = detail_::CommPPPIMPL;
+
+TEST_CASE("CollectiveTuner") {
+    using tuning_type = tuner_type::tuning_type;
+    auto& world       = testing::PZEnvironment::comm_world();
+    pimpl_type comm(world.mpi_comm());
+    const auto n_ranks = comm.size();
+
+    const tuner_type::size_container sizes{1, 2, 4, 8};
+
+    SECTION("crossover") {
+        using times = tuner_type::time_container;
+        const times baseline{1.0, 2.0, 3.0, 4.0};
+        REQUIRE(tuner_type::crossover(sizes, baseline, {2, 3, 2, 3}) == 4);
+        REQUIRE(tuner_type::crossover(sizes, baseline, {0, 3, 4, 5}) ==
+                tuning_type::never);
+        REQUIRE(tuner_type::crossover(sizes, baseline, {0, 0, 0, 0}) == 1);
+        REQUIRE(tuner_type::crossover(sizes, baseline, baseline) ==
+                tuning_type::never);
+    }
+
+    SECTION("last_win") {
+        using times = tuner_type::time_container;
+        const times baseline{1.0, 2.0, 3.0, 4.0};
+        REQUIRE(tuner_type::last_win(sizes, baseline, {0, 1, 4, 0}) == 2);
+        REQUIRE(tuner_type::last_win(sizes, baseline, {2, 1, 2, 3}) == 0);
+        REQUIRE(tuner_type::last_win(sizes, baseline, {0, 0, 0, 0}) == 8);
+        REQUIRE(tuner_type::last_win(sizes, baseline, baseline) == 0);
+    }
+
+    SECTION("compression_pays_off") {
+        // Saves half of each byte, which takes 1 ns to send
+        REQUIRE(tuner_type::compression_pays_off(1.0e-10, 2.0, 1.0e9));
+        REQUIRE_FALSE(tuner_type::compression_pays_off(1.0e-9, 2.0, 1.0e9));
+
+        // Incompressible data never pays off
+        REQUIRE_FALSE(tuner_type::compression_pays_off(0.0, 1.0, 1.0e9));
+    }
+
+    SECTION("measure") {
+        tuning_type current;
+        current.ring_threshold         = 123;
+        current.hierarchical_threshold = 456;
+        current.compress               = false;
+        comm.set_tuning(current);
+        comm.set_compression(std::make_shared<ZeroRunCodec>(), 0);
+
+        const auto topo_nodes = comm.topology().n_nodes();
+        const auto rv         = tuner_type(comm).measure();
+        REQUIRE(rv.matches(n_ranks, topo_nodes));
+
+        // Every process picked the same thresholds
+        std::uint64_t mine[3] = {rv.eager_threshold, rv.ring_threshold,
+                                 rv.hierarchical_threshold};
+        std::uint64_t max[3]  = {0, 0, 0};
+        MPI_Allreduce(mine, max, 3, MPI_UINT64_T, MPI_MAX, comm.comm());
+        REQUIRE(mine[0] == max[0]);
+        REQUIRE(mine[1] == max[1]);
+        REQUIRE(mine[2] == max[2]);
+
+        // Automatic all gathervs go eager with the measured threshold
+        if(rv.eager_threshold > 0) REQUIRE(rv.goes_eager(n_ranks));
+
+        // With nothing compressed yet, the compression setting is kept
+        REQUIRE_FALSE(rv.compress);
+
+        // Only one node, so hierarchical can't be measured
+        if(topo_nodes == 1) REQUIRE(rv.hierarchical_threshold == 456);
+
+        // A ring is never used with two or fewer processes
+        if(n_ranks <= 2) REQUIRE(rv.ring_threshold == 123);
+
+        // Measuring doesn't change the communicator
+        REQUIRE(comm.tuning() == current);
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../catch.hpp"
+#include <parallelzone/mpi_helpers/commpp/detail_/comm_profiler.hpp>
+#include <thread>
+
+/* Testing Strategy:
+ *
+ * CommProfiler is purely local. We check that nothing is recorded while it is
+ * disabled, that records (and timers) land under the right operation, and
+ * that reset clears everything.
+ */
+
+using namespace parallelzone::mpi_helpers::detail_;
+using parallelzone::mpi_helpers::OpStats;
+using namespace std::chrono_literals;
+
+TEST_CASE("CommProfiler") {
+    CommProfiler profiler;
+    REQUIRE_FALSE(profiler.enabled());
+
+    SECTION("disabled") {
+        { CommProfiler::OpTimer timer(profiler, "gather", 1, 2); }
+        REQUIRE(profiler.stats().ops.empty());
+    }
+
+    SECTION("record") {
+        profiler.enable(true);
+        REQUIRE(profiler.enabled());
+        profiler.record("gather", 1, 2, 3us);
+        profiler.record("gather", 4, 5, 6us);
+        profiler.record_serialization("gather", 7us);
+
+        const auto stats = profiler.stats();
+        REQUIRE(stats.ops.size() == 1);
+        const auto& gather = stats.ops.at("gather");
+        REQUIRE(gather.n_calls == 2);
+        REQUIRE(gather.bytes_sent == 5);
+        REQUIRE(gather.bytes_received == 7);
+        REQUIRE(gather.mpi_time == 9us);
+        REQUIRE(gather.serialization_time == 7us);
+    }
+
+    SECTION("OpTimer") {
+        profiler.enable(true);
+        {
+            CommProfiler::OpTimer timer(profiler, "send", 8, 0);
+            std::this_thread::sleep_for(1ms);
+        }
+        const auto send = profiler.stats().ops.at("send");
+        REQUIRE(send.n_calls == 1);
+        REQUIRE(send.bytes_sent == 8);
+        REQUIRE(send.mpi_time >= 1ms);
+        REQUIRE(send.latency[OpStats::bin(send.mpi_time)] == 1);
+
+        // Timers of nonblocking operations stay out of the histogram
+        { CommProfiler::OpTimer timer(profiler, "isend", 8, 0, false); }
+        const auto isend = profiler.stats().ops.at("isend");
+        REQUIRE(isend.n_calls == 1);
+        REQUIRE(isend.latency == OpStats::histogram_type{});
+    }
+
+    SECTION("reset") {
+        profiler.enable(true);
+        profiler.record("gather", 1, 2, 3us);
+        profiler.reset();
+        REQUIRE(profiler.stats().ops.empty());
+        REQUIRE(profiler.enabled());
+    }
+}
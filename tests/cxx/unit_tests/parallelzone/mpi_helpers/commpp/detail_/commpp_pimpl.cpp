@@ -16,6 +16,9 @@
 
 #include "../../../test_parallelzone.hpp"
 #include <parallelzone/mpi_helpers/commpp/detail_/commpp_pimpl.hpp>
+#include <filesystem>
+#include <limits>
+#include <numeric>
 
 using namespace parallelzone::mpi_helpers;
 
@@ -124,7 +127,7 @@ void gatherv_kernel(std::size_t chunk_size, root_type root, pimpl_type& comm) {
     if(am_i_root) {
         REQUIRE(rv.has_value());
         std::vector<T> corr;
-        std::vector<int> sizes_corr; // Sizes (in bytes)
+        std::vector<MPI_Count> sizes_corr; // Sizes (in bytes)
         for(std::size_t rank = 0; rank < std::size_t(n_ranks); ++rank) {
             sizes_corr.push_back((chunk_size + rank) * sizeof(T));
             for(std::size_t i = 0; i < chunk_size + rank; ++i)
@@ -158,6 +161,20 @@ TEST_CASE("CommPPPIMPL") {
         REQUIRE(*copy == comm);
     }
 
+    SECTION("duplicate()") {
+        auto dup = comm.duplicate();
+        REQUIRE(dup->size() == comm.size());
+        REQUIRE(dup->me() == comm.me());
+
+        int result;
+        MPI_Comm_compare(dup->comm(), comm.comm(), &result);
+        REQUIRE(result == MPI_CONGRUENT);
+
+        // Clones share the duplicate
+        auto copy = dup->clone();
+        REQUIRE(*copy == *dup);
+    }
+
     SECTION("comm()") {
         int result;
         MPI_Comm_compare(comm.comm(), MPI_COMM_WORLD, &result);
@@ -176,6 +193,348 @@ TEST_CASE("CommPPPIMPL") {
         REQUIRE(me == corr);
     }
 
+    SECTION("hierarchical_threshold()") {
+        using limits = std::numeric_limits<std::size_t>;
+        REQUIRE(comm.hierarchical_threshold() == limits::max());
+        comm.set_hierarchical_threshold(1024);
+        REQUIRE(comm.hierarchical_threshold() == 1024);
+
+        // Carried over by copies and duplicates
+        REQUIRE(comm.clone()->hierarchical_threshold() == 1024);
+        REQUIRE(comm.duplicate()->hierarchical_threshold() == 1024);
+    }
+
+    SECTION("tuning()") {
+        REQUIRE(comm.tuning() == pimpl_type::tuning_type{});
+        pimpl_type::tuning_type tuning;
+        tuning.eager_threshold = 64;
+        comm.set_tuning(tuning);
+        REQUIRE(comm.tuning() == tuning);
+
+        // set_hierarchical_threshold sets the tuning's member
+        comm.set_hierarchical_threshold(1024);
+        REQUIRE(comm.tuning().hierarchical_threshold == 1024);
+
+        // Carried over by copies and duplicates
+        REQUIRE(comm.clone()->tuning() == comm.tuning());
+        REQUIRE(comm.duplicate()->tuning() == comm.tuning());
+
+        // Turning compression off in the tuning keeps the codec
+        comm.set_compression(std::make_shared<ZeroRunCodec>(), 0);
+        tuning.compress = false;
+        comm.set_tuning(tuning);
+        REQUIRE_FALSE(comm.compressing());
+        REQUIRE(comm.codec() != nullptr);
+    }
+
+    SECTION("tune()") {
+        const auto n_nodes = comm.topology().n_nodes();
+        auto tuning        = comm.tune("");
+        REQUIRE(tuning == comm.tuning());
+        REQUIRE(tuning.matches(n_ranks, n_nodes));
+
+        // Everybody measured the same thing
+        std::size_t eager = tuning.eager_threshold;
+        std::size_t max   = 0;
+        MPI_Allreduce(&eager, &max, 1, MPI_UINT64_T, MPI_MAX, comm.comm());
+        REQUIRE(max == eager);
+
+        // Process 0 saves what it measures
+        const auto path = std::filesystem::temp_directory_path() /
+                          "pz_commpp_pimpl_tune_test.txt";
+        if(me == 0) std::filesystem::remove(path);
+        MPI_Barrier(comm.comm());
+        tuning = comm.tune(path);
+        if(me == 0) REQUIRE(pimpl_type::tuning_type::load(path) == tuning);
+
+        // A file for this layout is used as-is
+        tuning.ring_threshold = 12345;
+        if(me == 0) tuning.save(path);
+        MPI_Barrier(comm.comm());
+        REQUIRE(comm.tune(path) == tuning);
+
+        // A file for another layout is replaced
+        tuning.n_procs = n_ranks + 1;
+        if(me == 0) tuning.save(path);
+        MPI_Barrier(comm.comm());
+        REQUIRE(comm.tune(path).n_procs == std::size_t(n_ranks));
+        if(me == 0) std::filesystem::remove(path);
+
+        // Failing to save throws everywhere
+        const auto bad_path = (path / "not_a_directory").string();
+        REQUIRE_THROWS_AS(comm.tune(bad_path), std::runtime_error);
+    }
+
+    SECTION("compression") {
+        std::vector<std::byte> zeros(1000, std::byte{0});
+        std::vector<std::byte> short_data{std::byte{1}, std::byte{2}};
+        pimpl_type::const_binary_reference zeros_view(zeros.data(), 1000);
+        pimpl_type::const_binary_reference short_view(short_data.data(), 2);
+
+        REQUIRE_FALSE(comm.compressing());
+        REQUIRE_THROWS_AS(comm.compress(zeros_view), std::runtime_error);
+        REQUIRE_THROWS_AS(comm.decompress(zeros_view), std::runtime_error);
+
+        comm.set_compression(std::make_shared<ZeroRunCodec>(), 100);
+        REQUIRE(comm.compressing());
+
+        // Carried over by copies and duplicates
+        REQUIRE(comm.clone()->compressing());
+        REQUIRE(comm.duplicate()->compressing());
+
+        auto compressed = comm.compress(zeros_view);
+        REQUIRE(compressed.size() < 20);
+        auto skipped = comm.compress(short_view);
+        REQUIRE(skipped.size() == 9 + 2);
+
+        REQUIRE(comm.decompress(compressed) == make_binary_buffer(zeros));
+        REQUIRE(comm.decompress(skipped) == make_binary_buffer(short_data));
+        REQUIRE_THROWS_AS(comm.decompress(short_view), std::runtime_error);
+
+        const auto& stats = comm.compression_stats();
+        REQUIRE(stats.bytes_in == 1002);
+        REQUIRE(stats.bytes_out == compressed.size() + skipped.size());
+        REQUIRE(stats.n_compressed == 1);
+        REQUIRE(stats.n_skipped == 1);
+
+        comm.reset_compression_stats();
+        REQUIRE(comm.compression_stats().bytes_in == 0);
+        comm.set_compression(nullptr, 0);
+        REQUIRE_FALSE(comm.compressing());
+    }
+
+    SECTION("instrumentation") {
+        using namespace std::chrono_literals;
+        REQUIRE_FALSE(comm.instrumenting());
+        comm.record_serialization("gather", 1us);
+        REQUIRE(comm.comm_stats().ops.empty());
+
+        comm.set_instrumentation(true);
+        auto copy = comm.clone();
+        auto dup  = comm.duplicate();
+        REQUIRE(copy->instrumenting());
+        REQUIRE(dup->instrumenting());
+
+        std::vector<int> in{1, 2, 3};
+        std::vector<int> out(3 * n_ranks);
+        comm.gather(pimpl_type::const_binary_reference(in.data(), 3),
+                    pimpl_type::binary_reference(out.data(), out.size()));
+        comm.record_serialization("allgather", 1us);
+
+        // Copies share the statistics, duplicates have their own
+        const auto stats = copy->comm_stats();
+        REQUIRE(dup->comm_stats().ops.empty());
+        const auto& allgather = stats.ops.at("allgather");
+        REQUIRE(allgather.n_calls == 1);
+        REQUIRE(allgather.bytes_sent == 3 * sizeof(int));
+        REQUIRE(allgather.bytes_received == out.size() * sizeof(int));
+        REQUIRE(allgather.serialization_time == 1us);
+
+        comm.reset_comm_stats();
+        REQUIRE(copy->comm_stats().ops.empty());
+        comm.set_instrumentation(false);
+        REQUIRE_FALSE(copy->instrumenting());
+    }
+
+    SECTION("reduce()") {
+        std::vector<int> in{me, 1};
+        std::vector<int> out(2, 0);
+        const int sum = n_ranks * (n_ranks - 1) / 2;
+        const std::vector<int> corr{sum, n_ranks};
+
+        comm.reduce(in.data(), out.data(), 2, MPI_INT, MPI_SUM, std::nullopt);
+        REQUIRE(out == corr);
+
+        std::fill(out.begin(), out.end(), 0);
+        comm.reduce(in.data(), out.data(), 2, MPI_INT, MPI_SUM, 0);
+        REQUIRE(out == (me == 0 ? corr : std::vector<int>(2, 0)));
+
+        std::fill(out.begin(), out.end(), 0);
+        auto request =
+          comm.ireduce(in.data(), out.data(), 2, MPI_INT, MPI_SUM, 0);
+        MPI_Wait(&request, MPI_STATUS_IGNORE);
+        REQUIRE(out == (me == 0 ? corr : std::vector<int>(2, 0)));
+    }
+
+    SECTION("topology()") {
+        REQUIRE(comm.topology().n_nodes() == 1);
+
+        comm.set_node_color(me / 2);
+        REQUIRE(comm.topology().n_nodes() == (n_ranks + 1) / 2);
+
+        // Clones made afterwards share the layout
+        auto copy = comm.clone();
+        REQUIRE(&copy->topology() == &comm.topology());
+    }
+
+    SECTION("hierarchical gather") {
+        // Nodes which are blocks of ranks and nodes which aren't
+        using algorithm = pimpl_type::algorithm;
+        const auto flat = algorithm::flat;
+        const auto hier = algorithm::hierarchical;
+        for(int n_per_node : {2, 3}) {
+            for(auto color : {me / n_per_node, me % n_per_node}) {
+                comm.set_node_color(color);
+
+                std::vector<double> data(3, me);
+                ConstBinaryView view(data.data(), data.size());
+                auto corr = comm.gather(view, std::nullopt, flat);
+                REQUIRE(comm.gather(view, std::nullopt, hier) == corr);
+
+                // Rank r sends r + 1 doubles
+                std::vector<double> vdata(me + 1, me);
+                ConstBinaryView vview(vdata.data(), vdata.size());
+                auto vcorr = comm.gatherv(vview, std::nullopt, flat);
+                REQUIRE(comm.gatherv(vview, std::nullopt, hier) == vcorr);
+
+                // Automatic picks hierarchical when over the threshold
+                comm.set_hierarchical_threshold(0);
+                REQUIRE(comm.gatherv(vview) == vcorr);
+                comm.set_hierarchical_threshold(
+                  std::numeric_limits<std::size_t>::max());
+            }
+        }
+    }
+
+    SECTION("ring gather") {
+        using algorithm = pimpl_type::algorithm;
+        const auto flat = algorithm::flat;
+        const auto ring = algorithm::ring;
+
+        std::vector<double> data(3, me);
+        ConstBinaryView view(data.data(), data.size());
+        auto corr = comm.gather(view, std::nullopt, flat);
+        REQUIRE(comm.gather(view, std::nullopt, ring) == corr);
+
+        // Rank r sends r doubles, so rank 0 sends nothing
+        std::vector<double> vdata(me, me);
+        ConstBinaryView vview(vdata.data(), vdata.size());
+        auto vcorr = comm.gatherv(vview, std::nullopt, flat);
+        REQUIRE(comm.gatherv(vview, std::nullopt, ring) == vcorr);
+
+        // Automatic picks a ring when over the threshold (and size() > 2)
+        pimpl_type::tuning_type tuning;
+        tuning.ring_threshold = 0;
+        comm.set_tuning(tuning);
+        REQUIRE(comm.gather(view) == corr);
+        REQUIRE(comm.gatherv(vview) == vcorr);
+    }
+
+    SECTION("eager gatherv") {
+        using algorithm  = pimpl_type::algorithm;
+        const auto flat  = algorithm::flat;
+        const auto eager = algorithm::eager;
+
+        // Rank r sends r + 1 doubles
+        std::vector<double> data(me + 1, me);
+        ConstBinaryView view(data.data(), data.size());
+        auto corr = comm.gatherv(view, std::nullopt, flat);
+
+        // Explicitly eager uses 1 KiB slots
+        REQUIRE(comm.gatherv(view, std::nullopt, eager) == corr);
+
+        // Every block fits
+        pimpl_type::tuning_type tuning;
+        tuning.eager_threshold = sizeof(double) * n_ranks;
+        comm.set_tuning(tuning);
+        REQUIRE(comm.gatherv(view) == corr);
+
+        // Only rank 0's block fits, so the rest go in a second step
+        tuning.eager_threshold = sizeof(double);
+        comm.set_tuning(tuning);
+        REQUIRE(comm.gatherv(view) == corr);
+
+        // The slots would be too big, so automatic all gathervs are two-phase
+        tuning.eager_threshold = pimpl_type::tuning_type::max_eager_bytes;
+        comm.set_tuning(tuning);
+        REQUIRE_FALSE(tuning.goes_eager(n_ranks));
+        REQUIRE(comm.gatherv(view) == corr);
+
+        // Rooted gathervs are never eager
+        REQUIRE(comm.gatherv(view, 0) == comm.gatherv(view, 0, flat));
+    }
+
+    SECTION("tag()") {
+        auto hello = comm.tag("hello");
+        REQUIRE(comm.tag("hello") == hello);
+
+        // Clones share the registry
+        auto copy = comm.clone();
+        REQUIRE(copy->tag("hello") == hello);
+    }
+
+    SECTION("alltoall()") {
+        // Rank r sends r * 100 + d to rank d
+        std::vector<double> data, corr;
+        for(int d = 0; d < n_ranks; ++d) {
+            data.push_back(me * 100 + d);
+            corr.push_back(d * 100 + me);
+        }
+        std::vector<double> out(n_ranks);
+        ConstBinaryView send(data.data(), data.size());
+        comm.alltoall(send, BinaryView(out.data(), out.size()));
+        REQUIRE(out == corr);
+
+        BinaryView too_small(out.data(), out.size() - 1);
+        REQUIRE_THROWS_AS(comm.alltoall(send, too_small), std::runtime_error);
+    }
+
+    SECTION("alltoallv()") {
+        // Rank r sends d + 1 bytes to rank d, all equal to r
+        std::vector<MPI_Count> sizes, out_sizes;
+        std::vector<MPI_Aint> disp, out_disp;
+        std::vector<std::byte> data;
+        for(int d = 0, total = 0; d < n_ranks; ++d) {
+            sizes.push_back(d + 1);
+            disp.push_back(data.size());
+            for(int i = 0; i <= d; ++i) data.push_back(std::byte(me));
+            out_sizes.push_back(me + 1);
+            out_disp.push_back(total);
+            total += me + 1;
+        }
+        std::vector<std::byte> out(n_ranks * (me + 1));
+        ConstBinaryView send(data.data(), data.size());
+        BinaryView recv(out.data(), out.size());
+        comm.alltoallv(send, sizes, disp, recv, out_sizes, out_disp);
+        for(int r = 0; r < n_ranks; ++r)
+            for(int i = 0; i <= me; ++i)
+                REQUIRE(out[out_disp[r] + i] == std::byte(r));
+    }
+
+    SECTION("point-to-point") {
+        // Rank r sends r + 1 doubles to the next rank
+        const int next = (me + 1) % n_ranks;
+        const int prev = (me + n_ranks - 1) % n_ranks;
+        const int tag  = comm.tag("point-to-point");
+        std::vector<double> data(me + 1, me);
+        std::vector<double> corr(prev + 1, prev);
+        ConstBinaryView send(data.data(), data.size());
+
+        SECTION("blocking") {
+            if(me % 2 == 0) comm.send(send, next, tag);
+            auto probed = comm.probe(prev, tag, true);
+            REQUIRE(probed.has_value());
+            auto& [message, n_bytes] = *probed;
+            REQUIRE(n_bytes == MPI_Count(corr.size() * sizeof(double)));
+            std::vector<double> out(corr.size());
+            comm.recv(message, BinaryView(out.data(), out.size()));
+            REQUIRE(out == corr);
+            if(me % 2 == 1) comm.send(send, next, tag);
+        }
+
+        SECTION("nonblocking") {
+            auto request = comm.isend(send, next, tag);
+            auto probed  = comm.probe(prev, tag, false);
+            while(!probed.has_value()) probed = comm.probe(prev, tag, false);
+            auto& [message, n_bytes] = *probed;
+            std::vector<double> out(n_bytes / sizeof(double));
+            auto recv = comm.irecv(message, BinaryView(out.data(), out.size()));
+            MPI_Wait(&recv, MPI_STATUS_IGNORE);
+            MPI_Wait(&request, MPI_STATUS_IGNORE);
+            REQUIRE(out == corr);
+        }
+    }
+
     // These loops test various MPI operations under different roots and
     // different message sizes.
 
@@ -194,6 +553,21 @@ TEST_CASE("CommPPPIMPL") {
             gather_buffer_kernel<double>(chunk_size, std::nullopt, comm);
         }
 
+        SECTION("(all) gather in place" + chunk_str) {
+            std::vector<double> data(n_ranks * chunk_size, -1.0);
+            auto my_block = data.begin() + me * chunk_size;
+            std::fill(my_block, my_block + chunk_size, double(me));
+            comm.gather_in_place(BinaryView(data.data(), data.size()));
+            for(std::size_t i = 0; i < data.size(); ++i)
+                REQUIRE(data[i] == double(i / chunk_size));
+
+            auto p_bytes = reinterpret_cast<std::byte*>(data.data());
+            BinaryView uneven(p_bytes, data.size() * sizeof(double) - 1);
+            if(n_ranks > 1)
+                REQUIRE_THROWS_AS(comm.gather_in_place(uneven),
+                                  std::runtime_error);
+        }
+
         SECTION("(all) gatherv" + chunk_str) {
             gatherv_kernel<std::byte>(chunk_size, std::nullopt, comm);
             gatherv_kernel<double>(chunk_size, std::nullopt, comm);
@@ -221,6 +595,46 @@ TEST_CASE("CommPPPIMPL") {
 
                 gatherv_kernel<double>(chunk_size, root, comm);
             }
+
+            SECTION("scatter" + root_str + chunk_str) {
+                std::vector<double> data(n_ranks * chunk_size);
+                std::iota(data.begin(), data.end(), 0.0);
+                std::vector<double> out(chunk_size);
+                ConstBinaryView send(data.data(), data.size());
+                comm.scatter(send, BinaryView(out.data(), out.size()), root);
+                std::vector<double> corr(chunk_size);
+                std::iota(corr.begin(), corr.end(), me * chunk_size);
+                REQUIRE(out == corr);
+            }
+
+            SECTION("scatterv" + root_str + chunk_str) {
+                // Rank r gets r + 1 bytes
+                std::vector<MPI_Count> sizes;
+                std::vector<MPI_Aint> disp;
+                for(int r = 0, total = 0; r < n_ranks; ++r) {
+                    disp.push_back(total);
+                    sizes.push_back(r + 1);
+                    total += r + 1;
+                }
+                std::vector<std::byte> data(disp.back() + sizes.back());
+                for(std::size_t i = 0; i < data.size(); ++i)
+                    data[i] = std::byte(i);
+                std::vector<std::byte> out(me + 1);
+                ConstBinaryView send(data.data(), data.size());
+                BinaryView recv(out.data(), out.size());
+                comm.scatterv(send, sizes, disp, recv, root);
+                for(int i = 0; i <= me; ++i)
+                    REQUIRE(out[i] == std::byte(disp[me] + i));
+            }
+
+            SECTION("broadcast" + root_str + chunk_str) {
+                std::vector<double> corr(chunk_size, 3.14);
+                std::vector<double> data(chunk_size, 0.0);
+                if(std::size_t(me) == root) data = corr;
+                BinaryView view(data.data(), data.size());
+                comm.broadcast(view, root);
+                REQUIRE(data == corr);
+            }
         }
     }
 }
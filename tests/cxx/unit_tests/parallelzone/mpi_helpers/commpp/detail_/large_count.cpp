@@ -0,0 +1,295 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_parallelzone.hpp"
+#include <climits>
+#include <numeric>
+#include <parallelzone/mpi_helpers/commpp/detail_/large_count.hpp>
+
+/* Testing Strategy:
+ *
+ * Buffers over 2 GiB are too big for the unit tests, so we instead lower
+ * max_int_count() to a few bytes, which sends the messages below down the
+ * same paths multi-GiB messages would take (with an MPI-3 library). Each
+ * operation is checked with the default limit, with a limit only some of
+ * the blocks (and offsets) fit under, and with a limit none of them fit
+ * under.
+ * A hidden test ("[large]") does a real 2 GiB+ send for manual testing.
+ */
+
+using namespace parallelzone::mpi_helpers::detail_;
+
+namespace {
+
+// Restores the default limit when it goes out of scope
+struct LimitGuard {
+    explicit LimitGuard(count_type n) { set_max_int_count(n); }
+    ~LimitGuard() { set_max_int_count(INT_MAX); }
+};
+
+// Byte i of rank r's data
+std::byte value(int r, count_type i) { return std::byte(r * 31 + i); }
+
+// The first n bytes of rank r's data
+std::vector<std::byte> make_data(int r, count_type n) {
+    std::vector<std::byte> rv(n);
+    for(count_type i = 0; i < n; ++i) rv[i] = value(r, i);
+    return rv;
+}
+
+// Back-to-back offsets for blocks of size sizes
+offset_vector offsets(const count_vector& sizes) {
+    offset_vector rv(sizes.size(), 0);
+    for(std::size_t i = 1; i < sizes.size(); ++i)
+        rv[i] = rv[i - 1] + sizes[i - 1];
+    return rv;
+}
+
+} // namespace
+
+TEST_CASE("max_int_count") {
+    REQUIRE(max_int_count() == INT_MAX);
+    {
+        LimitGuard guard(3);
+        REQUIRE(max_int_count() == 3);
+        set_max_int_count(0);
+        REQUIRE(max_int_count() == 1);
+        set_max_int_count(count_type(INT_MAX) + 1);
+        REQUIRE(max_int_count() == INT_MAX);
+    }
+    REQUIRE(max_int_count() == INT_MAX);
+}
+
+TEST_CASE("ByteType") {
+    SECTION("Fits in an int") {
+        ByteType t(10);
+        REQUIRE(t.count() == 10);
+        REQUIRE(t.type() == MPI_BYTE);
+    }
+
+    SECTION("Does not fit in an int") {
+        LimitGuard guard(3);
+        for(count_type n : {4, 9, 10}) {
+            ByteType t(n);
+            REQUIRE(t.count() == 1);
+            MPI_Count size = 0, lb = 0, extent = 0;
+            MPI_Type_size_x(t.type(), &size);
+            MPI_Type_get_extent_x(t.type(), &lb, &extent);
+            REQUIRE(size == n);
+            REQUIRE(lb == 0);
+            REQUIRE(extent == n);
+        }
+    }
+}
+
+TEST_CASE("Large count wrappers") {
+    auto& world = testing::PZEnvironment::comm_world();
+    auto comm   = world.mpi_comm();
+    int me = 0, n_ranks = 0;
+    MPI_Comm_rank(comm, &me);
+    MPI_Comm_size(comm, &n_ranks);
+
+    // Rank r contributes r + 5 bytes to the vector operations
+    count_vector sizes(n_ranks);
+    std::iota(sizes.begin(), sizes.end(), count_type(5));
+    const auto disp  = offsets(sizes);
+    const auto total = disp.back() + sizes.back();
+    const auto mine  = make_data(me, sizes[me]);
+
+    // Rank r's bytes, back-to-back
+    std::vector<std::byte> corr;
+    for(int r = 0; r < n_ranks; ++r) {
+        auto data = make_data(r, sizes[r]);
+        corr.insert(corr.end(), data.begin(), data.end());
+    }
+
+    const count_vector limits{INT_MAX, 8, 3};
+    for(count_type limit : limits) {
+        LimitGuard guard(limit);
+        const auto lstr = " limit = " + std::to_string(limit);
+
+        SECTION("bcast_bytes" + lstr) {
+            for(int root = 0; root < n_ranks; ++root) {
+                auto data = me == root ? make_data(root, 10) :
+                                         std::vector<std::byte>(10);
+                bcast_bytes(data.data(), data.size(), root, comm);
+                REQUIRE(data == make_data(root, 10));
+            }
+        }
+
+        SECTION("gather_bytes" + lstr) {
+            // Everyone sends 7 bytes
+            std::vector<std::byte> corr7;
+            for(int r = 0; r < n_ranks; ++r) {
+                auto data = make_data(r, 7);
+                corr7.insert(corr7.end(), data.begin(), data.end());
+            }
+            auto in = make_data(me, 7);
+            std::vector<std::byte> out(7 * n_ranks);
+
+            gather_bytes(in.data(), 7, out.data(), std::nullopt, comm);
+            REQUIRE(out == corr7);
+
+            std::vector<std::byte>(out.size()).swap(out);
+            gather_bytes(in.data(), 7, out.data(), 0, comm);
+            if(me == 0) REQUIRE(out == corr7);
+
+            std::vector<std::byte>(out.size()).swap(out);
+            auto request = igather_bytes(in.data(), 7, out.data(), 0, comm);
+            MPI_Wait(&request, MPI_STATUS_IGNORE);
+            if(me == 0) REQUIRE(out == corr7);
+        }
+
+        SECTION("gatherv_bytes" + lstr) {
+            std::vector<std::byte> out(total);
+            const opt_root_t all;
+            gatherv_bytes(mine.data(), sizes[me], out.data(), sizes, disp,
+                          all, comm);
+            REQUIRE(out == corr);
+
+            for(int root = 0; root < n_ranks; ++root) {
+                std::vector<std::byte>(total).swap(out);
+                gatherv_bytes(mine.data(), sizes[me], out.data(), sizes, disp,
+                              root, comm);
+                if(me == root) REQUIRE(out == corr);
+            }
+
+            // In place, this rank's bytes are already in out
+            std::vector<std::byte>(total).swap(out);
+            std::copy(mine.begin(), mine.end(), out.begin() + disp[me]);
+            gatherv_bytes(MPI_IN_PLACE, 0, out.data(), sizes, disp, all, comm);
+            REQUIRE(out == corr);
+        }
+
+        SECTION("igatherv_bytes" + lstr) {
+            std::shared_ptr<const void> keep_alive;
+            std::vector<std::byte> out(total);
+            auto request = igatherv_bytes(mine.data(), sizes[me], out.data(),
+                                          sizes, disp, 0, comm, keep_alive);
+            MPI_Wait(&request, MPI_STATUS_IGNORE);
+            if(me == 0) REQUIRE(out == corr);
+
+            std::vector<std::byte>(total).swap(out);
+            request = igatherv_bytes(mine.data(), sizes[me], out.data(), sizes,
+                                     disp, std::nullopt, comm, keep_alive);
+            MPI_Wait(&request, MPI_STATUS_IGNORE);
+            REQUIRE(out == corr);
+        }
+
+        SECTION("scatter_bytes" + lstr) {
+            std::vector<std::byte> corr7;
+            for(int r = 0; r < n_ranks; ++r) {
+                auto data = make_data(r, 7);
+                corr7.insert(corr7.end(), data.begin(), data.end());
+            }
+            std::vector<std::byte> out(7);
+            scatter_bytes(corr7.data(), out.data(), 7, 0, comm);
+            REQUIRE(out == make_data(me, 7));
+        }
+
+        SECTION("scatterv_bytes" + lstr) {
+            for(int root = 0; root < n_ranks; ++root) {
+                std::vector<std::byte> out(sizes[me]);
+                scatterv_bytes(corr.data(), sizes, disp, out.data(), sizes[me],
+                               root, comm);
+                REQUIRE(out == mine);
+            }
+        }
+
+        SECTION("alltoall_bytes" + lstr) {
+            // Rank r sends bytes value(r, 0..6) to everyone
+            std::vector<std::byte> in;
+            for(int r = 0; r < n_ranks; ++r) {
+                auto data = make_data(me, 7);
+                in.insert(in.end(), data.begin(), data.end());
+            }
+            std::vector<std::byte> out(in.size());
+            alltoall_bytes(in.data(), out.data(), 7, comm);
+            std::vector<std::byte> corr7;
+            for(int r = 0; r < n_ranks; ++r) {
+                auto data = make_data(r, 7);
+                corr7.insert(corr7.end(), data.begin(), data.end());
+            }
+            REQUIRE(out == corr7);
+        }
+
+        SECTION("alltoallv_bytes" + lstr) {
+            // Every rank sends its r + 5 bytes to everyone
+            std::vector<std::byte> in;
+            count_vector in_sizes(n_ranks, sizes[me]);
+            for(int r = 0; r < n_ranks; ++r)
+                in.insert(in.end(), mine.begin(), mine.end());
+            std::vector<std::byte> out(total);
+            alltoallv_bytes(in.data(), in_sizes, offsets(in_sizes), out.data(),
+                            sizes, disp, comm);
+            REQUIRE(out == corr);
+        }
+
+        SECTION("point-to-point" + lstr) {
+            // Rank r sends its r + 5 bytes to the next rank
+            const int next = (me + 1) % n_ranks;
+            const int prev = (me + n_ranks - 1) % n_ranks;
+            const auto corr_prev = make_data(prev, sizes[prev]);
+
+            auto request = isend_bytes(mine.data(), sizes[me], next, 1, comm);
+            MPI_Message message;
+            MPI_Status status;
+            MPI_Mprobe(prev, 1, comm, &message, &status);
+            REQUIRE(byte_count(status) == sizes[prev]);
+            std::vector<std::byte> out(sizes[prev]);
+            mrecv_bytes(out.data(), out.size(), message);
+            MPI_Wait(&request, MPI_STATUS_IGNORE);
+            REQUIRE(out == corr_prev);
+
+            if(me % 2 == 0) send_bytes(mine.data(), sizes[me], next, 2, comm);
+            MPI_Mprobe(prev, 2, comm, &message, &status);
+            std::vector<std::byte>(out.size()).swap(out);
+            request = imrecv_bytes(out.data(), out.size(), message);
+            if(me % 2 == 1) send_bytes(mine.data(), sizes[me], next, 2, comm);
+            MPI_Wait(&request, MPI_STATUS_IGNORE);
+            REQUIRE(out == corr_prev);
+        }
+    }
+}
+
+TEST_CASE("Large count wrappers (2 GiB+)", "[.][large]") {
+    auto& world = testing::PZEnvironment::comm_world();
+    auto comm   = world.mpi_comm();
+    int me = 0, n_ranks = 0;
+    MPI_Comm_rank(comm, &me);
+    MPI_Comm_size(comm, &n_ranks);
+
+    // Each rank sends 2 GiB + 16 bytes to the next rank
+    const count_type n = (count_type(1) << 31) + 16;
+    const int next     = (me + 1) % n_ranks;
+    const int prev     = (me + n_ranks - 1) % n_ranks;
+    std::vector<std::byte> out(n);
+    {
+        std::vector<std::byte> in(n, std::byte(me));
+        in.back() = std::byte(me + 1);
+
+        auto request = isend_bytes(in.data(), n, next, 0, comm);
+        MPI_Message message;
+        MPI_Status status;
+        MPI_Mprobe(prev, 0, comm, &message, &status);
+        REQUIRE(byte_count(status) == n);
+        mrecv_bytes(out.data(), n, message);
+        MPI_Wait(&request, MPI_STATUS_IGNORE);
+    }
+    REQUIRE(out.front() == std::byte(prev));
+    REQUIRE(out[n / 2] == std::byte(prev));
+    REQUIRE(out.back() == std::byte(prev + 1));
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../test_parallelzone.hpp"
+#include <algorithm>
+#include <numeric>
+#include <parallelzone/mpi_helpers/commpp/detail_/node_topology.hpp>
+
+/* Testing Strategy:
+ *
+ * The tests run on a single machine, so splitting by shared memory always
+ * gives one node. To test multiple nodes we fake the split with colors: one
+ * where nodes are blocks of consecutive ranks, and one where they are not.
+ */
+
+using namespace parallelzone::mpi_helpers::detail_;
+
+namespace {
+
+// Checks the properties which must hold no matter how the nodes were formed
+void check_consistency(const NodeTopology& topo, int me, int n_ranks) {
+    int node_size = 0;
+    MPI_Comm_size(topo.node_comm(), &node_size);
+    const auto& members = topo.members(topo.node_of(me));
+    REQUIRE(int(members.size()) == node_size);
+    REQUIRE(topo.is_leader() == (members.front() == me));
+
+    if(topo.is_leader()) {
+        int n_leaders = 0;
+        MPI_Comm_size(topo.leader_comm(), &n_leaders);
+        REQUIRE(n_leaders == topo.n_nodes());
+    }
+
+    std::vector<int> corr(n_ranks);
+    std::iota(corr.begin(), corr.end(), 0);
+    auto order = topo.order();
+    REQUIRE(topo.in_order() == (order == corr));
+    std::sort(order.begin(), order.end());
+    REQUIRE(order == corr);
+}
+
+} // namespace
+
+TEST_CASE("NodeTopology") {
+    auto& world = testing::PZEnvironment::comm_world();
+    auto comm   = world.mpi_comm();
+    int me = 0, n_ranks = 0;
+    MPI_Comm_rank(comm, &me);
+    MPI_Comm_size(comm, &n_ranks);
+
+    SECTION("shared memory") {
+        NodeTopology topo(comm, std::nullopt);
+        check_consistency(topo, me, n_ranks);
+        REQUIRE(topo.n_nodes() == 1);
+        REQUIRE(topo.in_order());
+    }
+
+    SECTION("blocks of two") {
+        NodeTopology topo(comm, me / 2);
+        check_consistency(topo, me, n_ranks);
+        REQUIRE(topo.n_nodes() == (n_ranks + 1) / 2);
+        REQUIRE(topo.node_of(me) == me / 2);
+        REQUIRE(topo.in_order());
+    }
+
+    SECTION("round robin") {
+        const int n_nodes = std::min(n_ranks, 2);
+        NodeTopology topo(comm, me % 2);
+        check_consistency(topo, me, n_ranks);
+        REQUIRE(topo.n_nodes() == n_nodes);
+        REQUIRE(topo.node_of(me) == me % 2);
+        REQUIRE(topo.in_order() == (n_ranks < 3));
+    }
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../../catch.hpp"
+#include <parallelzone/mpi_helpers/commpp/detail_/tag_registry.hpp>
+
+/* Testing Strategy:
+ *
+ * TagRegistry is purely local, so we only need to check that names map to
+ * tags consistently, that the tags are in range, and that collisions are
+ * caught. A registry with a single tag is used to force a collision.
+ */
+
+using namespace parallelzone::mpi_helpers::detail_;
+
+TEST_CASE("TagRegistry") {
+    TagRegistry registry(32767);
+    REQUIRE(registry.size() == 0);
+
+    SECTION("tag") {
+        auto hello = registry.tag("hello");
+        REQUIRE(hello >= 0);
+        REQUIRE(hello <= 32767);
+        REQUIRE(registry.size() == 1);
+
+        // Same name, same tag (and no new entry)
+        REQUIRE(registry.tag("hello") == hello);
+        REQUIRE(registry.size() == 1);
+
+        // Different registries agree
+        TagRegistry other(32767);
+        REQUIRE(other.tag("hello") == hello);
+
+        auto world = registry.tag("world");
+        REQUIRE(world != hello);
+        REQUIRE(registry.size() == 2);
+    }
+
+    SECTION("collision") {
+        TagRegistry one_tag(0);
+        REQUIRE(one_tag.tag("hello") == 0);
+        REQUIRE_THROWS_AS(one_tag.tag("world"), std::runtime_error);
+        REQUIRE(one_tag.size() == 1);
+    }
+}
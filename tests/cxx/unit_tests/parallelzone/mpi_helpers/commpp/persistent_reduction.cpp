@@ -0,0 +1,148 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../test_parallelzone.hpp"
+#include <parallelzone/mpi_helpers/commpp/persistent_reduction.hpp>
+#include <limits>
+#include <vector>
+
+/* Testing Strategy:
+ *
+ * PersistentReduction is given its communicator, datatype, and operation
+ * directly, so we can test it without CommPP. The point of the class is that
+ * it can be reused, so most sections run the reduction several times with
+ * different inputs. Which MPI calls are used depends on the MPI version, but
+ * the observable behavior does not.
+ */
+
+using namespace parallelzone::mpi_helpers;
+
+TEST_CASE("PersistentReduction") {
+    using reduction_type = PersistentReduction<int>;
+    using buffer_type    = reduction_type::buffer_type;
+
+    auto& world = testing::PZEnvironment::comm_world();
+    auto comm   = world.mpi_comm();
+    int me, n_ranks;
+    MPI_Comm_rank(comm, &me);
+    MPI_Comm_size(comm, &n_ranks);
+
+    reduction_type defaulted;
+    reduction_type all(comm, 3, MPI_INT, MPI_SUM);
+
+    SECTION("CTors") {
+        SECTION("Default") {
+            REQUIRE_FALSE(defaulted.valid());
+            REQUIRE(defaulted.size() == 0);
+            REQUIRE(defaulted.result().empty());
+        }
+
+        SECTION("value") {
+            REQUIRE(all.valid());
+            REQUIRE(all.size() == 3);
+            REQUIRE(all.result().size() == 3);
+
+            reduction_type rooted(comm, 3, MPI_INT, MPI_SUM, 0);
+            REQUIRE(rooted.valid());
+            REQUIRE(rooted.size() == 3);
+            REQUIRE(rooted.result().size() == (me == 0 ? 3 : 0));
+
+            std::size_t too_many = std::numeric_limits<int>::max();
+            ++too_many;
+            using except_t = std::runtime_error;
+            REQUIRE_THROWS_AS(reduction_type(comm, too_many, MPI_INT, MPI_SUM),
+                              except_t);
+        }
+
+        SECTION("move") {
+            const auto* pinput = all.input();
+            reduction_type moved(std::move(all));
+            REQUIRE(moved.valid());
+            REQUIRE(moved.input() == pinput);
+            REQUIRE_FALSE(all.valid());
+        }
+
+        SECTION("move assignment") {
+            const auto* pinput = all.input();
+            auto pdefaulted    = &(defaulted = std::move(all));
+            REQUIRE(pdefaulted == &defaulted);
+            REQUIRE(defaulted.valid());
+            REQUIRE(defaulted.input() == pinput);
+            REQUIRE_FALSE(all.valid());
+        }
+    }
+
+    SECTION("start/wait") {
+        REQUIRE_THROWS_AS(defaulted.start(), std::runtime_error);
+
+        for(int i = 0; i < 3; ++i) {
+            for(int j = 0; j < 3; ++j) all.input()[j] = me + i * j;
+            all.start();
+            REQUIRE_THROWS_AS(all.start(), std::runtime_error);
+            all.wait();
+
+            buffer_type corr(3);
+            for(int j = 0; j < 3; ++j)
+                corr[j] = n_ranks * (n_ranks - 1) / 2 + n_ranks * i * j;
+            REQUIRE(all.result() == corr);
+        }
+        all.wait(); // No-op if nothing is in flight
+    }
+
+    SECTION("ready") {
+        REQUIRE(defaulted.ready());
+        REQUIRE(all.ready());
+        all.start(buffer_type{1, 2, 3});
+        while(!all.ready()) {}
+        REQUIRE(all.result() == buffer_type{n_ranks, 2 * n_ranks, 3 * n_ranks});
+    }
+
+    SECTION("start(input)") {
+        REQUIRE_THROWS_AS(all.start(buffer_type{1}), std::runtime_error);
+        all.start(std::vector<int>{me, me, me});
+        all.wait();
+        const int corr = n_ranks * (n_ranks - 1) / 2;
+        REQUIRE(all.result() == buffer_type(3, corr));
+    }
+
+    SECTION("operator()") {
+        for(int i = 0; i < 3; ++i) {
+            const auto& rv = all(buffer_type(3, i));
+            REQUIRE(rv == buffer_type(3, i * n_ranks));
+        }
+    }
+
+    SECTION("rooted") {
+        const int root = n_ranks - 1;
+        reduction_type rooted(comm, 2, MPI_INT, MPI_MAX, root);
+        for(int i = 0; i < 3; ++i) {
+            const auto& rv = rooted(buffer_type{me, i});
+            if(me == root) {
+                REQUIRE(rv == buffer_type{n_ranks - 1, i});
+            } else {
+                REQUIRE(rv.empty());
+            }
+        }
+    }
+
+    SECTION("destroyed while in flight") {
+        {
+            reduction_type temp(comm, 3, MPI_INT, MPI_SUM);
+            temp.start(buffer_type(3, 1));
+        }
+        REQUIRE(all(buffer_type(3, 1)) == buffer_type(3, n_ranks));
+    }
+}
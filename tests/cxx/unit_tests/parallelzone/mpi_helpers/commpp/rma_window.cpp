@@ -0,0 +1,206 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../test_parallelzone.hpp"
+#include <algorithm>
+#include <numeric>
+#include <parallelzone/mpi_helpers/commpp/commpp.hpp>
+
+/* Testing Strategy:
+ *
+ * Windows are made by CommPP, so we make them with the world communicator.
+ * Each test has every process act on the next process (in a ring), so that
+ * with more than one process the target is remote, and synchronizes with a
+ * barrier before checking the target's local region.
+ */
+
+using namespace parallelzone::mpi_helpers;
+
+TEST_CASE("RMAWindow") {
+    using lock_type = RMAWindow::lock_type;
+
+    auto& world = testing::PZEnvironment::comm_world();
+    CommPP comm(world.mpi_comm());
+    const int me      = comm.me();
+    const int n_ranks = comm.size();
+    const int next    = (me + 1) % n_ranks;
+    const int prev    = (me + n_ranks - 1) % n_ranks;
+
+    RMAWindow defaulted;
+    auto window = comm.allocate_window((me + 1) * 4 * sizeof(double));
+
+    SECTION("CTors") {
+        SECTION("Default") {
+            REQUIRE(defaulted.window() == MPI_WIN_NULL);
+            REQUIRE(defaulted.size() == 0);
+        }
+
+        SECTION("move") {
+            auto win = window.window();
+            RMAWindow moved(std::move(window));
+            REQUIRE(moved.window() == win);
+            REQUIRE(window.window() == MPI_WIN_NULL);
+        }
+
+        SECTION("move assignment") {
+            auto win      = window.window();
+            auto pdefault = &(defaulted = std::move(window));
+            REQUIRE(pdefault == &defaulted);
+            REQUIRE(defaulted.window() == win);
+        }
+    }
+
+    SECTION("size") { REQUIRE(window.size() == n_ranks); }
+
+    SECTION("region_size") {
+        REQUIRE_THROWS_AS(defaulted.region_size(0), std::runtime_error);
+        for(int r = 0; r < n_ranks; ++r)
+            REQUIRE(window.region_size(r) == (r + 1) * 4 * sizeof(double));
+        REQUIRE_THROWS_AS(window.region_size(n_ranks), std::out_of_range);
+        REQUIRE_THROWS_AS(window.region_size(-1), std::out_of_range);
+    }
+
+    SECTION("local") {
+        REQUIRE_THROWS_AS(defaulted.local(), std::runtime_error);
+        REQUIRE(window.local().size() == (me + 1) * 4 * sizeof(double));
+        auto local = window.local_as<double>();
+        REQUIRE(local.size() == std::size_t(me + 1) * 4);
+        for(auto x : local) REQUIRE(x == 0.0);
+    }
+
+    SECTION("put") {
+        std::vector<double> data{1.0 + me, 2.0 + me};
+        window.lock(next);
+        window.put(data, next, 1);
+        window.unlock(next);
+        MPI_Barrier(comm.comm());
+
+        auto local = window.local_as<double>();
+        REQUIRE(local[0] == 0.0);
+        REQUIRE(local[1] == 1.0 + prev);
+        REQUIRE(local[2] == 2.0 + prev);
+
+        // Rank 0 has the smallest region
+        std::vector<double> too_big(5);
+        REQUIRE_THROWS_AS(window.put(too_big, 0, 0), std::out_of_range);
+        REQUIRE_THROWS_AS(window.put(data, 0, 3), std::out_of_range);
+    }
+
+    SECTION("get") {
+        std::iota(window.local_as<double>().begin(),
+                  window.local_as<double>().end(), me * 100.0);
+        MPI_Barrier(comm.comm());
+
+        std::vector<double> out(3);
+        {
+            RMALockGuard lock(window, next);
+            window.get(out, next, 1);
+            window.flush(next);
+            REQUIRE(out[0] == next * 100.0 + 1);
+        }
+        REQUIRE(out == std::vector<double>{next * 100.0 + 1,
+                                           next * 100.0 + 2,
+                                           next * 100.0 + 3});
+
+        // Into a view
+        std::array<double, 2> arr;
+        window.lock_all();
+        window.get(std::span<double>(arr), next, 0);
+        window.unlock_all();
+        REQUIRE(arr[1] == next * 100.0 + 1);
+        MPI_Barrier(comm.comm());
+    }
+
+    SECTION("accumulate") {
+        // Everyone adds to rank 0, and takes the max on the next rank
+        std::vector<double> ones(2, 1.0);
+        {
+            RMALockGuard lock(window, 0);
+            window.accumulate(ones, 0, 0);
+        }
+        std::vector<double> mine(1, double(me));
+        {
+            RMALockGuard lock(window, next, lock_type::exclusive);
+            window.accumulate(mine, next, 2, maximum<double>());
+        }
+        MPI_Barrier(comm.comm());
+
+        auto local = window.local_as<double>();
+        if(me == 0) REQUIRE(local[0] == double(n_ranks));
+        REQUIRE(local[2] == double(prev));
+    }
+
+    SECTION("fetch_and_op") {
+        // Everyone increments rank 0's first element; the old values are the
+        // order the increments happened in, so each process sees a different
+        // one of 0, 1, ..., n_ranks - 1
+        window.lock(0);
+        const auto old = window.fetch_and_op(1.0, 0, 0);
+        window.unlock(0);
+        auto olds = comm.gather(old);
+        std::sort(olds.begin(), olds.end());
+        std::vector<double> corr(n_ranks);
+        std::iota(corr.begin(), corr.end(), 0.0);
+        REQUIRE(olds == corr);
+        if(me == 0) REQUIRE(window.local_as<double>()[0] == double(n_ranks));
+
+        window.lock(next);
+        window.fetch_and_op(double(me), next, 1, maximum<double>());
+        window.unlock(next);
+        MPI_Barrier(comm.comm());
+        REQUIRE(window.local_as<double>()[1] == double(prev));
+
+        const auto n_next = (next + 1) * 4;
+        REQUIRE_THROWS_AS(window.fetch_and_op(1.0, next, n_next),
+                          std::out_of_range);
+    }
+
+    SECTION("fence") {
+        window.fence();
+        std::vector<double> data{double(me)};
+        window.put(data, next, 0);
+        window.fence();
+        REQUIRE(window.local_as<double>()[0] == double(prev));
+    }
+
+    SECTION("expose") {
+        std::vector<int> region(2, me);
+        auto exposed = comm.expose_window(
+          BinaryView(region.data(), region.size()));
+        REQUIRE(exposed.local_as<int>().data() == region.data());
+
+        std::vector<int> out(2);
+        exposed.lock(next);
+        exposed.get(out, next, 0);
+        exposed.unlock(next);
+        REQUIRE(out == std::vector<int>(2, next));
+        MPI_Barrier(comm.comm());
+    }
+
+    SECTION("no window") {
+        REQUIRE_THROWS_AS(defaulted.lock(0), std::runtime_error);
+        REQUIRE_THROWS_AS(defaulted.fence(), std::runtime_error);
+        std::vector<double> data(1);
+        REQUIRE_THROWS_AS(defaulted.put(data, 0, 0), std::runtime_error);
+    }
+
+    SECTION("swap") {
+        auto win = window.window();
+        window.swap(defaulted);
+        REQUIRE(defaulted.window() == win);
+        REQUIRE(window.window() == MPI_WIN_NULL);
+    }
+}
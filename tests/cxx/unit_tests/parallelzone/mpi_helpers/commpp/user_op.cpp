@@ -0,0 +1,91 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../../test_parallelzone.hpp"
+#include <parallelzone/mpi_helpers/commpp/user_op.hpp>
+#include <vector>
+
+/* Testing Strategy:
+ *
+ * UserOp registers a callable with MPI. We check the state of the resulting
+ * object, that copies share the registration, and that MPI actually calls
+ * the callable, by reducing with MPI_Allreduce directly. The integration with
+ * CommPP::reduce is tested with CommPP.
+ */
+
+using namespace parallelzone::mpi_helpers;
+
+TEST_CASE("UserOp") {
+    using op_type = UserOp<double>;
+
+    auto& world = testing::PZEnvironment::comm_world();
+    auto comm   = world.mpi_comm();
+    int me, n_ranks;
+    MPI_Comm_rank(comm, &me);
+    MPI_Comm_size(comm, &n_ranks);
+
+    // Not commutative, the result is the first rank's value
+    auto first = [](double lhs, double) { return lhs; };
+
+    op_type defaulted;
+    op_type sum(std::plus<double>(), true);
+    op_type first_op(first);
+
+    SECTION("CTors") {
+        SECTION("Default") {
+            REQUIRE_FALSE(defaulted.valid());
+            REQUIRE(defaulted.op() == MPI_OP_NULL);
+            REQUIRE(defaulted.type() == MPI_DATATYPE_NULL);
+            REQUIRE_FALSE(defaulted.commutative());
+        }
+
+        SECTION("value") {
+            REQUIRE(sum.valid());
+            REQUIRE(sum.op() != MPI_OP_NULL);
+            REQUIRE(sum.type() != MPI_DATATYPE_NULL);
+            REQUIRE(sum.commutative());
+
+            REQUIRE(first_op.valid());
+            REQUIRE_FALSE(first_op.commutative());
+            REQUIRE(first_op.op() != sum.op());
+        }
+
+        SECTION("copy") {
+            op_type copy(sum);
+            REQUIRE(copy.op() == sum.op());
+            REQUIRE(copy.type() == sum.type());
+        }
+    }
+
+    SECTION("operator()") {
+        REQUIRE_THROWS_AS(defaulted(1.0, 2.0), std::bad_function_call);
+        REQUIRE(sum(1.0, 2.0) == 3.0);
+        REQUIRE(first_op(1.0, 2.0) == 1.0);
+    }
+
+    SECTION("MPI calls the callable") {
+        std::vector<double> local_data{double(me), 1.0}, rv(2);
+        auto send = local_data.data();
+
+        MPI_Allreduce(send, rv.data(), 2, sum.type(), sum.op(), comm);
+        REQUIRE(rv == std::vector<double>{n_ranks * (n_ranks - 1) / 2.0,
+                                          double(n_ranks)});
+
+        MPI_Allreduce(send, rv.data(), 2, first_op.type(), first_op.op(),
+                      comm);
+        REQUIRE(rv == std::vector<double>{0.0, 1.0});
+    }
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "test_traits.hpp"
+#include <parallelzone/mpi_helpers/traits/contiguous_range.hpp>
+#include <string_view>
+
+/* Testing Strategy:
+ *
+ * contiguous_range should pick up the standard contiguous ranges of trivially
+ * copyable elements and the containers which opt in, and nothing else. The
+ * result types are then checked for owning, fixed-size, and view containers.
+ * Finally we check the helpers CommPP uses to allocate and copy results.
+ */
+
+// N.B. These tests rely on the type lists in test_traits.hpp being up to date
+using namespace parallelzone::mpi_helpers;
+
+TEMPLATE_LIST_TEST_CASE("contiguous_range(false)", "", testing::true_list) {
+    using T = TestType;
+    STATIC_REQUIRE_FALSE(contiguous_range<T>);
+}
+
+TEST_CASE("contiguous_range") {
+    STATIC_REQUIRE(contiguous_range<std::vector<double>>);
+    STATIC_REQUIRE(contiguous_range<const std::array<int, 2>&>);
+    STATIC_REQUIRE(contiguous_range<std::span<const double>>);
+    STATIC_REQUIRE(contiguous_range<std::valarray<double>>);
+    STATIC_REQUIRE(contiguous_range<std::string_view>);
+    STATIC_REQUIRE(contiguous_range<testing::Block>);
+    STATIC_REQUIRE_FALSE(contiguous_range<double>);
+
+    // Opting in requires data() and size()
+    STATIC_REQUIRE(std::is_same_v<contiguous_value_t<testing::Block>, double>);
+    STATIC_REQUIRE(std::is_same_v<contiguous_value_t<std::span<const int>>,
+                                  int>);
+}
+
+TEST_CASE("contiguous_result_t") {
+    using vector_type = std::vector<double>;
+    STATIC_REQUIRE(std::is_same_v<contiguous_result_t<vector_type>,
+                                  vector_type>);
+    STATIC_REQUIRE(std::is_same_v<contiguous_result_t<std::string>,
+                                  std::string>);
+    STATIC_REQUIRE(std::is_same_v<contiguous_result_t<testing::Block>,
+                                  testing::Block>);
+    STATIC_REQUIRE(std::is_same_v<contiguous_result_t<BinaryBuffer>,
+                                  BinaryBuffer>);
+    STATIC_REQUIRE(std::is_same_v<contiguous_result_t<BinaryView>,
+                                  BinaryBuffer>);
+
+    // Containers which can't be resized
+    using array_type = std::array<double, 3>;
+    using span_type  = std::span<const double>;
+    STATIC_REQUIRE(std::is_same_v<contiguous_result_t<array_type>,
+                                  vector_type>);
+    STATIC_REQUIRE(std::is_same_v<contiguous_result_t<span_type>,
+                                  vector_type>);
+    STATIC_REQUIRE(std::is_same_v<contiguous_result_t<std::valarray<double>>,
+                                  vector_type>);
+
+    // Non-contiguous types map to themselves
+    using map_type = std::map<int, int>;
+    STATIC_REQUIRE(std::is_same_v<contiguous_result_t<map_type>, map_type>);
+}
+
+TEST_CASE("contiguous_owner_t") {
+    using vector_type = std::vector<double>;
+    using array_type  = std::array<double, 3>;
+    STATIC_REQUIRE(std::is_same_v<contiguous_owner_t<vector_type>,
+                                  vector_type>);
+    STATIC_REQUIRE(std::is_same_v<contiguous_owner_t<array_type>,
+                                  array_type>);
+    STATIC_REQUIRE(std::is_same_v<contiguous_owner_t<std::span<double>>,
+                                  vector_type>);
+    STATIC_REQUIRE(std::is_same_v<contiguous_owner_t<std::string_view>,
+                                  std::vector<char>>);
+    STATIC_REQUIRE(std::is_same_v<contiguous_owner_t<ConstBinaryView>,
+                                  BinaryBuffer>);
+}
+
+TEST_CASE("contiguous helpers") {
+    using namespace parallelzone::mpi_helpers::detail_;
+
+    SECTION("make_contiguous") {
+        REQUIRE(make_contiguous<std::vector<int>>(3) == std::vector<int>(3));
+        REQUIRE(make_contiguous<BinaryBuffer>(4).size() == 4);
+        REQUIRE(make_contiguous<testing::Block>(2) == testing::Block(2));
+    }
+
+    SECTION("resize_contiguous") {
+        std::array<int, 2> a{1, 2};
+        resize_contiguous(a, 2);
+        REQUIRE(a == std::array<int, 2>{1, 2});
+        REQUIRE_THROWS_AS(resize_contiguous(a, 3), std::runtime_error);
+    }
+
+    SECTION("to_contiguous_owner") {
+        std::vector<int> v{1, 2, 3};
+        auto copy = to_contiguous_owner(std::span<const int>(v));
+        REQUIRE(copy == v);
+        REQUIRE(copy.data() != v.data());
+
+        // Owning containers are moved
+        const auto* p = v.data();
+        auto moved    = to_contiguous_owner(std::move(v));
+        REQUIRE(moved.data() == p);
+
+        std::valarray<int> va{4, 5};
+        REQUIRE(contiguous_size(va) == 2);
+        REQUIRE(*contiguous_data(va) == 4);
+    }
+}
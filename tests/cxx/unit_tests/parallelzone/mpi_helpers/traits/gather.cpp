@@ -22,8 +22,9 @@ using namespace parallelzone::mpi_helpers;
 
 TEMPLATE_LIST_TEST_CASE("gather_return_t(no serialization)", "",
                         testing::false_list) {
-    using T = TestType;
-    STATIC_REQUIRE(std::is_same_v<gather_return_t<T>, std::optional<T>>);
+    using T    = TestType;
+    using corr = std::optional<contiguous_result_t<T>>;
+    STATIC_REQUIRE(std::is_same_v<gather_return_t<T>, corr>);
 }
 
 TEMPLATE_LIST_TEST_CASE("gather_return_t(needs serialized)", "",
@@ -15,26 +15,50 @@
  */
 
 #include "../../catch.hpp"
+#include <cstddef>
+#include <cstdint>
 #include <parallelzone/mpi_helpers/traits/mpi_data_type.hpp>
 
 using namespace parallelzone::mpi_helpers;
 
+namespace {
+// Has padding between the members
+struct IdxVal {
+    int idx;
+    double val;
+};
+
+// Has an array member, a registered struct member, and an unsent member
+struct Nested {
+    char tag;
+    double xyz[3];
+    IdxVal pair;
+    int unsent;
+};
+} // namespace
+
+PZ_REGISTER_MPI_STRUCT(IdxVal, &IdxVal::idx, &IdxVal::val);
+PZ_REGISTER_MPI_STRUCT(Nested, &Nested::tag, &Nested::xyz, &Nested::pair);
+
 #define REGISTER_TYPE(cxx_type, mpi_type)                                 \
     REQUIRE(mpi_data_type_v<cxx_type> == mpi_type);                       \
     STATIC_REQUIRE(                                                       \
       std::is_same_v<enable_if_has_mpi_data_type_t<cxx_type, int>, int>); \
-    STATIC_REQUIRE(has_mpi_data_type_v<cxx_type>)
+    STATIC_REQUIRE(has_mpi_data_type_v<cxx_type>);                        \
+    STATIC_REQUIRE(is_predefined_mpi_type_v<cxx_type>)
 
 TEST_CASE("MPIDataType") {
     REGISTER_TYPE(char, MPI_CHAR);
     REGISTER_TYPE(signed short, MPI_SHORT);
     REGISTER_TYPE(signed int, MPI_INT);
     REGISTER_TYPE(signed long, MPI_LONG);
+    REGISTER_TYPE(signed long long, MPI_LONG_LONG);
     REGISTER_TYPE(signed char, MPI_SIGNED_CHAR);
     REGISTER_TYPE(unsigned char, MPI_UNSIGNED_CHAR);
     REGISTER_TYPE(unsigned short, MPI_UNSIGNED_SHORT);
     REGISTER_TYPE(unsigned int, MPI_UNSIGNED);
     REGISTER_TYPE(unsigned long int, MPI_UNSIGNED_LONG);
+    REGISTER_TYPE(unsigned long long, MPI_UNSIGNED_LONG_LONG);
     REGISTER_TYPE(float, MPI_FLOAT);
     REGISTER_TYPE(double, MPI_DOUBLE);
     REGISTER_TYPE(long double, MPI_LONG_DOUBLE);
@@ -43,6 +67,79 @@ TEST_CASE("MPIDataType") {
     REGISTER_TYPE(std::complex<double>, MPI_C_DOUBLE_COMPLEX);
     REGISTER_TYPE(std::complex<long double>, MPI_C_LONG_DOUBLE_COMPLEX);
     REGISTER_TYPE(std::byte, MPI_BYTE);
+    REGISTER_TYPE(ValueLoc<float>, MPI_FLOAT_INT);
+    REGISTER_TYPE(ValueLoc<double>, MPI_DOUBLE_INT);
+    REGISTER_TYPE(ValueLoc<long double>, MPI_LONG_DOUBLE_INT);
+    REGISTER_TYPE(ValueLoc<signed short>, MPI_SHORT_INT);
+    REGISTER_TYPE(ValueLoc<signed int>, MPI_2INT);
+    REGISTER_TYPE(ValueLoc<signed long>, MPI_LONG_INT);
+
+    // Fixed-width aliases map to whichever built-in type they alias
+    STATIC_REQUIRE(has_mpi_data_type_v<std::int64_t>);
+    STATIC_REQUIRE(has_mpi_data_type_v<std::uint64_t>);
 }
 
 #undef REGISTER_TYPE
+
+TEST_CASE("ValueLoc") {
+    using pair_type = ValueLoc<double>;
+    // Must have the same layout as MPI's pair type
+    MPI_Aint lb, extent;
+    MPI_Type_get_extent(MPI_DOUBLE_INT, &lb, &extent);
+    REQUIRE(extent == sizeof(pair_type));
+    REQUIRE(offsetof(pair_type, loc) == sizeof(double));
+
+    pair_type p{1.0, 2};
+    REQUIRE(p.value == 1.0);
+    REQUIRE(p.loc == 2);
+    REQUIRE(p == pair_type{1.0, 2});
+    REQUIRE(p != pair_type{1.0, 3});
+    REQUIRE(p != pair_type{2.0, 2});
+}
+
+TEST_CASE("MPIStruct") {
+    STATIC_REQUIRE(has_mpi_data_type_v<IdxVal>);
+    STATIC_REQUIRE(has_mpi_data_type_v<Nested>);
+    STATIC_REQUIRE_FALSE(is_predefined_mpi_type_v<IdxVal>);
+    STATIC_REQUIRE_FALSE(is_predefined_mpi_type_v<Nested>);
+    STATIC_REQUIRE_FALSE(is_predefined_mpi_type_v<std::string>);
+
+    SECTION("type") {
+        auto type = MPIDataType<IdxVal>::type();
+        REQUIRE(type == MPIDataType<IdxVal>::type()); // Cached
+        int size;
+        MPI_Aint lb, extent;
+        MPI_Type_size(type, &size);
+        MPI_Type_get_extent(type, &lb, &extent);
+        REQUIRE(size == sizeof(int) + sizeof(double));
+        REQUIRE(lb == 0);
+        REQUIRE(extent == sizeof(IdxVal));
+    }
+
+    SECTION("nested") {
+        auto type = MPIDataType<Nested>::type();
+        int size;
+        MPI_Aint lb, extent;
+        MPI_Type_size(type, &size);
+        MPI_Type_get_extent(type, &lb, &extent);
+        REQUIRE(size == 1 + 4 * sizeof(double) + sizeof(int));
+        REQUIRE(extent == sizeof(Nested));
+    }
+
+    SECTION("Round trip") {
+        // Sends an array to ourselves, the unsent member is left alone
+        auto type = MPIDataType<Nested>::type();
+        Nested in[2]{{'a', {1.0, 2.0, 3.0}, {4, 5.0}, 6},
+                     {'b', {7.0, 8.0, 9.0}, {10, 11.0}, 12}};
+        Nested out[2]{};
+        MPI_Sendrecv(in, 2, type, 0, 0, out, 2, type, 0, 0, MPI_COMM_SELF,
+                     MPI_STATUS_IGNORE);
+        for(int i = 0; i < 2; ++i) {
+            REQUIRE(out[i].tag == in[i].tag);
+            REQUIRE(out[i].xyz[2] == in[i].xyz[2]);
+            REQUIRE(out[i].pair.idx == in[i].pair.idx);
+            REQUIRE(out[i].pair.val == in[i].pair.val);
+            REQUIRE(out[i].unsent == 0);
+        }
+    }
+}
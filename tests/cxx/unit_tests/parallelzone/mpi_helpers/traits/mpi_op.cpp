@@ -43,4 +43,47 @@ TEMPLATE_LIST_TEST_CASE("MPIOp", "", test_types) {
 
     STATIC_REQUIRE(has_mpi_op_v<std::bit_xor<T>>);
     REQUIRE(mpi_op_v<std::bit_xor<T>> == MPI_BXOR);
+
+    STATIC_REQUIRE(has_mpi_op_v<minimum<T>>);
+    REQUIRE(mpi_op_v<minimum<T>> == MPI_MIN);
+
+    STATIC_REQUIRE(has_mpi_op_v<maximum<T>>);
+    REQUIRE(mpi_op_v<maximum<T>> == MPI_MAX);
+
+    STATIC_REQUIRE(has_mpi_op_v<min_loc<ValueLoc<T>>>);
+    REQUIRE(mpi_op_v<min_loc<ValueLoc<T>>> == MPI_MINLOC);
+
+    STATIC_REQUIRE(has_mpi_op_v<max_loc<ValueLoc<T>>>);
+    REQUIRE(mpi_op_v<max_loc<ValueLoc<T>>> == MPI_MAXLOC);
+
+    STATIC_REQUIRE_FALSE(has_mpi_op_v<std::minus<T>>);
+}
+
+TEMPLATE_LIST_TEST_CASE("Reduction functors", "", test_types) {
+    using T         = TestType;
+    using pair_type = ValueLoc<T>;
+
+    SECTION("minimum") {
+        REQUIRE(minimum<T>()(T{1}, T{2}) == T{1});
+        REQUIRE(minimum<T>()(T{2}, T{1}) == T{1});
+    }
+
+    SECTION("maximum") {
+        REQUIRE(maximum<T>()(T{1}, T{2}) == T{2});
+        REQUIRE(maximum<T>()(T{2}, T{1}) == T{2});
+    }
+
+    SECTION("min_loc") {
+        min_loc<pair_type> op;
+        REQUIRE(op(pair_type{1, 3}, pair_type{2, 0}) == pair_type{1, 3});
+        REQUIRE(op(pair_type{2, 0}, pair_type{1, 3}) == pair_type{1, 3});
+        REQUIRE(op(pair_type{1, 3}, pair_type{1, 2}) == pair_type{1, 2});
+    }
+
+    SECTION("max_loc") {
+        max_loc<pair_type> op;
+        REQUIRE(op(pair_type{1, 3}, pair_type{2, 0}) == pair_type{2, 0});
+        REQUIRE(op(pair_type{2, 0}, pair_type{1, 3}) == pair_type{2, 0});
+        REQUIRE(op(pair_type{2, 3}, pair_type{2, 2}) == pair_type{2, 2});
+    }
 }
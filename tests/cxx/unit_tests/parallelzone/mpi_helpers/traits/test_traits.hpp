@@ -15,22 +15,57 @@
  */
 
 #include "../../catch.hpp"
+#include <array>
 #include <map>
 #include <parallelzone/mpi_helpers/binary_buffer/binary_buffer.hpp>
+#include <span>
+#include <valarray>
 #include <vector>
 
 namespace testing {
 
+// A container which only exposes its elements through data() and size()
+class Block {
+public:
+    using value_type = double;
+
+    Block() = default;
+    explicit Block(std::size_t n) : m_data_(n) {}
+
+    double* data() noexcept { return m_data_.data(); }
+    const double* data() const noexcept { return m_data_.data(); }
+    std::size_t size() const noexcept { return m_data_.size(); }
+    void resize(std::size_t n) { m_data_.resize(n); }
+
+    bool operator==(const Block& rhs) const = default;
+
+private:
+    std::vector<double> m_data_;
+};
+
+} // namespace testing
+
+// Block opts in to being sent as raw bytes
+template<>
+struct parallelzone::mpi_helpers::IsContiguousContainer<testing::Block>
+  : std::true_type {};
+
+namespace testing {
+
 // List of types we do not need to serialize
 using false_list =
   std::tuple<std::string, std::vector<double>, std::vector<int>,
+             std::array<double, 3>, std::span<const double>,
+             std::valarray<double>, Block,
              parallelzone::mpi_helpers::BinaryBuffer,
              parallelzone::mpi_helpers::BinaryView,
              parallelzone::mpi_helpers::ConstBinaryView>;
 
 // List of types we haven't been told not to serialize
-using true_list = std::tuple<std::map<int, int>, std::vector<std::string>,
-                             std::vector<std::vector<int>>>;
+using true_list =
+  std::tuple<std::map<int, int>, std::vector<std::string>,
+             std::vector<std::vector<int>>, std::vector<bool>,
+             std::array<std::string, 2>>;
 
 using have_mpi_data_type_list =
   std::tuple<char, signed short, short, signed int, int, signed long, long,
@@ -44,6 +44,13 @@ TEST_CASE("RuntimeViewPIMPL") {
     SECTION("CTor") {
         REQUIRE_FALSE(pimpl.m_did_i_start_mpi);
         REQUIRE(pimpl.m_comm == comm);
+
+        // The library's communicator is a duplicate of the user's
+        REQUIRE(pimpl.m_library_comm.size() == comm.size());
+        REQUIRE(pimpl.m_library_comm.me() == comm.me());
+        int result;
+        MPI_Comm_compare(pimpl.m_library_comm.comm(), comm.comm(), &result);
+        REQUIRE(result == MPI_CONGRUENT);
     }
 
     SECTION("at") {
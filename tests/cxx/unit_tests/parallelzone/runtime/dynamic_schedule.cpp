@@ -0,0 +1,71 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_parallelzone.hpp"
+#include <parallelzone/runtime/dynamic_schedule.hpp>
+
+using namespace parallelzone::runtime;
+
+/* Testing Strategy:
+ *
+ * DynamicSchedule is a simple value type; that the schedules actually hand
+ * out every task exactly once is tested by RuntimeView::for_each_dynamic.
+ */
+TEST_CASE("DynamicSchedule") {
+    using kind_type = DynamicSchedule::kind_type;
+
+    DynamicSchedule defaulted;
+    DynamicSchedule fixed(kind_type::fixed, 4);
+    DynamicSchedule guided(kind_type::guided, 2);
+
+    SECTION("CTors") {
+        SECTION("Default") {
+            REQUIRE(defaulted.kind() == kind_type::fixed);
+            REQUIRE(defaulted.chunk_size() == 1);
+        }
+
+        SECTION("Value") {
+            REQUIRE(fixed.kind() == kind_type::fixed);
+            REQUIRE(fixed.chunk_size() == 4);
+            REQUIRE(guided.kind() == kind_type::guided);
+            REQUIRE(guided.chunk_size() == 2);
+
+            REQUIRE_THROWS_AS(DynamicSchedule(kind_type::fixed, 0),
+                              std::runtime_error);
+        }
+
+        SECTION("fixed") {
+            REQUIRE(DynamicSchedule::fixed(4) == fixed);
+            REQUIRE_THROWS_AS(DynamicSchedule::fixed(0), std::runtime_error);
+        }
+
+        SECTION("guided") {
+            REQUIRE(DynamicSchedule::guided(2) == guided);
+            REQUIRE(DynamicSchedule::guided().chunk_size() == 1);
+        }
+    }
+
+    SECTION("operator==/operator!=") {
+        REQUIRE(defaulted == DynamicSchedule::fixed(1));
+        REQUIRE_FALSE(defaulted != DynamicSchedule::fixed(1));
+
+        // Different chunk sizes
+        REQUIRE(defaulted != fixed);
+
+        // Different kinds
+        REQUIRE(fixed != DynamicSchedule::guided(4));
+    }
+}
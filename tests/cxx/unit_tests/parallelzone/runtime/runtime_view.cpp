@@ -16,9 +16,12 @@
 
 #include "../test_parallelzone.hpp"
 #include <iostream>
+#include <numeric>
+#include <parallelzone/logging/detail_/spdlog/spdlog.hpp>
 #include <parallelzone/logging/logger_factory.hpp>
 #include <parallelzone/mpi_helpers/commpp/commpp.hpp>
 #include <parallelzone/runtime/detail_/resource_set_pimpl.hpp>
+#include <spdlog/sinks/ostream_sink.h>
 #include <sstream>
 
 using namespace parallelzone;
@@ -249,6 +252,15 @@ TEST_CASE("RuntimeView") {
         REQUIRE(rv == corr);
     }
 
+    SECTION("gather_in_place") {
+        std::vector<int> data(defaulted.size(), 0);
+        data[comm.me()] = comm.me();
+        defaulted.gather_in_place(std::span(data));
+        std::vector<int> corr(defaulted.size());
+        std::iota(corr.begin(), corr.end(), 0);
+        REQUIRE(data == corr);
+    }
+
     SECTION("gatherv") {
         using data_type = std::vector<std::string>;
         data_type local_data(3, "Hello");
@@ -257,12 +269,194 @@ TEST_CASE("RuntimeView") {
         REQUIRE(rv == corr);
     }
 
+    SECTION("gatherv_with_counts") {
+        std::vector<double> local_data(2, 1.0);
+        auto [rv, counts, offsets] = defaulted.gatherv_with_counts(local_data);
+        REQUIRE(rv == std::vector<double>(2 * defaulted.size(), 1.0));
+        REQUIRE(counts == std::vector<std::size_t>(defaulted.size(), 2));
+        REQUIRE(offsets.back() == 2 * (defaulted.size() - 1));
+    }
+
     SECTION("reduce") {
         using data_type = std::vector<double>;
         data_type local_data(3, 1.0);
         auto rv = defaulted.reduce(local_data, std::plus<double>());
         data_type corr(3, comm.size());
         REQUIRE(rv == corr);
+
+        auto max = [](double lhs, double rhs) { return std::max(lhs, rhs); };
+        REQUIRE(defaulted.reduce(local_data, max) == local_data);
+    }
+
+    SECTION("reduce_in_place") {
+        std::vector<double> data(3, 1.0);
+        defaulted.reduce_in_place(std::span(data), std::plus<double>());
+        REQUIRE(data == std::vector<double>(3, comm.size()));
+    }
+
+    SECTION("broadcast") {
+        using data_type = std::vector<std::string>;
+        data_type corr(3, "Hello");
+        data_type local_data;
+        if(defaulted.at(0).is_mine()) local_data = corr;
+        REQUIRE(defaulted.broadcast(local_data, 0) == corr);
+    }
+
+    SECTION("scatter") {
+        std::vector<double> local_data;
+        if(defaulted.at(0).is_mine()) local_data.resize(defaulted.size(), 1.0);
+        auto rv = defaulted.scatter(local_data, 0);
+        REQUIRE(rv == std::vector<double>{1.0});
+    }
+
+    SECTION("scatterv") {
+        std::vector<double> local_data;
+        if(defaulted.at(0).is_mine()) local_data.resize(defaulted.size(), 1.0);
+        auto rv = defaulted.scatterv(local_data, 0);
+        REQUIRE(rv == std::vector<double>{1.0});
+    }
+
+    SECTION("alltoall") {
+        // Every rank sends its rank to every rank
+        const auto me = defaulted.my_resource_set().mpi_rank();
+        std::vector<std::string> local_data(defaulted.size(),
+                                            std::to_string(me));
+        std::vector<std::string> corr;
+        for(std::size_t r = 0; r < defaulted.size(); ++r)
+            corr.push_back(std::to_string(r));
+        REQUIRE(defaulted.alltoall(local_data) == corr);
+    }
+
+    SECTION("alltoallv") {
+        // Every rank sends one element to every rank
+        std::vector<double> local_data(defaulted.size(), 1.0);
+        std::vector<int> counts(defaulted.size(), 1);
+        auto [rv, rv_counts] = defaulted.alltoallv(local_data, counts);
+        REQUIRE(rv == local_data);
+        REQUIRE(rv_counts == counts);
+    }
+
+    SECTION("igather") {
+        using data_type = std::vector<std::string>;
+        data_type local_data(3, "Hello");
+        auto rv = defaulted.igather(local_data);
+        std::vector<data_type> corr(defaulted.size(), local_data);
+        REQUIRE(rv.get() == corr);
+    }
+
+    SECTION("igatherv") {
+        using data_type = std::vector<std::string>;
+        data_type local_data(3, "Hello");
+        auto rv = defaulted.igatherv(local_data);
+        std::vector<data_type> corr(defaulted.size(), local_data);
+        REQUIRE(rv.get() == corr);
+    }
+
+    SECTION("ireduce") {
+        using data_type = std::vector<double>;
+        data_type local_data(3, 1.0);
+        auto rv = defaulted.ireduce(local_data, std::plus<double>());
+        data_type corr(3, comm.size());
+        REQUIRE(rv.get() == corr);
+    }
+
+    SECTION("persistent_reduce") {
+        using data_type = std::vector<double>;
+        auto rv = defaulted.persistent_reduce<double>(3, std::plus<double>());
+        for(int i = 0; i < 3; ++i) {
+            data_type corr(3, i * comm.size());
+            REQUIRE(rv(data_type(3, i)) == corr);
+        }
+    }
+
+    SECTION("allocate_window") {
+        REQUIRE_THROWS_AS(null.allocate_window(8), std::runtime_error);
+        auto window = defaulted.allocate_window(8);
+        REQUIRE(window.size() == comm.size());
+        REQUIRE(window.local().size() == 8);
+    }
+
+    SECTION("expose_window") {
+        std::vector<double> region(2);
+        mpi_helpers::BinaryView view(region.data(), region.size());
+        REQUIRE_THROWS_AS(null.expose_window(view), std::runtime_error);
+        auto window = defaulted.expose_window(view);
+        REQUIRE(window.local_as<double>().data() == region.data());
+    }
+
+    SECTION("for_each_dynamic") {
+        using schedule_type = RuntimeView::schedule_type;
+        const std::size_t n_tasks = 50;
+
+        // Counts how many times each task is run, should be once
+        auto check = [&](schedule_type schedule) {
+            std::vector<int> n_runs(n_tasks, 0);
+            defaulted.for_each_dynamic(
+              n_tasks, [&](std::size_t i) { ++n_runs[i]; }, schedule);
+            return defaulted.reduce(n_runs, std::plus<int>());
+        };
+        const std::vector<int> corr(n_tasks, 1);
+
+        REQUIRE(check(schedule_type{}) == corr);
+        REQUIRE(check(schedule_type::fixed(7)) == corr);
+        REQUIRE(check(schedule_type::guided()) == corr);
+        REQUIRE(check(schedule_type::guided(4)) == corr);
+        REQUIRE(check(schedule_type::fixed(n_tasks + 1)) == corr);
+
+        // No tasks
+        std::size_t n_called = 0;
+        defaulted.for_each_dynamic(0, [&](std::size_t) { ++n_called; });
+        REQUIRE(n_called == 0);
+
+        auto no_op = [](std::size_t) {};
+        REQUIRE_THROWS_AS(null.for_each_dynamic(1, no_op), std::runtime_error);
+    }
+
+    SECTION("comm_stats") {
+        REQUIRE_THROWS_AS(null.set_instrumentation(true), std::runtime_error);
+        REQUIRE_THROWS_AS(null.comm_stats(), std::runtime_error);
+
+        defaulted.set_instrumentation(true);
+        defaulted.gather(std::vector<int>{1, 2});
+        defaulted.reduce(std::vector<int>{1}, std::plus<int>());
+
+        // Summed over every process, but without comm_stats's own gatherv
+        const auto n_ranks = defaulted.size();
+        const auto stats   = defaulted.comm_stats();
+        REQUIRE(stats.ops.size() == 2);
+        const auto& allgather = stats.ops.at("allgather");
+        REQUIRE(allgather.n_calls == n_ranks);
+        REQUIRE(allgather.bytes_sent == n_ranks * 2 * sizeof(int));
+        REQUIRE(stats.ops.at("allreduce").n_calls == n_ranks);
+    }
+
+    SECTION("tune_collectives") {
+        REQUIRE_THROWS_AS(null.tune_collectives(), std::runtime_error);
+
+        // Use a fresh runtime, so the other tests keep the default tuning
+        RuntimeView rt;
+        const auto tuning = rt.tune_collectives();
+        REQUIRE(tuning.n_procs == rt.size());
+        REQUIRE(rt.gather(std::vector<int>{1}).size() == rt.size());
+    }
+
+    SECTION("log_comm_stats_at_finalize") {
+        using pimpl_type = parallelzone::detail_::SpdlogPIMPL;
+        std::stringstream ss;
+        auto sink = std::make_shared<spdlog::sinks::ostream_sink_mt>(ss);
+        Logger log(std::make_unique<pimpl_type>(spdlog::logger("ss", sink)));
+
+        REQUIRE_THROWS_AS(null.log_comm_stats_at_finalize(),
+                          std::runtime_error);
+        {
+            RuntimeView rt;
+            rt.logger() = log;
+            rt.set_instrumentation(true);
+            rt.gather(std::vector<int>{1, 2});
+            rt.log_comm_stats_at_finalize();
+            REQUIRE(ss.str().empty());
+        }
+        REQUIRE(ss.str().find("allgather") != std::string::npos);
     }
 
     SECTION("swap") {
@@ -0,0 +1,139 @@
+/*
+ * Copyright 2026 NWChemEx-Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../test_parallelzone.hpp"
+#include <parallelzone/runtime/task_scheduler.hpp>
+#include <string>
+#include <vector>
+
+using namespace parallelzone::runtime;
+
+/* Testing Strategy:
+ *
+ * Which process runs a task is not deterministic, so the tests check the
+ * results of the tasks and that, across all processes, every task ran exactly
+ * once. To make stealing necessary, some tests have only rank 0 submit.
+ */
+TEST_CASE("TaskScheduler") {
+    auto& rv = testing::PZEnvironment::comm_world();
+    const auto me      = rv.my_resource_set().mpi_rank();
+    const auto n_procs = rv.size();
+
+    TaskScheduler scheduler(rv);
+    auto square = scheduler.register_task([](int x) { return x * x; });
+    auto concat = scheduler.register_task(
+      [](std::string lhs, const std::string& rhs, std::size_t n) {
+          std::string rv;
+          for(std::size_t i = 0; i < n; ++i) rv += lhs + rhs;
+          return rv;
+      });
+    auto thrower = scheduler.register_task([]() -> int {
+        throw std::runtime_error("Task failed");
+    });
+    auto no_op = scheduler.register_task([]() {});
+
+    SECTION("register_task") {
+        REQUIRE(scheduler.n_registered() == 4);
+        REQUIRE(square.id() == 0);
+        REQUIRE(no_op.id() == 3);
+    }
+
+    SECTION("submit") {
+        auto f = scheduler.submit(square, 2);
+        REQUIRE(scheduler.n_pending() == 1);
+
+        TaskScheduler other(rv);
+        REQUIRE_THROWS_AS(other.submit(square, 2), std::out_of_range);
+        scheduler.run();
+    }
+
+    SECTION("run") {
+        SECTION("Every process submits") {
+            std::vector<std::future<int>> results;
+            for(int i = 0; i < 10; ++i)
+                results.push_back(scheduler.submit(square, int(me) * 10 + i));
+            auto stats = scheduler.run();
+            REQUIRE(scheduler.n_pending() == 0);
+
+            for(int i = 0; i < 10; ++i) {
+                const int x = int(me) * 10 + i;
+                REQUIRE(results[i].get() == x * x);
+            }
+            REQUIRE(rv.reduce(stats.n_run, std::plus<std::size_t>()) ==
+                    10 * n_procs);
+        }
+
+        SECTION("Only rank 0 submits") {
+            std::vector<std::future<std::string>> results;
+            if(me == 0) {
+                for(std::size_t i = 0; i < 20; ++i)
+                    results.push_back(scheduler.submit(concat, "a", "b", i));
+            }
+            auto stats = scheduler.run();
+
+            for(std::size_t i = 0; i < results.size(); ++i) {
+                std::string corr;
+                for(std::size_t j = 0; j < i; ++j) corr += "ab";
+                REQUIRE(results[i].get() == corr);
+            }
+            REQUIRE(rv.reduce(stats.n_run, std::plus<std::size_t>()) == 20);
+            if(me != 0) REQUIRE(stats.n_stolen == stats.n_run);
+        }
+
+        SECTION("No tasks") {
+            auto stats = scheduler.run();
+            REQUIRE(stats.n_run == 0);
+            REQUIRE(stats.n_stolen == 0);
+        }
+
+        SECTION("Tasks which throw") {
+            auto bad  = scheduler.submit(thrower);
+            auto good = scheduler.submit(square, 3);
+            auto none = scheduler.submit(no_op);
+            scheduler.run();
+            REQUIRE_THROWS_AS(bad.get(), std::runtime_error);
+            REQUIRE(good.get() == 9);
+            REQUIRE_NOTHROW(none.get());
+        }
+
+        SECTION("Can run more than once") {
+            auto first = scheduler.submit(square, 4);
+            scheduler.run();
+            auto second = scheduler.submit(square, 5);
+            scheduler.run();
+            REQUIRE(first.get() == 16);
+            REQUIRE(second.get() == 25);
+        }
+
+        SECTION("Different registries") {
+            TaskScheduler other(rv);
+            if(me == 0) other.register_task([]() {});
+            if(n_procs > 1)
+                REQUIRE_THROWS_AS(other.run(), std::runtime_error);
+        }
+    }
+
+    SECTION("move") {
+        auto f = scheduler.submit(square, 6);
+        TaskScheduler moved(std::move(scheduler));
+        REQUIRE(moved.n_registered() == 4);
+        REQUIRE(moved.n_pending() == 1);
+        REQUIRE(scheduler.n_registered() == 0);
+        REQUIRE_THROWS_AS(scheduler.run(), std::runtime_error);
+        moved.run();
+        REQUIRE(f.get() == 36);
+    }
+}